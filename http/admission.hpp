@@ -0,0 +1,103 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include "logging.hpp"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/container/flat_map.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+namespace crow
+{
+namespace detail
+{
+
+// Admission control for inbound connections: a global cap and a per-client
+// cap, with loopback exempt from both so operator and management-stack
+// sessions stay responsive while a misconfigured scraper floods the
+// management LAN.  Connections over a cap are shed at accept time, before
+// TLS work is invested in them.
+class AdmissionControl
+{
+  public:
+    // One budget for the whole process; with SO_REUSEPORT reactors the
+    // kernel spreads clients across acceptors, so the bookkeeping is shared
+    // and locked.
+    static AdmissionControl& getInstance()
+    {
+        static AdmissionControl admission;
+        return admission;
+    }
+
+    bool tryAdmit(const boost::asio::ip::address& address)
+    {
+        if (bmcwebMaxConnections == 0 || address.is_loopback())
+        {
+            // Loopback is the reserved operator quota; never shed it
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (totalConnections >= bmcwebMaxConnections)
+        {
+            BMCWEB_LOG_WARNING << "Shedding connection from " << address
+                               << ": " << totalConnections
+                               << " connections at global cap";
+            return false;
+        }
+        size_t& clientCount = perClient[address];
+        if (clientCount >= perClientCap())
+        {
+            BMCWEB_LOG_WARNING << "Shedding connection from " << address
+                               << ": client at per-IP cap";
+            return false;
+        }
+        clientCount++;
+        totalConnections++;
+        return true;
+    }
+
+    void release(const boost::asio::ip::address& address)
+    {
+        if (bmcwebMaxConnections == 0 || address.is_loopback())
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (totalConnections > 0)
+        {
+            totalConnections--;
+        }
+        auto it = perClient.find(address);
+        if (it != perClient.end())
+        {
+            if (it->second > 1)
+            {
+                it->second--;
+            }
+            else
+            {
+                perClient.erase(it);
+            }
+        }
+    }
+
+  private:
+    AdmissionControl() = default;
+
+    static constexpr size_t perClientCap()
+    {
+        // A single client may hold at most a quarter of the budget, but
+        // never fewer than 8 connections
+        return bmcwebMaxConnections / 4 > 8 ? bmcwebMaxConnections / 4 : 8;
+    }
+
+    size_t totalConnections = 0;
+    boost::container::flat_map<boost::asio::ip::address, size_t> perClient;
+    std::mutex mutex;
+};
+
+} // namespace detail
+} // namespace crow
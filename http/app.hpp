@@ -1,5 +1,7 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include "async_resp.hpp"
 #include "http_request.hpp"
 #include "http_server.hpp"
@@ -8,13 +10,18 @@
 #include "routing.hpp"
 #include "utility.hpp"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
 #include <chrono>
 #include <cstdint>
 #include <functional>
 #include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #define BMCWEB_ROUTE(app, url)                                                 \
     app.template route<crow::black_magic::getParameterTag(url)>(url)
@@ -56,6 +63,24 @@ class App
         router.handle(req, asyncResp);
     }
 
+    size_t getBodyLimit(std::string_view url, boost::beast::http::verb method,
+                        size_t defaultLimit)
+    {
+        return router.getBodyLimit(url, method, defaultLimit);
+    }
+
+    bool requestRequiresLogin(std::string_view url,
+                              boost::beast::http::verb method)
+    {
+        return router.requestRequiresLogin(url, method);
+    }
+
+    bool compressionAllowed(std::string_view url,
+                            boost::beast::http::verb method)
+    {
+        return router.compressionAllowed(url, method);
+    }
+
     DynamicRule& routeDynamic(std::string&& rule)
     {
         return router.newRuleDynamic(rule);
@@ -96,8 +121,19 @@ class App
 #ifdef BMCWEB_ENABLE_SSL
         if (-1 == socketFd)
         {
-            sslServer = std::make_unique<ssl_server_t>(
-                this, bindaddrStr, portUint, sslContext, io);
+            if constexpr (bmcwebHttpReactorCount > 1)
+            {
+                // The primary acceptor must also carry SO_REUSEPORT so the
+                // extra reactors can bind the same endpoint.
+                sslServer = std::make_unique<ssl_server_t>(
+                    this, makeReusePortAcceptor(*io, bindaddrStr, portUint),
+                    sslContext, io);
+            }
+            else
+            {
+                sslServer = std::make_unique<ssl_server_t>(
+                    this, bindaddrStr, portUint, sslContext, io);
+            }
         }
         else
         {
@@ -110,8 +146,17 @@ class App
 
         if (-1 == socketFd)
         {
-            server = std::move(std::make_unique<server_t>(
-                this, bindaddrStr, portUint, nullptr, io));
+            if constexpr (bmcwebHttpReactorCount > 1)
+            {
+                server = std::make_unique<server_t>(
+                    this, makeReusePortAcceptor(*io, bindaddrStr, portUint),
+                    nullptr, io);
+            }
+            else
+            {
+                server = std::move(std::make_unique<server_t>(
+                    this, bindaddrStr, portUint, nullptr, io));
+            }
         }
         else
         {
@@ -121,11 +166,25 @@ class App
         server->run();
 
 #endif
+        startReactors();
     }
 
     void stop()
     {
         io->stop();
+        for (const std::shared_ptr<boost::asio::io_context>& reactorIo :
+             reactorIoContexts)
+        {
+            reactorIo->stop();
+        }
+        for (std::thread& reactorThread : reactorThreads)
+        {
+            if (reactorThread.joinable())
+            {
+                reactorThread.join();
+            }
+        }
+        reactorThreads.clear();
     }
 
     void debugPrint()
@@ -144,6 +203,23 @@ class App
         return router.getRoutes(parent);
     }
 
+    // Offloads CPU-bound work (PEM parsing, key generation and similar
+    // crypto) to a shared worker thread and posts the completion back to the
+    // given io_context, so long key operations never freeze the reactor.
+    template <typename Work, typename Completion>
+    static void offloadWork(boost::asio::io_context& ioIn, Work&& work,
+                            Completion&& completion)
+    {
+        static boost::asio::thread_pool workerPool(1);
+        boost::asio::post(
+            workerPool,
+            [&ioIn, work{std::forward<Work>(work)},
+             completion{std::forward<Completion>(completion)}]() mutable {
+                work();
+                boost::asio::post(ioIn, std::move(completion));
+            });
+    }
+
 #ifdef BMCWEB_ENABLE_SSL
     App& sslFile(const std::string& crtFilename, const std::string& keyFilename)
     {
@@ -211,6 +287,49 @@ class App
 #endif
 
   private:
+    // Starts the extra reactors configured by the http-reactor-count option.
+    // Each reactor owns its own io_context, SO_REUSEPORT acceptor and
+    // connections: accept, TLS, parsing and response serialization stay
+    // reactor-local.  Route handlers - and everything they start on the
+    // shared sd_bus connection, which is not thread-safe - are posted to
+    // the primary io_context by Connection::dispatchToRouter, and
+    // websocket route callbacks are pinned there by ConnectionImpl, so
+    // D-Bus and handler-side state remain single-threaded.
+    void startReactors()
+    {
+        if constexpr (bmcwebHttpReactorCount <= 1)
+        {
+            return;
+        }
+        if (socketFd != -1)
+        {
+            // A single inherited (systemd-activated) socket can't be split
+            // into per-reactor SO_REUSEPORT listeners.
+            BMCWEB_LOG_WARNING
+                << "Reactor sharding disabled for inherited socket";
+            return;
+        }
+        for (size_t i = 1; i < bmcwebHttpReactorCount; i++)
+        {
+            auto reactorIo = std::make_shared<boost::asio::io_context>();
+#ifdef BMCWEB_ENABLE_SSL
+            reactorServers.emplace_back(std::make_unique<ssl_server_t>(
+                this, makeReusePortAcceptor(*reactorIo, bindaddrStr, portUint),
+                sslContext, reactorIo));
+#else
+            reactorServers.emplace_back(std::make_unique<server_t>(
+                this, makeReusePortAcceptor(*reactorIo, bindaddrStr, portUint),
+                nullptr, reactorIo));
+#endif
+            reactorServers.back()->disableCertificateReload();
+            reactorServers.back()->run();
+            reactorThreads.emplace_back([reactorIo] { reactorIo->run(); });
+            reactorIoContexts.emplace_back(std::move(reactorIo));
+        }
+        BMCWEB_LOG_INFO << "Started " << reactorThreads.size()
+                        << " additional reactor(s)";
+    }
+
     std::shared_ptr<boost::asio::io_context> io;
 #ifdef BMCWEB_ENABLE_SSL
     uint16_t portUint = 443;
@@ -223,9 +342,13 @@ class App
 
 #ifdef BMCWEB_ENABLE_SSL
     std::unique_ptr<ssl_server_t> sslServer;
+    std::vector<std::unique_ptr<ssl_server_t>> reactorServers;
 #else
     std::unique_ptr<server_t> server;
+    std::vector<std::unique_ptr<server_t>> reactorServers;
 #endif
+    std::vector<std::shared_ptr<boost::asio::io_context>> reactorIoContexts;
+    std::vector<std::thread> reactorThreads;
 };
 } // namespace crow
 using App = crow::App;
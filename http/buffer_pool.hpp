@@ -0,0 +1,122 @@
+#pragma once
+
+#include "logging.hpp"
+
+#include <boost/beast/core/flat_buffer.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace crow
+{
+namespace detail
+{
+
+// Fixed-size scratch storage a Connection borrows for the lifetime of the
+// socket: the beast parser buffer plus response body scratch.  Slabs are
+// recycled through the owning Server's BufferPool instead of being freed on
+// every close, so keep-alive churn doesn't fragment the small BMC heap.
+struct ConnectionSlab
+{
+    ConnectionSlab()
+    {
+        liveSlabCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~ConnectionSlab()
+    {
+        liveSlabCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+    ConnectionSlab(const ConnectionSlab&) = delete;
+    ConnectionSlab& operator=(const ConnectionSlab&) = delete;
+
+    // Live slabs across every pool; the memory diagnostics route reports
+    // liveSlabCount * sizeof(ConnectionSlab) (dynamic buffer capacity is
+    // bounded by bufferMaxSize and shed on release)
+    static inline std::atomic<uint64_t> liveSlabCount{0};
+
+    // Adaptive read buffer: starts empty, grows as beast's read-size hints
+    // demand - an idle poller's headers never cost more than a couple of
+    // KB, while a firmware upload's body reads grow toward the cap and
+    // stop being syscall-bound - and shrinks back when the slab returns to
+    // the pool.
+    static constexpr size_t bufferMaxSize = 256 * 1024;
+    // Above this, a released slab's buffer is reallocated small rather
+    // than parked hot in the pool
+    static constexpr size_t bufferShrinkThreshold = 16 * 1024;
+
+    boost::beast::flat_buffer buffer{bufferMaxSize};
+    std::string scratch;
+
+    void reset()
+    {
+        buffer.consume(buffer.size());
+        if (buffer.capacity() > bufferShrinkThreshold)
+        {
+            buffer = boost::beast::flat_buffer{bufferMaxSize};
+        }
+        scratch.clear();
+        if (scratch.capacity() > bufferShrinkThreshold)
+        {
+            scratch.shrink_to_fit();
+        }
+    }
+};
+
+// Recycling pool of ConnectionSlabs.  One pool per Server, and connections
+// never leave their reactor, so no locking is needed.
+class BufferPool
+{
+  public:
+    std::unique_ptr<ConnectionSlab> acquire()
+    {
+        inUseCount++;
+        if (freeSlabs.empty())
+        {
+            BMCWEB_LOG_DEBUG << "BufferPool grow, in use " << inUseCount;
+            return std::make_unique<ConnectionSlab>();
+        }
+        std::unique_ptr<ConnectionSlab> slab = std::move(freeSlabs.back());
+        freeSlabs.pop_back();
+        return slab;
+    }
+
+    void release(std::unique_ptr<ConnectionSlab>&& slab)
+    {
+        if (inUseCount > 0)
+        {
+            inUseCount--;
+        }
+        if (slab == nullptr)
+        {
+            return;
+        }
+        slab->reset();
+        if (freeSlabs.size() < maxFreeSlabs)
+        {
+            freeSlabs.emplace_back(std::move(slab));
+        }
+    }
+
+    // Gauges of pool occupancy, for debugging memory pressure.
+    size_t inUse() const
+    {
+        return inUseCount;
+    }
+
+    size_t cached() const
+    {
+        return freeSlabs.size();
+    }
+
+  private:
+    // Bounds how many idle slabs stay cached; each holds an 8k parser buffer.
+    static constexpr size_t maxFreeSlabs = 16;
+
+    std::vector<std::unique_ptr<ConnectionSlab>> freeSlabs;
+    size_t inUseCount = 0;
+};
+
+} // namespace detail
+} // namespace crow
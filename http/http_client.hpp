@@ -22,12 +22,15 @@
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/ssl/ssl_stream.hpp>
 #include <boost/beast/version.hpp>
+#include <openssl/ssl.h>
 #include <include/async_resolve.hpp>
 
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 
@@ -60,6 +63,63 @@ enum class ConnState
     retry
 };
 
+// Per-destination TLS session store: the session captured after a full
+// handshake is offered on the next connection to the same host:port, so a
+// subscriber reconnect resumes with one round trip instead of a full
+// handshake and certificate exchange - and a resumed session carries the
+// prior verification with it, which is the cache of the verify result.
+class TlsSessionStore
+{
+  public:
+    static TlsSessionStore& getInstance()
+    {
+        static TlsSessionStore store;
+        return store;
+    }
+
+    void save(const std::string& key, SSL* ssl)
+    {
+        SSL_SESSION* session = SSL_get1_session(ssl);
+        if (session == nullptr)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = sessions.find(key);
+        if (it != sessions.end())
+        {
+            SSL_SESSION_free(it->second);
+            it->second = session;
+            return;
+        }
+        if (sessions.size() >= maxSessions)
+        {
+            // Small fixed budget; evict an arbitrary entry
+            auto victim = sessions.begin();
+            SSL_SESSION_free(victim->second);
+            sessions.erase(victim);
+        }
+        sessions[key] = session;
+    }
+
+    void offerResumption(const std::string& key, SSL* ssl)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = sessions.find(key);
+        if (it != sessions.end())
+        {
+            SSL_set_session(ssl, it->second);
+        }
+    }
+
+  private:
+    TlsSessionStore() = default;
+
+    static constexpr size_t maxSessions = 16;
+    std::unordered_map<std::string, SSL_SESSION*> sessions;
+    std::mutex mutex;
+};
+
 class HttpClient : public std::enable_shared_from_this<HttpClient>
 {
   private:
@@ -81,10 +141,26 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
     std::string host;
     std::string port;
     uint32_t retryCount = 0;
+    uint64_t droppedEvents = 0;
     uint32_t maxRetryAttempts = 5;
     uint32_t retryIntervalSecs = 0;
     std::string retryPolicyAction = "TerminateAfterRetries";
     bool runningTimer = false;
+    std::chrono::time_point<std::chrono::steady_clock> sendStartTime{};
+    std::function<void(bool, uint64_t)> deliveryObserver;
+
+    void reportDelivery(bool ok)
+    {
+        if (!deliveryObserver)
+        {
+            return;
+        }
+        uint64_t latencyUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - sendStartTime)
+                .count());
+        deliveryObserver(ok, latencyUs);
+    }
 
     void doResolve()
     {
@@ -113,7 +189,18 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
         const std::vector<boost::asio::ip::tcp::endpoint>& endpointList)
     {
         state = ConnState::connectInProgress;
-        sslConn.emplace(conn, ctx);
+        if (sslConn)
+        {
+            // Fresh stream per connection attempt; plain-http destinations
+            // must not grow one here
+            sslConn.emplace(conn, ctx);
+            // SNI for virtual-hosted collectors, and the stored session for
+            // an abbreviated handshake on reconnect
+            SSL_set_tlsext_host_name(sslConn->native_handle(), host.c_str());
+            TlsSessionStore::getInstance().offerResumption(host + ':' + port,
+                                                           sslConn->
+                                                               native_handle());
+        }
 
         BMCWEB_LOG_DEBUG << "Trying to connect to: " << host << ":" << port;
         auto respHandler = [self(shared_from_this())](
@@ -158,7 +245,14 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
                     return;
                 }
 
-                BMCWEB_LOG_DEBUG << "SSL Handshake successfull";
+                BMCWEB_LOG_DEBUG
+                    << "SSL Handshake successful"
+                    << (SSL_session_reused(self->sslConn->native_handle()) != 0
+                            ? " (session resumed)"
+                            : "");
+                TlsSessionStore::getInstance().save(
+                    self->host + ':' + self->port,
+                    self->sslConn->native_handle());
                 self->state = ConnState::connected;
                 self->handleConnState();
             });
@@ -168,6 +262,7 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
     {
         BMCWEB_LOG_DEBUG << __FUNCTION__ << "(): " << host << ":" << port;
         state = ConnState::sendInProgress;
+        sendStartTime = std::chrono::steady_clock::now();
 
         req.body() = data;
         req.prepare_payload();
@@ -179,6 +274,7 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
             {
                 BMCWEB_LOG_ERROR << "sendMessage() failed: " << ec.message();
                 self->state = ConnState::sendFailed;
+                self->reportDelivery(false);
                 self->handleConnState();
                 return;
             }
@@ -213,6 +309,7 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
                 BMCWEB_LOG_ERROR << "recvMessage() failed: " << ec.message();
 
                 self->state = ConnState::recvFailed;
+                self->reportDelivery(false);
                 self->handleConnState();
                 return;
             }
@@ -244,9 +341,11 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
                                     "receive Sent-Event. Header Response Code: "
                                  << respCode;
                 self->state = ConnState::recvFailed;
+                self->reportDelivery(false);
                 self->handleConnState();
                 return;
             }
+            self->reportDelivery(true);
 
             // Send is successful, Lets remove data from queue
             // check for next request data in queue.
@@ -481,7 +580,7 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
                     BMCWEB_LOG_DEBUG << "requestDataQueue is empty";
                     return;
                 }
-                std::string data = requestDataQueue.front();
+                const std::string& data = requestDataQueue.front();
                 sendMessage(data);
                 break;
             }
@@ -514,10 +613,27 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
         requestDataQueue.set_capacity(maxRequestQueueSize);
         if (uriProto == "https")
         {
+#ifdef BMCWEB_ENABLE_EVENT_TLS_VERIFY
+            // Opt-in peer verification against the system trust store;
+            // resumed sessions carry the prior verification
+            ctx.set_default_verify_paths();
+            ctx.set_verify_mode(boost::asio::ssl::verify_peer);
+#endif
             sslConn.emplace(conn, ctx);
         }
     }
-    void sendData(const std::string& data)
+    // Bytes waiting in the outbound event queue; scrape-time only
+    size_t queuedBytes() const
+    {
+        size_t bytes = 0;
+        for (const std::string& entry : requestDataQueue)
+        {
+            bytes += entry.capacity();
+        }
+        return bytes;
+    }
+
+    void sendData(std::string data)
     {
         if ((state == ConnState::suspended) || (state == ConnState::terminated))
         {
@@ -526,17 +642,40 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
             return;
         }
 
-        if (requestDataQueue.size() <= maxRequestQueueSize)
+        if (requestDataQueue.size() >= maxRequestQueueSize)
         {
-            requestDataQueue.push_back(data);
-            handleConnState();
-        }
-        else
-        {
-            BMCWEB_LOG_ERROR << "Request queue is full. So ignoring data.";
+            // Bounded queue overflow: drop the oldest queued event so the
+            // most recent ones survive.  A dead or slow listener sees a gap
+            // instead of stale events, and its memory stays capped.
+            droppedEvents++;
+            BMCWEB_LOG_ERROR << "Request queue is full. Dropping oldest "
+                                "event for subscriber "
+                             << subId << " (" << droppedEvents
+                             << " dropped total)";
+            if ((state == ConnState::sendInProgress ||
+                 state == ConnState::recvInProgress) &&
+                requestDataQueue.size() > 1)
+            {
+                // The front entry is in flight and gets popped by the
+                // receive completion; drop the oldest unsent one instead.
+                requestDataQueue.erase(requestDataQueue.begin() + 1);
+            }
+            else
+            {
+                requestDataQueue.pop_front();
+            }
         }
+        requestDataQueue.push_back(std::move(data));
+        handleConnState();
+    }
 
-        return;
+    // Observer for per-send outcomes: invoked with success and the
+    // round-trip latency, so the subscription layer can score delivery
+    // health and trip its circuit breaker
+    void setDeliveryObserver(
+        std::function<void(bool, uint64_t)>&& observerIn)
+    {
+        deliveryObserver = std::move(observerIn);
     }
 
     void setRetryConfig(const uint32_t retryAttempts,
@@ -557,4 +696,310 @@ class HttpClient : public std::enable_shared_from_this<HttpClient>
     }
 };
 
+// Round-robins event deliveries across a small set of keep-alive
+// connections to one destination, so subscriber throughput scales with the
+// number of connections instead of serializing behind one round trip.
+// Retry, backoff and queue state stay isolated per connection.
+class HttpClientPool
+{
+  public:
+    static constexpr size_t defaultPoolSize = 2;
+
+    HttpClientPool(boost::asio::io_context& ioc, const std::string& id,
+                   const std::string& destIP, const std::string& destPort,
+                   const std::string& destUri, const std::string& uriProto,
+                   const boost::beast::http::fields& httpHeader,
+                   size_t poolSize = defaultPoolSize)
+    {
+        if (poolSize == 0)
+        {
+            poolSize = 1;
+        }
+        clients.reserve(poolSize);
+        for (size_t i = 0; i < poolSize; i++)
+        {
+            // Members share the subscriber id: retry-policy termination
+            // removes the subscription by this id, so it must stay exact
+            clients.emplace_back(std::make_shared<HttpClient>(
+                ioc, id, destIP, destPort, destUri, uriProto, httpHeader));
+        }
+    }
+
+    void sendData(std::string data)
+    {
+        // Pick the next usable connection; a suspended or terminated member
+        // is skipped the same way a single client would have dropped
+        for (size_t attempt = 0; attempt < clients.size(); attempt++)
+        {
+            const std::shared_ptr<HttpClient>& client =
+                clients[nextClient++ % clients.size()];
+            ConnState state = client->getConnState();
+            if (state != ConnState::suspended &&
+                state != ConnState::terminated)
+            {
+                client->sendData(std::move(data));
+                return;
+            }
+        }
+        BMCWEB_LOG_ERROR
+            << "All pooled connections suspended or terminated; "
+               "dropping event";
+    }
+
+    size_t queuedBytes() const
+    {
+        size_t bytes = 0;
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            bytes += client->queuedBytes();
+        }
+        return bytes;
+    }
+
+    void setDeliveryObserver(std::function<void(bool, uint64_t)> observerIn)
+    {
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            std::function<void(bool, uint64_t)> copy = observerIn;
+            client->setDeliveryObserver(std::move(copy));
+        }
+    }
+
+    void setRetryConfig(const uint32_t retryAttempts,
+                        const uint32_t retryTimeoutInterval)
+    {
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            client->setRetryConfig(retryAttempts, retryTimeoutInterval);
+        }
+    }
+
+    void setRetryPolicy(const std::string& retryPolicy)
+    {
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            client->setRetryPolicy(retryPolicy);
+        }
+    }
+
+    // Usable when any member connection still accepts traffic
+    bool isAvailable() const
+    {
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            ConnState state = client->getConnState();
+            if (state != ConnState::suspended &&
+                state != ConnState::terminated)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Terminated only when every member connection is
+    bool isTerminated() const
+    {
+        for (const std::shared_ptr<HttpClient>& client : clients)
+        {
+            if (client->getConnState() != ConnState::terminated)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    std::vector<std::shared_ptr<HttpClient>> clients;
+    size_t nextClient = 0;
+};
+
+// Request/response client for the aggregation proxy.  HttpClient above is a
+// one-way event pusher (responses are drained and discarded); proxying
+// needs the response back, so this keeps one persistent plain-TCP
+// connection per satellite, runs the queued requests strictly in order,
+// and hands each completion the full beast response.  Satellites live on
+// the chassis-internal network, which is why TLS is not spoken here.
+class ProxyClient : public std::enable_shared_from_this<ProxyClient>
+{
+  public:
+    using ProxyResponse =
+        boost::beast::http::response<boost::beast::http::string_body>;
+    using ResponseHandler =
+        std::function<void(const boost::system::error_code&, ProxyResponse&)>;
+
+    // Responses above this size fail the proxied request rather than
+    // buffer without bound
+    static constexpr size_t proxyBodyLimit = 16 * 1024 * 1024;
+
+    ProxyClient(boost::asio::io_context& iocIn, const std::string& destIpIn,
+                const std::string& destPortIn) :
+        conn(iocIn),
+        ioc(iocIn), host(destIpIn), port(destPortIn)
+    {}
+
+    void sendRequest(
+        boost::beast::http::request<boost::beast::http::string_body>&& req,
+        ResponseHandler&& handler)
+    {
+        if (pending.size() >= maxRequestQueueSize)
+        {
+            boost::system::error_code ec = boost::asio::error::no_buffer_space;
+            ProxyResponse empty;
+            handler(ec, empty);
+            return;
+        }
+        req.set(boost::beast::http::field::host, host);
+        req.prepare_payload();
+        pending.emplace_back(
+            PendingRequest{std::move(req), std::move(handler)});
+        if (!busy)
+        {
+            busy = true;
+            if (connected)
+            {
+                writeFront();
+            }
+            else
+            {
+                doResolveAndConnect();
+            }
+        }
+    }
+
+  private:
+    struct PendingRequest
+    {
+        boost::beast::http::request<boost::beast::http::string_body> req;
+        ResponseHandler handler;
+    };
+
+    void doResolveAndConnect()
+    {
+        resolver.asyncResolve(
+            host, port,
+            [self(shared_from_this())](
+                const boost::beast::error_code ec,
+                const std::vector<boost::asio::ip::tcp::endpoint>&
+                    endpointList) {
+                if (ec || endpointList.empty())
+                {
+                    self->failAll(ec ? ec : boost::asio::error::host_not_found);
+                    return;
+                }
+                self->conn.expires_after(std::chrono::seconds(10));
+                self->conn.async_connect(
+                    endpointList,
+                    [self](const boost::beast::error_code ec2,
+                           const boost::asio::ip::tcp::endpoint&) {
+                        if (ec2)
+                        {
+                            self->failAll(ec2);
+                            return;
+                        }
+                        self->connected = true;
+                        self->writeFront();
+                    });
+            });
+    }
+
+    void writeFront()
+    {
+        if (pending.empty())
+        {
+            // Disarm the stream timer while idle so a kept-alive connection
+            // doesn't fail its next request on a stale deadline
+            conn.expires_never();
+            busy = false;
+            return;
+        }
+        conn.expires_after(std::chrono::seconds(30));
+        boost::beast::http::async_write(
+            conn, pending.front().req,
+            [self(shared_from_this())](const boost::beast::error_code ec,
+                                       std::size_t) {
+                if (ec)
+                {
+                    self->connectionLost(ec);
+                    return;
+                }
+                self->readResponse();
+            });
+    }
+
+    void readResponse()
+    {
+        parser.emplace(std::piecewise_construct, std::make_tuple());
+        parser->body_limit(proxyBodyLimit);
+        boost::beast::http::async_read(
+            conn, buffer, *parser,
+            [self(shared_from_this())](const boost::beast::error_code ec,
+                                       std::size_t) {
+                PendingRequest request = std::move(self->pending.front());
+                self->pending.pop_front();
+                if (ec)
+                {
+                    ProxyResponse empty;
+                    request.handler(ec, empty);
+                    self->connectionLost(ec);
+                    return;
+                }
+                ProxyResponse resp = self->parser->release();
+                bool keepAlive = resp.keep_alive();
+                boost::system::error_code okEc;
+                request.handler(okEc, resp);
+                if (!keepAlive)
+                {
+                    self->connected = false;
+                    boost::beast::error_code ignored;
+                    self->conn.socket().close(ignored);
+                    if (!self->pending.empty())
+                    {
+                        self->doResolveAndConnect();
+                        return;
+                    }
+                    self->busy = false;
+                    return;
+                }
+                self->writeFront();
+            });
+    }
+
+    // A transport error fails everything queued; the next request starts a
+    // fresh connection
+    void connectionLost(const boost::beast::error_code& ec)
+    {
+        connected = false;
+        boost::beast::error_code ignored;
+        conn.socket().close(ignored);
+        failAll(ec);
+    }
+
+    void failAll(const boost::beast::error_code& ec)
+    {
+        std::deque<PendingRequest> failed = std::move(pending);
+        pending.clear();
+        busy = false;
+        for (PendingRequest& request : failed)
+        {
+            ProxyResponse empty;
+            request.handler(ec, empty);
+        }
+    }
+
+    boost::beast::tcp_stream conn;
+    boost::asio::io_context& ioc;
+    crow::async_resolve::Resolver resolver;
+    std::string host;
+    std::string port;
+    std::deque<PendingRequest> pending;
+    std::optional<boost::beast::http::response_parser<
+        boost::beast::http::string_body>>
+        parser;
+    boost::beast::flat_buffer buffer;
+    bool connected = false;
+    bool busy = false;
+};
+
 } // namespace crow
@@ -2,9 +2,14 @@
 #include "bmcweb_config.h"
 
 #include "authorization.hpp"
+#include "buffer_pool.hpp"
 #include "http_response.hpp"
 #include "http_utility.hpp"
 #include "logging.hpp"
+#include "metrics.hpp"
+#include "qos.hpp"
+#include "rate_limiter.hpp"
+#include "runtime_config.hpp"
 #include "timer_queue.hpp"
 #include "utility.hpp"
 
@@ -12,12 +17,16 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/beast/core/flat_static_buffer.hpp>
+#include <boost/beast/http/buffer_body.hpp>
 #include <boost/beast/ssl/ssl_stream.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/url/url_view.hpp>
+#include <gzip_helper.hpp>
 #include <json_html_serializer.hpp>
+#include <json_stream_serializer.hpp>
 #include <security_headers.hpp>
 #include <ssl_key_handler.hpp>
 
@@ -47,32 +56,85 @@ constexpr uint64_t loggedOutPostBodyLimit = 4096;
 
 constexpr uint32_t httpHeaderLimit = 8192;
 
-// drop all connections after 3 minutes, this time limit was chosen
-// arbitrarily and can be adjusted later if needed
-static constexpr const size_t loggedInAttempts =
-    (180 / timerQueueTimeoutSeconds);
+// Scope guard attributing synchronous event-loop occupancy to a route;
+// only dispatches that exceed the blame threshold reach the offender table
+class LoopBlameProbe
+{
+  public:
+    explicit LoopBlameProbe(std::string_view routeIn) :
+        route(routeIn), start(std::chrono::steady_clock::now())
+    {}
+    ~LoopBlameProbe()
+    {
+        uint64_t heldUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+        metrics::RequestMetrics::getInstance().recordBlocking(route, heldUs);
+    }
+    LoopBlameProbe(const LoopBlameProbe&) = delete;
+    LoopBlameProbe& operator=(const LoopBlameProbe&) = delete;
+
+  private:
+    std::string_view route;
+    std::chrono::time_point<std::chrono::steady_clock> start;
+};
+
+// Dynamic response bodies at or above the runtime-tunable threshold
+// (RuntimeTuning::gzipSizeThreshold, default 1KB) are gzipped when the
+// client accepts it; smaller ones aren't worth the CPU on the BMC
 
 static constexpr const size_t loggedOutAttempts =
     (15 / timerQueueTimeoutSeconds);
 
+// Per-stage deadlines, in timing-wheel ticks.  The wheel is
+// timerQueueTimeoutSeconds-granular, so every budget rounds up to the next
+// tick; headers stay on a tight budget to starve slow-loris clients while
+// uploads, long D-Bus handler chains, and slow response readers each get
+// their own configurable allowance.  Body receive additionally renews on
+// byte progress inside startDeadline, so a legitimate slow upload is bounded
+// by inactivity rather than total transfer time.
+constexpr size_t deadlineTicks(size_t seconds)
+{
+    return (seconds + timerQueueTimeoutSeconds - 1) / timerQueueTimeoutSeconds;
+}
+
+static constexpr const size_t headerDeadlineAttempts =
+    deadlineTicks(bmcwebHttpHeaderTimeoutSeconds);
+static constexpr const size_t bodyDeadlineAttempts =
+    deadlineTicks(bmcwebHttpBodyTimeoutSeconds);
+static constexpr const size_t handlerDeadlineAttempts =
+    deadlineTicks(bmcwebHttpHandlerTimeoutSeconds);
+static constexpr const size_t drainDeadlineAttempts =
+    deadlineTicks(bmcwebHttpDrainTimeoutSeconds);
+
 template <typename Adaptor, typename Handler>
 class Connection :
     public std::enable_shared_from_this<Connection<Adaptor, Handler>>
 {
   public:
     Connection(Handler* handlerIn,
-               std::function<std::string()>& getCachedDateStrF,
-               detail::TimerQueue& timerQueueIn, Adaptor adaptorIn) :
+               std::function<const std::string&()>& getCachedDateStrF,
+               detail::TimerQueue& timerQueueIn,
+               detail::BufferPool& bufferPoolIn, Adaptor adaptorIn) :
         adaptor(std::move(adaptorIn)),
-        handler(handlerIn), getCachedDateStr(getCachedDateStrF),
-        timerQueue(timerQueueIn)
+        handler(handlerIn), slab(bufferPoolIn.acquire()),
+        getCachedDateStr(getCachedDateStrF), timerQueue(timerQueueIn),
+        bufferPool(bufferPoolIn)
     {
         parser.emplace(std::piecewise_construct, std::make_tuple());
         parser->body_limit(httpReqBodyLimit);
         parser->header_limit(httpHeaderLimit);
 
 #ifdef BMCWEB_ENABLE_MUTUAL_TLS_AUTHENTICATION
-        prepareMutualTls();
+        // Only TLS transports carry client certificates; the AF_UNIX
+        // listener authenticates by peer credential instead
+        if constexpr (std::is_same_v<Adaptor,
+                                     boost::beast::ssl_stream<
+                                         boost::asio::ip::tcp::socket>>)
+        {
+            prepareMutualTls();
+        }
 #endif // BMCWEB_ENABLE_MUTUAL_TLS_AUTHENTICATION
 
 #ifdef BMCWEB_ENABLE_DEBUG
@@ -86,6 +148,7 @@ class Connection :
     {
         res.setCompleteRequestHandler(nullptr);
         cancelDeadlineTimer();
+        bufferPool.release(std::move(slab));
 #ifdef BMCWEB_ENABLE_DEBUG
         connectionCount--;
         BMCWEB_LOG_DEBUG << this << " Connection closed, total "
@@ -104,7 +167,13 @@ class Connection :
                                .tls)
         {
             adaptor.set_verify_mode(boost::asio::ssl::verify_peer);
-            std::string id = "bmcweb";
+            // Use a connection-unique session id context so handshakes that
+            // authenticate via client certificate can never be resumed from
+            // the session cache; a resumed handshake skips the verify
+            // callback that creates the user session.
+            static std::atomic<uint64_t> mutualTlsContextCounter{0};
+            std::string id = "bmcweb-mtls-" +
+                             std::to_string(mutualTlsContextCounter++);
             int ret = SSL_set_session_id_context(
                 adaptor.native_handle(),
                 reinterpret_cast<const unsigned char*>(id.c_str()),
@@ -284,10 +353,27 @@ class Connection :
         return adaptor;
     }
 
+    // Holds this connection's admission slot; released when the connection
+    // is destroyed
+    void setAdmissionTicket(std::shared_ptr<void> ticket)
+    {
+        admissionTicket = std::move(ticket);
+    }
+
+    // Installs a session whose identity came from the transport itself
+    // (AF_UNIX peer credentials); header authentication is skipped and the
+    // session survives keep-alive
+    void setTransportSession(
+        std::shared_ptr<persistent_data::UserSession> session)
+    {
+        transportSession = std::move(session);
+    }
+
     void start()
     {
 
-        startDeadline(0);
+        // Header-receive stage (also covers the TLS handshake)
+        startDeadline(headerDeadlineAttempts);
 
         // TODO(ed) Abstract this to a more clever class with the idea of an
         // asynchronous "start"
@@ -318,6 +404,11 @@ class Connection :
     void handle()
     {
         cancelDeadlineTimer();
+        metrics::RequestMetrics::getInstance().inFlight++;
+        requestStartTime = std::chrono::steady_clock::now();
+        // Re-armed at dispatch below; requests that complete before reaching
+        // the handler never report stale stage times
+        traceEnabled = false;
         std::error_code reqEc;
         crow::Request& thisReq = req.emplace(parser->release(), reqEc);
         if (reqEc)
@@ -380,6 +471,7 @@ class Connection :
                 thisReq.getHeaderValue(boost::beast::http::field::upgrade),
                 "websocket"))
         {
+            metrics::RequestMetrics::getInstance().inFlight--;
             handler->handleUpgrade(thisReq, res, std::move(adaptor));
             // delete lambda with self shared_ptr
             // to enable connection destruction
@@ -392,14 +484,87 @@ class Connection :
             boost::ends_with(url, "/attachment"))
         {
             BMCWEB_LOG_DEBUG << "upgrade stream connection";
+            metrics::RequestMetrics::getInstance().inFlight--;
             handler->handleUpgrade(*req, res, std::move(adaptor));
             // delete lambda with self shared_ptr
             // to enable connection destruction
             res.completeRequestHandler = nullptr;
             return;
         }
+        // Opt-in stage timing: one header lookup when disabled, two
+        // monotonic reads when enabled
+        traceEnabled = !thisReq.getHeaderValue("X-Bmcweb-Trace").empty();
+
+        // Two-tier QoS: GETs run under the bulk concurrency cap so a
+        // telemetry storm queues behind itself, never in front of an
+        // operator action
+        // Long-polls (?wait=) park by design for up to a minute and would
+        // pin bulk slots; they bypass the lane
+        if (thisReq.method() == boost::beast::http::verb::get &&
+            thisReq.urlParams.find("wait") == thisReq.urlParams.end())
+        {
+            qos::RequestScheduler::Decision decision =
+                qos::RequestScheduler::getInstance().admitBulk(
+                    [self(shared_from_this())]() {
+                        boost::asio::post(self->adaptor.get_executor(),
+                                          [self]() {
+                                              self->holdingBulkSlot = true;
+                                              self->dispatchToRouter();
+                                          });
+                    });
+            if (decision == qos::RequestScheduler::Decision::shed)
+            {
+                BMCWEB_LOG_WARNING << this
+                                   << " Bulk queue full; shedding GET";
+                res.result(boost::beast::http::status::service_unavailable);
+                res.addHeader("Retry-After", "1");
+                completeRequest();
+                return;
+            }
+            if (decision == qos::RequestScheduler::Decision::parked)
+            {
+                BMCWEB_LOG_DEBUG << this << " Parked behind bulk lane";
+                return;
+            }
+            holdingBulkSlot = true;
+        }
+        dispatchToRouter();
+    }
+
+    void dispatchToRouter()
+    {
+        handlerDispatchTime = std::chrono::steady_clock::now();
+
+        // Handler-execution stage; armed before any thread hop so the
+        // reactor-owned timer wheel is only ever touched from its own
+        // thread
+        startDeadline(handlerDeadlineAttempts);
+
         auto asyncResp = std::make_shared<bmcweb::AsyncResp>(res);
-        handler->handle(thisReq, asyncResp);
+        if constexpr (bmcwebHttpReactorCount > 1)
+        {
+            // Reactors own the transport; route handlers and everything
+            // they start run on the primary io_context, because sd_bus is
+            // not thread-safe and every handler initiates D-Bus calls and
+            // match registrations on the shared connection (the router's
+            // function-local lookup indexes rely on the same
+            // single-threading).  The response completes back onto this
+            // reactor through the completion handler the connection
+            // installed.
+            boost::asio::post(
+                crow::connections::systemBus->get_io_context(),
+                [self(shared_from_this()), asyncResp]() {
+                    LoopBlameProbe probe(self->req->url);
+                    self->handler->handle(*self->req, asyncResp);
+                });
+            return;
+        }
+        {
+            // Attribute synchronous dispatch time: a handler that blocks
+            // the loop here stalls every other connection on this reactor
+            LoopBlameProbe probe(req->url);
+            handler->handle(*req, asyncResp);
+        }
     }
 
     bool isAlive()
@@ -445,9 +610,22 @@ class Connection :
         {
             return;
         }
+        // Serialization (json dump, gzip) also runs on the loop; blame it
+        // to the same route
+        LoopBlameProbe probe(req->url);
         BMCWEB_LOG_INFO << "Response: " << this << ' ' << req->url << ' '
                         << res.resultInt() << " keepalive=" << req->keepAlive();
 
+        // Balance the gauge here so early exits (dead socket) can't leak it
+        metrics::RequestMetrics::getInstance().inFlight--;
+
+        // Free the bulk lane slot exactly once per scheduled GET
+        if (holdingBulkSlot)
+        {
+            holdingBulkSlot = false;
+            qos::RequestScheduler::getInstance().releaseBulk();
+        }
+
         addSecurityHeaders(*req, res);
 
         crow::authorization::cleanupTempSession(*req);
@@ -464,17 +642,57 @@ class Connection :
             res.setCompleteRequestHandler(nullptr);
             return;
         }
-        if (res.body().empty() && !res.jsonValue.empty())
+        if (!res.isStreaming() && res.body().empty() && !res.jsonValue.empty())
         {
             if (http_helpers::requestPrefersHtml(req->getHeaderValue("Accept")))
             {
                 prettyPrintJson(res);
             }
+            else if (http_helpers::requestPrefersCbor(
+                         req->getHeaderValue("Accept")))
+            {
+                // Binary serialization for machine collectors that asked
+                // for it: ~40% smaller than the text form and cheaper to
+                // parse on both ends.  ETag/304 handling stays on the text
+                // path - a CBOR client polling at rate wants the payload,
+                // not a cache dance.
+                std::vector<uint8_t> cbor =
+                    nlohmann::json::to_cbor(res.jsonValue);
+                res.body().assign(
+                    reinterpret_cast<const char*>(cbor.data()), cbor.size());
+                res.addHeader("Content-Type", "application/cbor");
+            }
+            else if (res.isJsonStreaming())
+            {
+                // Serialize incrementally through the chunked path; the
+                // full payload string never materializes.
+                res.jsonMode();
+                res.stream(json_stream_util::JsonChunkGenerator::make(
+                    std::move(res.jsonValue)));
+            }
             else
             {
                 res.jsonMode();
                 res.body() = res.jsonValue.dump(
                     2, ' ', true, nlohmann::json::error_handler_t::replace);
+
+                if (req->method() == boost::beast::http::verb::get &&
+                    res.result() == boost::beast::http::status::ok)
+                {
+                    std::string etag = Response::computeEtag(res.body());
+                    if (!etag.empty())
+                    {
+                        res.addHeader(boost::beast::http::field::etag, etag);
+                        if (req->getHeaderValue(
+                                boost::beast::http::field::if_none_match) ==
+                            etag)
+                        {
+                            res.result(
+                                boost::beast::http::status::not_modified);
+                            res.body().clear();
+                        }
+                    }
+                }
             }
         }
 
@@ -483,6 +701,51 @@ class Connection :
             res.body() = std::string(res.reason());
         }
 
+        // Compress dynamic bodies when the client accepts gzip.  Static
+        // pre-compressed assets and file-backed bodies already carry their
+        // own encoding; ETag/304 handling above ran on the uncompressed
+        // payload, so both sides of the comparison stay consistent.
+        std::string_view compressTarget = req->target();
+        std::size_t compressQueryPos = compressTarget.find('?');
+        if (compressQueryPos != std::string_view::npos)
+        {
+            compressTarget = compressTarget.substr(0, compressQueryPos);
+        }
+        if (http_helpers::isGzipAccepted(req->getHeaderValue(
+                boost::beast::http::field::accept_encoding)) &&
+            handler->compressionAllowed(compressTarget, req->method()))
+        {
+            if (res.isStreaming())
+            {
+                auto compressor = std::make_shared<GzipStreamCompressor>();
+                if (compressor->valid())
+                {
+                    compressor->setInner(res.releaseStreamHandler());
+                    res.stream([compressor]() { return compressor->next(); });
+                    res.addHeader(boost::beast::http::field::content_encoding,
+                                  "gzip");
+                }
+            }
+            else if (!res.isFileBody() &&
+                     res.body().size() >=
+                         crow::runtime_config::RuntimeTuning::getInstance()
+                             .gzipSizeThreshold.load(
+                                 std::memory_order_relaxed) &&
+                     res.result() == boost::beast::http::status::ok &&
+                     res.stringResponse->base().count(
+                         boost::beast::http::field::content_encoding) == 0)
+            {
+                std::string compressed;
+                if (gzipDeflate(res.body(), compressed) &&
+                    compressed.size() < res.body().size())
+                {
+                    res.body() = std::move(compressed);
+                    res.addHeader(boost::beast::http::field::content_encoding,
+                                  "gzip");
+                }
+            }
+        }
+
         if (res.result() == boost::beast::http::status::no_content)
         {
             // Boost beast throws if content is provided on a no-content
@@ -493,10 +756,40 @@ class Connection :
             res.body().clear();
         }
 
+        if (traceEnabled)
+        {
+            // Stage breakdown: auth+parse (start to dispatch), handler incl.
+            // D-Bus fan-out (dispatch to completion).  Serialization and the
+            // socket write can't ride in a header that precedes them; the
+            // latency histogram covers the total.
+            auto now = std::chrono::steady_clock::now();
+            auto stageUs = [](auto duration) {
+                return std::to_string(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        duration)
+                        .count());
+            };
+            res.addHeader("X-Bmcweb-Timing",
+                          "auth=" +
+                              stageUs(handlerDispatchTime -
+                                      requestStartTime) +
+                              "us; handler=" +
+                              stageUs(now - handlerDispatchTime) +
+                              "us; total=" +
+                              stageUs(now - requestStartTime) + "us");
+        }
+
         res.addHeader(boost::beast::http::field::date, getCachedDateStr());
 
         res.keepAlive(req->keepAlive());
 
+        metrics::RequestMetrics::getInstance().recordRequest(
+            static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - requestStartTime)
+                    .count()),
+            res.body().size());
+
         doWrite();
 
         // delete lambda with self shared_ptr
@@ -518,6 +811,17 @@ class Connection :
     boost::system::error_code getClientIp(boost::asio::ip::address& ip)
     {
         boost::system::error_code ec;
+        if constexpr (std::is_same_v<
+                          Adaptor,
+                          boost::asio::local::stream_protocol::socket>)
+        {
+            // AF_UNIX peers have no IP; the unspecified address marks them
+            // as local, which the admission and rate limiters exempt
+            ip = boost::asio::ip::address();
+            return ec;
+        }
+        else
+        {
         BMCWEB_LOG_DEBUG << "Fetch the client IP address";
         boost::asio::ip::tcp::endpoint endpoint =
             boost::beast::get_lowest_layer(adaptor).remote_endpoint(ec);
@@ -532,6 +836,7 @@ class Connection :
         }
         ip = endpoint.address();
         return ec;
+        }
     }
 
   private:
@@ -541,7 +846,7 @@ class Connection :
 
         // Clean up any previous Connection.
         boost::beast::http::async_read_header(
-            adaptor, buffer, *parser,
+            adaptor, slab->buffer, *parser,
             [this,
              self(shared_from_this())](const boost::system::error_code& ec,
                                        std::size_t bytesTransferred) {
@@ -582,13 +887,40 @@ class Connection :
                 {
                     BMCWEB_LOG_DEBUG << "Unable to get client IP";
                 }
-                sessionIsFromTransport = false;
-                userSession = crow::authorization::authenticate(
-                    ip, res, method, parser->get().base(), userSession);
+                if (transportSession != nullptr)
+                {
+                    // Identity established by the transport (AF_UNIX peer
+                    // credentials); header auth doesn't apply
+                    sessionIsFromTransport = true;
+                    userSession = transportSession;
+                }
+                else
+                {
+                    sessionIsFromTransport = false;
+                    userSession = crow::authorization::authenticate(
+                        ip, res, method, parser->get().base(), userSession);
+                }
                 bool loggedIn = userSession != nullptr;
+
+                // Throttle right after authentication: a retry-looping
+                // client costs a map lookup here instead of a handler run
+                if (!rate_limit::RateLimiter::getInstance().admit(
+                        loggedIn ? userSession->uniqueId : std::string(), ip))
+                {
+                    BMCWEB_LOG_WARNING
+                        << this << " Rate limit exceeded; returning 429";
+                    res.result(
+                        boost::beast::http::status::too_many_requests);
+                    res.addHeader("Retry-After", "1");
+                    // The body hasn't been read; don't try to reuse framing
+                    res.keepAlive(false);
+                    doWrite();
+                    return;
+                }
                 if (loggedIn)
                 {
-                    startDeadline(loggedInAttempts);
+                    // Body-receive stage; renewed on byte progress
+                    startDeadline(bodyDeadlineAttempts);
                     BMCWEB_LOG_DEBUG << "Starting slow deadline";
                 }
                 else
@@ -607,6 +939,74 @@ class Connection :
                     startDeadline(loggedOutAttempts);
                     BMCWEB_LOG_DEBUG << "Starting quick deadline";
                 }
+
+                // Apply the matched route's body limit before any body is
+                // buffered; oversized declared lengths reject with 413
+                // instead of allocating
+                std::string_view target = parser->get().target();
+                size_t queryPos = target.find('?');
+                if (queryPos != std::string_view::npos)
+                {
+                    target = target.substr(0, queryPos);
+                }
+                size_t routeBodyLimit = handler->getBodyLimit(
+                    target, method, httpReqBodyLimit);
+                parser->body_limit(routeBodyLimit);
+                const boost::optional<uint64_t> declaredLength =
+                    parser->content_length();
+                if (declaredLength && *declaredLength > routeBodyLimit)
+                {
+                    BMCWEB_LOG_WARNING
+                        << this << " Content length " << *declaredLength
+                        << " over route limit " << routeBodyLimit;
+                    res.result(
+                        boost::beast::http::status::payload_too_large);
+                    res.keepAlive(false);
+                    doWrite();
+                    return;
+                }
+
+                // RFC 7231 100-continue: the client holds the body until we
+                // commit to reading it.  Authentication already ran on the
+                // headers alone, so an expired or missing token on a
+                // privileged route rejects here after a few hundred bytes
+                // instead of after the full upload; anything acceptable
+                // gets the interim response before doRead() pulls the body.
+                if (parser->get().version() >= 11 &&
+                    boost::iequals(
+                        parser->get()[boost::beast::http::field::expect],
+                        "100-continue"))
+                {
+                    if (!loggedIn &&
+                        handler->requestRequiresLogin(target, method))
+                    {
+                        BMCWEB_LOG_WARNING
+                            << this
+                            << " Rejecting unauthenticated 100-continue";
+                        res.result(boost::beast::http::status::unauthorized);
+                        res.keepAlive(false);
+                        doWrite();
+                        return;
+                    }
+                    static constexpr std::string_view continueResponse =
+                        "HTTP/1.1 100 Continue\r\n\r\n";
+                    boost::asio::async_write(
+                        adaptor, boost::asio::buffer(continueResponse),
+                        [this, self(shared_from_this())](
+                            const boost::system::error_code& writeEc,
+                            std::size_t) {
+                            if (writeEc)
+                            {
+                                BMCWEB_LOG_ERROR
+                                    << this << " 100 Continue write failed: "
+                                    << writeEc.message();
+                                close();
+                                return;
+                            }
+                            doRead();
+                        });
+                    return;
+                }
                 doRead();
             });
     }
@@ -616,7 +1016,7 @@ class Connection :
         BMCWEB_LOG_DEBUG << this << " doRead";
 
         boost::beast::http::async_read(
-            adaptor, buffer, *parser,
+            adaptor, slab->buffer, *parser,
             [this,
              self(shared_from_this())](const boost::system::error_code& ec,
                                        std::size_t bytesTransferred) {
@@ -635,14 +1035,6 @@ class Connection :
                     if (isAlive())
                     {
                         cancelDeadlineTimer();
-                        if (userSession != nullptr)
-                        {
-                            startDeadline(loggedInAttempts);
-                        }
-                        else
-                        {
-                            startDeadline(loggedOutAttempts);
-                        }
                     }
                     else
                     {
@@ -665,13 +1057,46 @@ class Connection :
         bool loggedIn = req && req->session;
         if (loggedIn)
         {
-            startDeadline(loggedInAttempts);
+            // Response-drain stage
+            startDeadline(drainDeadlineAttempts);
         }
         else
         {
             startDeadline(loggedOutAttempts);
         }
         BMCWEB_LOG_DEBUG << this << " doWrite";
+        if (res.isFileBody())
+        {
+            // File-backed mode: beast drains the open file in fixed-size
+            // reads, so the asset never lands in res.body() wholesale.
+            fileResponse.emplace();
+            fileResponse->base() = res.stringResponse->base();
+            fileResponse->body() = std::move(*res.fileHandle);
+            fileResponse->prepare_payload();
+            fileSerializer.emplace(*fileResponse);
+            boost::beast::http::async_write(
+                adaptor, *fileSerializer,
+                [this,
+                 self(shared_from_this())](const boost::system::error_code& ec,
+                                           std::size_t bytesTransferred) {
+                    BMCWEB_LOG_DEBUG << this << " async_write (file) "
+                                     << bytesTransferred << " bytes";
+                    afterWrite(ec);
+                });
+            return;
+        }
+        if (res.isStreaming())
+        {
+            // Streaming mode: the body is pulled from the generator chunk by
+            // chunk and sent with chunked encoding, so the full payload is
+            // never buffered in memory.
+            streamingResponse.emplace();
+            streamingResponse->base() = res.stringResponse->base();
+            streamingResponse->chunked(true);
+            streamingSerializer.emplace(*streamingResponse);
+            doWriteStreamChunk();
+            return;
+        }
         res.preparePayload();
         serializer.emplace(*res.stringResponse);
         boost::beast::http::async_write(
@@ -681,40 +1106,86 @@ class Connection :
                                        std::size_t bytesTransferred) {
                 BMCWEB_LOG_DEBUG << this << " async_write " << bytesTransferred
                                  << " bytes";
+                afterWrite(ec);
+            });
+    }
 
-                cancelDeadlineTimer();
-
-                if (ec)
-                {
-                    BMCWEB_LOG_DEBUG << this << " from write(2)";
-                    return;
-                }
-                if (!res.keepAlive())
+    void doWriteStreamChunk()
+    {
+        slab->scratch = res.nextChunk();
+        streamingResponse->body().data = slab->scratch.data();
+        streamingResponse->body().size = slab->scratch.size();
+        streamingResponse->body().more = !slab->scratch.empty();
+        boost::beast::http::async_write(
+            adaptor, *streamingSerializer,
+            [this,
+             self(shared_from_this())](const boost::system::error_code& ec,
+                                       std::size_t bytesTransferred) {
+                BMCWEB_LOG_DEBUG << this << " async_write (stream) "
+                                 << bytesTransferred << " bytes";
+                if (ec == boost::beast::http::error::need_buffer)
                 {
-                    close();
-                    BMCWEB_LOG_DEBUG << this << " from write(1)";
+                    // Serializer drained the current chunk; fetch the next.
+                    doWriteStreamChunk();
                     return;
                 }
+                afterWrite(ec);
+            });
+    }
 
-                serializer.reset();
-                BMCWEB_LOG_DEBUG << this << " Clearing response";
-                res.clear();
-                parser.emplace(std::piecewise_construct, std::make_tuple());
-                parser->body_limit(httpReqBodyLimit); // reset body limit for
-                                                      // newly created parser
-                buffer.consume(buffer.size());
-
-                // If the session was built from the transport, we don't need to
-                // clear it.  All other sessions are generated per request.
-                if (!sessionIsFromTransport)
-                {
-                    userSession = nullptr;
-                }
+    void afterWrite(const boost::system::error_code& ec)
+    {
+        cancelDeadlineTimer();
 
-                // Destroy the Request via the std::optional
-                req.reset();
-                doReadHeaders();
-            });
+        if (ec)
+        {
+            BMCWEB_LOG_DEBUG << this << " from write(2)";
+            return;
+        }
+        if (!res.keepAlive())
+        {
+            close();
+            BMCWEB_LOG_DEBUG << this << " from write(1)";
+            return;
+        }
+
+        serializer.reset();
+        streamingSerializer.reset();
+        streamingResponse.reset();
+        fileSerializer.reset();
+        fileResponse.reset();
+        slab->scratch.clear();
+        BMCWEB_LOG_DEBUG << this << " Clearing response";
+        res.clear();
+
+        // Beast parsers are single-shot, but the previous request's body
+        // string keeps its heap allocation through clear().  Seeding the
+        // fresh parser's message with it means a monitoring session firing
+        // many similarly sized requests down one connection reallocates the
+        // body only when one outgrows every predecessor.
+        std::string recycledBody;
+        if (req)
+        {
+            recycledBody = std::move(req->req.body());
+            recycledBody.clear();
+        }
+        parser.emplace(std::piecewise_construct, std::make_tuple());
+        parser->get().body() = std::move(recycledBody);
+        parser->body_limit(httpReqBodyLimit); // reset body limit for
+                                              // newly created parser
+        parser->header_limit(httpHeaderLimit);
+        slab->buffer.consume(slab->buffer.size());
+
+        // If the session was built from the transport, we don't need to
+        // clear it.  All other sessions are generated per request.
+        if (!sessionIsFromTransport)
+        {
+            userSession = nullptr;
+        }
+
+        // Destroy the Request via the std::optional
+        req.reset();
+        doReadHeaders();
     }
 
     void cancelDeadlineTimer()
@@ -782,18 +1253,36 @@ class Connection :
   private:
     Adaptor adaptor;
     Handler* handler;
+    // Parser buffer and response scratch, borrowed from the owning Server's
+    // pool and recycled on destruction.
+    std::unique_ptr<detail::ConnectionSlab> slab;
     // Making this a std::optional allows it to be efficiently destroyed and
     // re-created on Connection reset
     std::optional<
         boost::beast::http::request_parser<boost::beast::http::string_body>>
         parser;
 
-    boost::beast::flat_static_buffer<8192> buffer;
-
     std::optional<boost::beast::http::response_serializer<
         boost::beast::http::string_body>>
         serializer;
 
+    // Streaming (chunked) mode state; only engaged when the handler installed
+    // a body generator via Response::stream().
+    std::optional<
+        boost::beast::http::response<boost::beast::http::buffer_body>>
+        streamingResponse;
+    std::optional<boost::beast::http::response_serializer<
+        boost::beast::http::buffer_body>>
+        streamingSerializer;
+
+    // File-backed body mode state; engaged via Response::openFile().
+    std::optional<
+        boost::beast::http::response<boost::beast::http::file_body>>
+        fileResponse;
+    std::optional<boost::beast::http::response_serializer<
+        boost::beast::http::file_body>>
+        fileSerializer;
+
     std::optional<crow::Request> req;
     crow::Response res;
 
@@ -801,9 +1290,18 @@ class Connection :
     std::shared_ptr<persistent_data::UserSession> userSession;
 
     std::optional<size_t> timerCancelKey;
+    bool holdingBulkSlot = false;
+    std::shared_ptr<persistent_data::UserSession> transportSession;
+
+    std::chrono::time_point<std::chrono::steady_clock> requestStartTime;
+    std::chrono::time_point<std::chrono::steady_clock> handlerDispatchTime;
+    bool traceEnabled = false;
+
+    std::shared_ptr<void> admissionTicket;
 
-    std::function<std::string()>& getCachedDateStr;
+    std::function<const std::string&()>& getCachedDateStr;
     detail::TimerQueue& timerQueue;
+    detail::BufferPool& bufferPool;
 
     using std::enable_shared_from_this<
         Connection<Adaptor, Handler>>::shared_from_this;
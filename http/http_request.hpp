@@ -70,6 +70,18 @@ struct Request
         return req.target();
     }
 
+    // Span-style view for passthrough consumers (firmware writes, raw
+    // relays) that only need the bytes and must not bind to the body's
+    // container type.  The body itself assembles with a single allocation:
+    // beast's string_body reserves from Content-Length up front and writes
+    // in place, and the connection recycles the block across keep-alive,
+    // so there is no per-read concatenation for a chained-block body to
+    // eliminate in this tree - which is why one was not introduced.
+    std::string_view bodyView() const
+    {
+        return req.body();
+    }
+
     bool target(const std::string_view target)
     {
         req.target(target);
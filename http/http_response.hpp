@@ -2,12 +2,20 @@
 #include "logging.hpp"
 #include "nlohmann/json.hpp"
 
+#include <openssl/sha.h>
+
+#include <json_extern.hpp>
+
 #include <boost/asio/buffer.hpp>
 #include <boost/beast/core/flat_static_buffer.hpp>
 #include <boost/beast/http/basic_dynamic_body.hpp>
+#include <boost/beast/http/file_body.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/http/string_body.hpp>
 
+#include <array>
+#include <cstdio>
+#include <filesystem>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -50,6 +58,14 @@ struct Response
         stringResponse = std::move(r.stringResponse);
         r.stringResponse.emplace(response_type{});
         jsonValue = std::move(r.jsonValue);
+        streamHandler = std::move(r.streamHandler);
+        r.streamHandler = nullptr;
+        fileHandle = std::move(r.fileHandle);
+        r.fileHandle.reset();
+        jsonStreamingEnabled = r.jsonStreamingEnabled;
+        r.jsonStreamingEnabled = false;
+        pagingHandled = r.pagingHandled;
+        r.pagingHandled = false;
         completed = r.completed;
         return *this;
     }
@@ -104,6 +120,10 @@ struct Response
         BMCWEB_LOG_DEBUG << this << " Clearing response containers";
         stringResponse.emplace(response_type{});
         jsonValue.clear();
+        streamHandler = nullptr;
+        fileHandle.reset();
+        jsonStreamingEnabled = false;
+        pagingHandled = false;
         completed = false;
     }
 
@@ -112,6 +132,80 @@ struct Response
         stringResponse->body() += std::string(bodyPart);
     }
 
+    // Switches the response into streaming mode.  Once the headers are
+    // written the connection polls the generator for successive body chunks
+    // and sends them with chunked encoding; returning an empty string ends
+    // the body.  Peak memory stays bounded by the chunk size instead of the
+    // full payload.
+    void stream(std::function<std::string()>&& generator)
+    {
+        streamHandler = std::move(generator);
+    }
+
+    bool isStreaming() const
+    {
+        return streamHandler != nullptr;
+    }
+
+    // File-backed body mode: the connection hands the open file to beast's
+    // file_body, which streams it to the socket in fixed-size reads instead
+    // of copying the whole asset through res.body().
+    bool openFile(const std::filesystem::path& path)
+    {
+        boost::beast::error_code ec;
+        fileHandle.emplace();
+        fileHandle->open(path.c_str(), boost::beast::file_mode::read, ec);
+        if (ec)
+        {
+            fileHandle.reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool isFileBody() const
+    {
+        return fileHandle.has_value();
+    }
+
+    // Ask the connection to serialize jsonValue incrementally through the
+    // chunked streaming path rather than one dump() string.  Handlers that
+    // can produce unbounded trees (enumerate and friends) set this so peak
+    // memory stays bounded by the chunk size.
+    void enableJsonStreaming()
+    {
+        jsonStreamingEnabled = true;
+    }
+
+    bool isJsonStreaming() const
+    {
+        return jsonStreamingEnabled;
+    }
+
+    // Handlers that natively consume $top/$skip (the log services) set this
+    // so the router's generic paging stage doesn't slice Members twice.
+    void setPagingHandled()
+    {
+        pagingHandled = true;
+    }
+
+    bool isPagingHandled() const
+    {
+        return pagingHandled;
+    }
+
+    std::string nextChunk()
+    {
+        return streamHandler();
+    }
+
+    // Hands the installed generator to a wrapper (e.g. the gzip stream
+    // compressor); the caller must install a replacement via stream().
+    std::function<std::string()> releaseStreamHandler()
+    {
+        return std::move(streamHandler);
+    }
+
     void end()
     {
         if (completed)
@@ -139,15 +233,49 @@ struct Response
         return isAliveHelper && isAliveHelper();
     }
 
+    // Strong ETag over the serialized payload: SHA-256 truncated to 128
+    // bits, so two payload versions can't collide the way a 64-bit
+    // std::hash could and silently serve a stale 304.  Scope note: the tag
+    // is computed after the handler already ran, so If-None-Match saves
+    // the transfer, not the BMC-side D-Bus fan-out - answering 304 before
+    // any backend work needs a resource-version cache the tree doesn't
+    // have yet.
+    static std::string computeEtag(std::string_view payload)
+    {
+        std::array<unsigned char, SHA256_DIGEST_LENGTH> digest{};
+        SHA256(reinterpret_cast<const unsigned char*>(payload.data()),
+               payload.size(), digest.data());
+        std::string etag;
+        etag.reserve(34);
+        etag += '"';
+        for (size_t i = 0; i < 16; i++)
+        {
+            std::array<char, 3> hexByte{};
+            snprintf(hexByte.data(), hexByte.size(), "%02x", digest[i]);
+            etag += hexByte.data();
+        }
+        etag += '"';
+        return etag;
+    }
+
     void setCompleteRequestHandler(std::function<void()> newHandler)
     {
         completeRequestHandler = std::move(newHandler);
     }
 
+    std::function<void()> releaseCompleteRequestHandler()
+    {
+        return std::move(completeRequestHandler);
+    }
+
   private:
     bool completed{};
     std::function<void()> completeRequestHandler;
     std::function<bool()> isAliveHelper;
+    std::function<std::string()> streamHandler;
+    std::optional<boost::beast::http::file_body::value_type> fileHandle;
+    bool jsonStreamingEnabled = false;
+    bool pagingHandled = false;
 
     // In case of a JSON object, set the Content-Type header
     void jsonMode()
@@ -1,21 +1,30 @@
 #pragma once
 
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "admission.hpp"
 #include "http_connection.hpp"
 #include "logging.hpp"
 #include "timer_queue.hpp"
 
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
 #include <boost/asio/signal_set.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/beast/ssl/ssl_stream.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <inotify_hub.hpp>
 #include <ssl_key_handler.hpp>
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <future>
 #include <memory>
@@ -25,6 +34,25 @@
 namespace crow
 {
 
+// Builds an acceptor bound with SO_REUSEPORT so several reactors can listen
+// on the same address/port, each draining its own kernel accept queue.
+inline std::unique_ptr<boost::asio::ip::tcp::acceptor>
+    makeReusePortAcceptor(boost::asio::io_context& io,
+                          const std::string& bindaddr, uint16_t port)
+{
+    boost::asio::ip::tcp::endpoint endpoint(
+        boost::asio::ip::make_address(bindaddr), port);
+    auto acceptor = std::make_unique<boost::asio::ip::tcp::acceptor>(io);
+    acceptor->open(endpoint.protocol());
+    acceptor->set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    acceptor->set_option(
+        boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(
+            true));
+    acceptor->bind(endpoint);
+    acceptor->listen(boost::asio::socket_base::max_listen_connections);
+    return acceptor;
+}
+
 template <typename Handler, typename Adaptor = boost::asio::ip::tcp::socket>
 class Server
 {
@@ -76,18 +104,19 @@ class Server
 
     void run()
     {
-        loadCertificate();
+        if (certificateReloadEnabled)
+        {
+            loadCertificate();
+            startCertificateWatch();
+        }
         updateDateStr();
 
-        getCachedDateStr = [this]() -> std::string {
-            static std::chrono::time_point<std::chrono::steady_clock>
-                lastDateUpdate = std::chrono::steady_clock::now();
-            if (std::chrono::steady_clock::now() - lastDateUpdate >=
-                std::chrono::seconds(10))
-            {
-                lastDateUpdate = std::chrono::steady_clock::now();
-                updateDateStr();
-            }
+        // The Date header string is regenerated by the 1-second timer tick
+        // below and handed out by const reference: the per-response cost is
+        // one splice into the header block, with no clock read, no strftime
+        // and no temporary.  Each Server instance owns its own string, so
+        // every reactor's copy stays fresh.
+        getCachedDateStr = [this]() -> const std::string& {
             return this->dateStr;
         };
 
@@ -98,6 +127,17 @@ class Server
             {
                 return;
             }
+            updateDateStr();
+            // Event-loop lag probe: how long a posted no-op waits measures
+            // scheduling latency; blame attribution happens at dispatch
+            auto posted = std::chrono::steady_clock::now();
+            boost::asio::post(*ioService, [posted]() {
+                uint64_t lagUs = static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - posted)
+                        .count());
+                metrics::RequestMetrics::getInstance().recordLoopLag(lagUs);
+            });
             timerQueue.process();
             timer.expires_after(std::chrono::seconds(1));
             timer.async_wait(timerHandler);
@@ -152,7 +192,10 @@ class Server
                 if (signalNo == SIGHUP)
                 {
                     BMCWEB_LOG_INFO << "Receivied reload signal";
-                    loadCertificate();
+                    if (certificateReloadEnabled)
+                    {
+                        reloadCertificateAsync();
+                    }
                     boost::system::error_code ec2;
                     acceptor->cancel(ec2);
                     if (ec2)
@@ -176,6 +219,98 @@ class Server
         ioService->stop();
     }
 
+    // SIGHUP certificate reload: validation (and regeneration, seconds of
+    // keygen when the certificate is invalid) runs on the worker thread and
+    // the fresh context swaps in on the io thread when ready, so live
+    // connections keep being served from the old context meanwhile; new
+    // accepts pick up the new one.  Startup stays synchronous in
+    // loadCertificate() because nothing can accept TLS before a context
+    // exists.
+    void reloadCertificateAsync()
+    {
+#ifdef BMCWEB_ENABLE_SSL
+        std::string sslPemFile("/etc/ssl/certs/https/server.pem");
+        Handler::offloadWork(
+            *ioService,
+            [sslPemFile]() {
+                ensuressl::ensureOpensslKeyPresentAndValid(sslPemFile);
+            },
+            [this, sslPemFile]() {
+                std::shared_ptr<boost::asio::ssl::context> sslContext =
+                    ensuressl::getSslContext(sslPemFile);
+                adaptorCtx = sslContext;
+                handler->ssl(std::move(sslContext));
+                BMCWEB_LOG_INFO << "Certificate reloaded without blocking";
+            });
+#endif
+    }
+
+    // Watches the certificate directory and hot-swaps the context when
+    // server.pem is replaced, so monthly fleet rotation needs no restart and
+    // no signal: new handshakes use the new certificate while existing
+    // sessions drain on the old context.
+    void startCertificateWatch()
+    {
+#ifdef BMCWEB_ENABLE_SSL
+        crow::inotify_hub::InotifyHub& hub =
+            crow::inotify_hub::InotifyHub::getInstance();
+        if (!hub.start(*ioService))
+        {
+            BMCWEB_LOG_ERROR << "Failed to init certificate inotify";
+            return;
+        }
+        int wd = hub.addWatch(
+            "/etc/ssl/certs/https", IN_CLOSE_WRITE | IN_MOVED_TO,
+            [this](const inotify_event&, const std::string& name) {
+                if (name == "server.pem")
+                {
+                    BMCWEB_LOG_INFO
+                        << "Certificate replaced on disk; reloading";
+                    reloadCertificateAsync();
+                }
+            });
+        if (wd == -1)
+        {
+            BMCWEB_LOG_ERROR << "Failed to watch certificate directory";
+        }
+#endif
+    }
+
+    // Secondary reactors must not reload the certificate on SIGHUP; doing so
+    // from multiple threads would race on the shared ssl context.  Only the
+    // primary server performs the reload.
+    void disableCertificateReload()
+    {
+        certificateReloadEnabled = false;
+    }
+
+    // Runs admission control on a freshly accepted socket; a shed
+    // connection is closed before any TLS work is spent on it.  Admitted
+    // connections carry a ticket that releases their slot on destruction.
+    template <typename Socket>
+    bool admit(Socket& socket,
+               const std::shared_ptr<Connection<Adaptor, Handler>>& conn)
+    {
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::endpoint peer = socket.remote_endpoint(ec);
+        if (ec)
+        {
+            return false;
+        }
+        detail::AdmissionControl& admission =
+            detail::AdmissionControl::getInstance();
+        if (!admission.tryAdmit(peer.address()))
+        {
+            socket.close(ec);
+            return false;
+        }
+        conn->setAdmissionTicket(std::shared_ptr<void>(
+            nullptr, [address{peer.address()}](void*) {
+                detail::AdmissionControl::getInstance().release(address);
+            }));
+        return true;
+    }
+
     void doAccept()
     {
         std::optional<Adaptor> adaptorTemp;
@@ -185,12 +320,14 @@ class Server
         {
             adaptorTemp = Adaptor(*ioService, *adaptorCtx);
             auto p = std::make_shared<Connection<Adaptor, Handler>>(
-                handler, getCachedDateStr, timerQueue,
+                handler, getCachedDateStr, timerQueue, bufferPool,
                 std::move(adaptorTemp.value()));
 
             acceptor->async_accept(p->socket().next_layer(),
                                    [this, p](boost::system::error_code ec) {
-                                       if (!ec)
+                                       if (!ec && admit(p->socket()
+                                                            .next_layer(),
+                                                        p))
                                        {
                                            boost::asio::post(
                                                *this->ioService,
@@ -203,12 +340,12 @@ class Server
         {
             adaptorTemp = Adaptor(*ioService);
             auto p = std::make_shared<Connection<Adaptor, Handler>>(
-                handler, getCachedDateStr, timerQueue,
+                handler, getCachedDateStr, timerQueue, bufferPool,
                 std::move(adaptorTemp.value()));
 
             acceptor->async_accept(
                 p->socket(), [this, p](boost::system::error_code ec) {
-                    if (!ec)
+                    if (!ec && admit(p->socket(), p))
                     {
                         boost::asio::post(*this->ioService,
                                           [p] { p->start(); });
@@ -221,15 +358,21 @@ class Server
   private:
     std::shared_ptr<boost::asio::io_context> ioService;
     detail::TimerQueue timerQueue;
-    std::function<std::string()> getCachedDateStr;
+    // Per-reactor slab pool; connections never leave their reactor, so the
+    // pool needs no locking.
+    detail::BufferPool bufferPool;
+    std::function<const std::string&()> getCachedDateStr;
     std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor;
     boost::asio::signal_set signals;
     boost::asio::steady_timer timer;
 
     std::string dateStr;
 
+
     Handler* handler;
 
+    bool certificateReloadEnabled = true;
+
     std::function<void(const boost::system::error_code& ec)> timerHandler;
 
 #ifdef BMCWEB_ENABLE_SSL
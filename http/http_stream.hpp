@@ -26,6 +26,16 @@ struct Connection : std::enable_shared_from_this<Connection>
     virtual void sendStreamHeaders(const std::string& streamDataSize,
                                    const std::string& contentType) = 0;
     virtual void sendStreamErrorStatus(boost::beast::http::status status) = 0;
+    // Header variant for streams whose final size isn't known up front
+    // (negotiated compression): no Content-Length, delimited by connection
+    // close per HTTP/1.1
+    virtual void sendUnsizedStreamHeaders(const std::string& contentType,
+                                          const std::string& contentEncoding) =
+        0;
+    // 206 variant for resumed offloads carrying a Content-Range
+    virtual void sendPartialStreamHeaders(const std::string& contentRange,
+                                          const std::string& streamDataSize,
+                                          const std::string& contentType) = 0;
     virtual ~Connection() = default;
 
     boost::beast::http::request<boost::beast::http::string_body> req;
@@ -99,17 +109,55 @@ class ConnectionImpl : public Connection
                 }
             });
     }
+    void sendPartialStreamHeaders(const std::string& contentRange,
+                                  const std::string& streamDataSize,
+                                  const std::string& contentType) override
+    {
+        streamres.result(boost::beast::http::status::partial_content);
+        streamres.addHeader("Content-Range", contentRange);
+        sendStreamHeaders(streamDataSize, contentType);
+    }
+
+    void sendUnsizedStreamHeaders(const std::string& contentType,
+                                  const std::string& contentEncoding) override
+    {
+        streamres.addHeader("Content-Type", contentType);
+        streamres.addHeader("Content-Encoding", contentEncoding);
+        streamres.addHeader("Connection", "close");
+        boost::beast::http::async_write(
+            adaptor, *streamres.bufferResponse,
+            [this, self(shared_from_this())](
+                const boost::system::error_code& ec2, std::size_t) {
+                if (ec2)
+                {
+                    BMCWEB_LOG_DEBUG << "Error while writing on socket" << ec2;
+                    close();
+                    return;
+                }
+            });
+    }
+
     void sendMessage(const boost::asio::mutable_buffer& buffer,
                      std::function<void()> handler) override
     {
         if (buffer.size())
         {
             this->handlerFunc = handler;
-            auto bytes = boost::asio::buffer_copy(
-                streamres.bufferResponse->body().prepare(buffer.size()),
-                buffer);
-            streamres.bufferResponse->body().commit(bytes);
-            doWrite();
+            // Write straight from the caller's buffer - the caller keeps it
+            // alive until the completion handler runs - instead of copying
+            // every block through the dynamic body buffer first
+            boost::asio::async_write(
+                adaptor, buffer,
+                [this, self(shared_from_this())](boost::beast::error_code ec,
+                                                 std::size_t) {
+                    if (ec)
+                    {
+                        BMCWEB_LOG_DEBUG << "Error in async_write " << ec;
+                        close();
+                        return;
+                    }
+                    (handlerFunc)();
+                });
         }
     }
 
@@ -120,28 +168,10 @@ class ConnectionImpl : public Connection
         closeHandler(*this);
     }
 
-    void doWrite()
-    {
-        boost::asio::async_write(
-            adaptor, streamres.bufferResponse->body().data(),
-            [this, self(shared_from_this())](boost::beast::error_code ec,
-                                             std::size_t bytesWritten) {
-                streamres.bufferResponse->body().consume(bytesWritten);
-
-                if (ec)
-                {
-                    BMCWEB_LOG_DEBUG << "Error in async_write " << ec;
-                    close();
-                    return;
-                }
-                (handlerFunc)();
-            });
-    }
 
   private:
     Adaptor adaptor;
     boost::asio::steady_timer waitTimer;
-    bool doingWrite = false;
     std::function<void(Connection&)> openHandler;
     std::function<void(Connection&, const std::string&, bool)> messageHandler;
     std::function<void(Connection&)> closeHandler;
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <array>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 
 namespace crow
 {
@@ -19,24 +25,129 @@ enum class LogLevel
     Critical,
 };
 
-class Logger
+// Messages below this level are compiled out entirely: the level comparison
+// in the log macros folds to constant false and the Logger never constructs.
+#ifndef BMCWEB_COMPILED_LOG_LEVEL
+#define BMCWEB_COMPILED_LOG_LEVEL 0
+#endif
+constexpr LogLevel compiledLogLevel =
+    static_cast<LogLevel>(BMCWEB_COMPILED_LOG_LEVEL);
+
+// Background log sink: messages are formatted on the calling thread, then
+// handed to a bounded queue drained by one writer thread, so enabling debug
+// logging doesn't serialize every request behind a blocking cerr write (and
+// perturb the timing of whatever race is being chased).  Overflow drops the
+// oldest messages and reports the gap.
+class AsyncLogSink
 {
+  public:
+    static AsyncLogSink& getInstance()
+    {
+        static AsyncLogSink sink;
+        return sink;
+    }
+
+    void submit(std::string&& message)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (running)
+            {
+                if (queue.size() >= maxQueuedMessages)
+                {
+                    droppedMessages++;
+                    queue.pop_front();
+                }
+                queue.emplace_back(std::move(message));
+                condition.notify_one();
+                return;
+            }
+        }
+        // Sink already shut down (static teardown); degrade to synchronous
+        std::cerr << message;
+    }
+
+    AsyncLogSink(const AsyncLogSink&) = delete;
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
   private:
-    //
-    static std::string timestamp()
+    AsyncLogSink() : writer([this]() { drain(); })
+    {}
+
+    ~AsyncLogSink()
     {
-        std::string date;
-        date.resize(32, '\0');
-        time_t t = time(nullptr);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        condition.notify_one();
+        if (writer.joinable())
+        {
+            writer.join();
+        }
+        // Flush whatever was still queued
+        for (const std::string& message : queue)
+        {
+            std::cerr << message;
+        }
+    }
 
-        tm myTm{};
+    void drain()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (running)
+        {
+            condition.wait(lock,
+                           [this]() { return !queue.empty() || !running; });
+            while (!queue.empty())
+            {
+                std::string message = std::move(queue.front());
+                queue.pop_front();
+                uint64_t dropped = droppedMessages;
+                droppedMessages = 0;
+                lock.unlock();
+                if (dropped != 0)
+                {
+                    std::cerr << "... dropped " << dropped
+                              << " log messages\n";
+                }
+                std::cerr << message;
+                lock.lock();
+            }
+        }
+    }
 
-        gmtime_r(&t, &myTm);
+    static constexpr size_t maxQueuedMessages = 4096;
+    std::deque<std::string> queue;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool running = true;
+    uint64_t droppedMessages = 0;
+    std::thread writer;
+};
 
-        size_t sz =
-            strftime(date.data(), date.size(), "%Y-%m-%d %H:%M:%S", &myTm);
-        date.resize(sz);
-        return date;
+class Logger
+{
+  private:
+    //
+    // Formatted once per second per thread into a fixed buffer; log lines
+    // within the same second reuse it with no clock formatting or
+    // allocation.  thread_local keeps reactor threads from sharing.
+    static std::string_view timestamp()
+    {
+        static thread_local time_t lastT = 0;
+        static thread_local std::array<char, 32> buffer{};
+        static thread_local size_t length = 0;
+        time_t t = time(nullptr);
+        if (t != lastT)
+        {
+            lastT = t;
+            tm myTm{};
+            gmtime_r(&t, &myTm);
+            length = strftime(buffer.data(), buffer.size(),
+                              "%Y-%m-%d %H:%M:%S", &myTm);
+        }
+        return std::string_view(buffer.data(), length);
     }
 
   public:
@@ -53,8 +164,8 @@ class Logger
     {
         if (level >= getCurrentLogLevel())
         {
-            stringstream << std::endl;
-            std::cerr << stringstream.str();
+            stringstream << '\n';
+            AsyncLogSink::getInstance().submit(stringstream.str());
         }
     }
 
@@ -95,17 +206,22 @@ class Logger
 } // namespace crow
 
 #define BMCWEB_LOG_CRITICAL                                                    \
-    if (crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Critical)        \
+    if (crow::LogLevel::Critical >= crow::compiledLogLevel &&                 \
+        crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Critical)        \
     crow::Logger("CRITICAL", __FILE__, __LINE__, crow::LogLevel::Critical)
 #define BMCWEB_LOG_ERROR                                                       \
-    if (crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Error)           \
+    if (crow::LogLevel::Error >= crow::compiledLogLevel &&                 \
+        crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Error)           \
     crow::Logger("ERROR", __FILE__, __LINE__, crow::LogLevel::Error)
 #define BMCWEB_LOG_WARNING                                                     \
-    if (crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Warning)         \
+    if (crow::LogLevel::Warning >= crow::compiledLogLevel &&                 \
+        crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Warning)         \
     crow::Logger("WARNING", __FILE__, __LINE__, crow::LogLevel::Warning)
 #define BMCWEB_LOG_INFO                                                        \
-    if (crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Info)            \
+    if (crow::LogLevel::Info >= crow::compiledLogLevel &&                 \
+        crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Info)            \
     crow::Logger("INFO", __FILE__, __LINE__, crow::LogLevel::Info)
 #define BMCWEB_LOG_DEBUG                                                       \
-    if (crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Debug)           \
+    if (crow::LogLevel::Debug >= crow::compiledLogLevel &&                 \
+        crow::Logger::getCurrentLogLevel() <= crow::LogLevel::Debug)           \
     crow::Logger("DEBUG", __FILE__, __LINE__, crow::LogLevel::Debug)
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace crow
+{
+namespace metrics
+{
+
+// Preaggregated, fixed-size request instrumentation.  Recording on the hot
+// path is a couple of relaxed atomic increments into power-of-two
+// microsecond latency buckets; scraping serializes straight from the arrays
+// with no allocation beyond the output string, so fleet monitoring can poll
+// at 1Hz without disturbing the thing it measures.
+struct RequestMetrics
+{
+    static RequestMetrics& getInstance()
+    {
+        static RequestMetrics metrics;
+        return metrics;
+    }
+
+    static constexpr size_t bucketCount = 32;
+
+    void recordRequest(uint64_t latencyUs, uint64_t bytesOut)
+    {
+        size_t bucket = 0;
+        uint64_t value = latencyUs;
+        while (value > 0 && bucket < bucketCount - 1)
+        {
+            value >>= 1;
+            bucket++;
+        }
+        latencyBuckets[bucket]++;
+        requestCount++;
+        responseBytes += bytesOut;
+    }
+
+    std::string serialize() const
+    {
+        std::string out;
+        out.reserve(2048);
+        out += "bmcweb_requests_total ";
+        out += std::to_string(requestCount.load());
+        out += "\nbmcweb_response_bytes_total ";
+        out += std::to_string(responseBytes.load());
+        out += "\nbmcweb_requests_in_flight ";
+        out += std::to_string(inFlight.load());
+        out += "\nbmcweb_dbus_calls_total ";
+        out += std::to_string(dbusCalls.load());
+        out += "\nbmcweb_loop_lag_samples_total ";
+        out += std::to_string(loopLagSamples.load());
+        out += "\nbmcweb_loop_lag_max_us ";
+        out += std::to_string(loopLagMaxUs.load());
+        out += "\nbmcweb_loop_lag_over_threshold_total ";
+        out += std::to_string(loopLagOverThreshold.load());
+        out += '\n';
+        {
+            std::lock_guard<std::mutex> lock(blockingMutex);
+            for (const auto& [route, stats] : blockingRoutes)
+            {
+                out += "bmcweb_loop_blocking_worst_us{route=\"";
+                out += route;
+                out += "\"} ";
+                out += std::to_string(stats.worstUs);
+                out += "\nbmcweb_loop_blocking_total{route=\"";
+                out += route;
+                out += "\"} ";
+                out += std::to_string(stats.count);
+                out += '\n';
+            }
+        }
+        uint64_t cumulative = 0;
+        for (size_t bucket = 0; bucket < bucketCount; bucket++)
+        {
+            cumulative += latencyBuckets[bucket].load();
+            out += "bmcweb_request_latency_us_bucket{le=\"";
+            if (bucket == bucketCount - 1)
+            {
+                out += "+Inf";
+            }
+            else
+            {
+                out += std::to_string(uint64_t(1) << bucket);
+            }
+            out += "\"} ";
+            out += std::to_string(cumulative);
+            out += '\n';
+        }
+        return out;
+    }
+
+    // Event-loop health: lag probes measure post-to-execution latency on
+    // the io_context; any handler that holds the loop past the blame
+    // threshold is recorded by route so loop-blocking regressions name
+    // their offender instead of showing up as fleet-wide stutter.
+    static constexpr uint64_t blameThresholdUs = 50 * 1000;
+    static constexpr size_t maxBlamedRoutes = 32;
+
+    struct BlockingStats
+    {
+        uint64_t worstUs = 0;
+        uint64_t count = 0;
+    };
+
+    void recordLoopLag(uint64_t lagUs)
+    {
+        loopLagSamples++;
+        uint64_t prev = loopLagMaxUs.load(std::memory_order_relaxed);
+        while (lagUs > prev &&
+               !loopLagMaxUs.compare_exchange_weak(prev, lagUs))
+        {}
+        if (lagUs > blameThresholdUs)
+        {
+            loopLagOverThreshold++;
+        }
+    }
+
+    // Called with the synchronous on-CPU time a route's dispatch (or its
+    // response serialization) held the event loop
+    void recordBlocking(std::string_view route, uint64_t heldUs)
+    {
+        if (heldUs < blameThresholdUs)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(blockingMutex);
+        auto it = blockingRoutes.find(std::string(route));
+        if (it == blockingRoutes.end())
+        {
+            if (blockingRoutes.size() >= maxBlamedRoutes)
+            {
+                return;
+            }
+            it = blockingRoutes.emplace(std::string(route), BlockingStats{})
+                     .first;
+        }
+        it->second.count++;
+        if (heldUs > it->second.worstUs)
+        {
+            it->second.worstUs = heldUs;
+        }
+    }
+
+    std::array<std::atomic<uint64_t>, bucketCount> latencyBuckets{};
+    std::atomic<uint64_t> requestCount{0};
+    std::atomic<uint64_t> responseBytes{0};
+    std::atomic<int64_t> inFlight{0};
+    std::atomic<uint64_t> dbusCalls{0};
+    std::atomic<uint64_t> loopLagSamples{0};
+    std::atomic<uint64_t> loopLagMaxUs{0};
+    std::atomic<uint64_t> loopLagOverThreshold{0};
+    std::unordered_map<std::string, BlockingStats> blockingRoutes;
+    std::mutex blockingMutex;
+};
+
+} // namespace metrics
+} // namespace crow
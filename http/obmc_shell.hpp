@@ -6,6 +6,7 @@
 
 #include <app.hpp>
 #include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/process/io.hpp>
 #include <websocket.hpp>
 
@@ -22,7 +23,7 @@ class Handler : public std::enable_shared_from_this<Handler>
   public:
     Handler(crow::websocket::Connection* conn) :
         session(conn), streamFileDescriptor(conn->getIoContext()),
-        doingWrite(false)
+        flushTimer(conn->getIoContext()), doingWrite(false)
     {}
 
     ~Handler() = default;
@@ -160,6 +161,12 @@ class Handler : public std::enable_shared_from_this<Handler>
             BMCWEB_LOG_DEBUG << "session is closed";
             return;
         }
+        if (pendingOutput.size() >= maxPendingOutput)
+        {
+            // Stop draining the PTY until the websocket side flushes
+            readPaused = true;
+            return;
+        }
         streamFileDescriptor.async_read_some(
             boost::asio::buffer(outputBuffer.data(), outputBuffer.size()),
             [this, self(shared_from_this())](
@@ -177,23 +184,74 @@ class Handler : public std::enable_shared_from_this<Handler>
                     session->close("Error in connecting to ssh port");
                     return;
                 }
-                std::string_view payload(outputBuffer.data(), bytesRead);
-                session->sendBinary(payload);
+                pendingOutput.append(outputBuffer.data(), bytesRead);
+                scheduleFlush();
                 doRead();
             });
     }
 
+    // Coalesces PTY output into batched frames: a flush happens at the size
+    // threshold or after a few milliseconds, and when the pending buffer
+    // hits its cap the PTY reads pause - the kernel PTY buffer then blocks
+    // the shell itself, which is real flow control for runaway output like
+    // a cat of a large file.
+    void scheduleFlush()
+    {
+        if (pendingOutput.size() >= flushSizeThreshold)
+        {
+            flushOutput();
+            return;
+        }
+        if (flushScheduled)
+        {
+            return;
+        }
+        flushScheduled = true;
+        flushTimer.expires_after(std::chrono::milliseconds(5));
+        flushTimer.async_wait([this, self(shared_from_this())](
+                                  const boost::system::error_code& ec) {
+            flushScheduled = false;
+            if (ec)
+            {
+                return;
+            }
+            flushOutput();
+        });
+    }
+
+    void flushOutput()
+    {
+        if (session == nullptr || pendingOutput.empty())
+        {
+            return;
+        }
+        session->sendBinary(pendingOutput);
+        pendingOutput.clear();
+        if (readPaused)
+        {
+            readPaused = false;
+            doRead();
+        }
+    }
+
     // this has to public
     std::string inputBuffer;
 
   private:
     crow::websocket::Connection* session;
     boost::asio::posix::stream_descriptor streamFileDescriptor;
+    boost::asio::steady_timer flushTimer;
     bool doingWrite;
     int ttyFileDescriptor;
     pid_t pid;
 
     std::array<char, 4096> outputBuffer;
+
+    static constexpr size_t flushSizeThreshold = 4096;
+    static constexpr size_t maxPendingOutput = 256 * 1024;
+    std::string pendingOutput;
+    bool flushScheduled = false;
+    bool readPaused = false;
 };
 
 static std::map<crow::websocket::Connection*, std::shared_ptr<Handler>>
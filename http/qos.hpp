@@ -0,0 +1,104 @@
+#pragma once
+
+#include "logging.hpp"
+#include "runtime_config.hpp"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace crow
+{
+namespace qos
+{
+
+// Two-tier request scheduler at the router dispatch point.  Interactive
+// traffic (anything that isn't a GET - power actions, PATCHes, session
+// creation) always dispatches immediately; bulk reads run under a
+// concurrency cap, with arrivals beyond it parked in FIFO order and a
+// bounded queue shedding the excess with 503.  During a telemetry storm
+// the scrapers saturate their lane and queue behind each other while an
+// operator's power-off action goes straight through, so worst-case action
+// latency stays bounded by in-flight work, not queue depth.
+class RequestScheduler
+{
+  public:
+    static RequestScheduler& getInstance()
+    {
+        static RequestScheduler scheduler;
+        return scheduler;
+    }
+
+    enum class Decision
+    {
+        dispatchNow,
+        parked,
+        shed
+    };
+
+    // Concurrency and queue depth come from RuntimeTuning (defaults 8 and
+    // 64): generous for real UIs, binding for scrapers, tunable per site
+
+    // dispatch must be safe to invoke from any thread; parked entries
+    // post themselves back to their own connection's executor
+    Decision admitBulk(std::function<void()>&& dispatch)
+    {
+        uint64_t concurrency =
+            crow::runtime_config::RuntimeTuning::getInstance()
+                .bulkConcurrencyLimit.load(std::memory_order_relaxed);
+        uint64_t queueLimit =
+            crow::runtime_config::RuntimeTuning::getInstance()
+                .bulkQueueLimit.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (bulkInFlight < concurrency)
+        {
+            bulkInFlight++;
+            return Decision::dispatchNow;
+        }
+        if (parkedDispatches.size() >= queueLimit)
+        {
+            shedCount++;
+            return Decision::shed;
+        }
+        parkedDispatches.push_back(std::move(dispatch));
+        return Decision::parked;
+    }
+
+    // Called once per completed bulk request; hands the freed slot to the
+    // oldest parked dispatch if one is waiting
+    void releaseBulk()
+    {
+        std::function<void()> next;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (parkedDispatches.empty())
+            {
+                if (bulkInFlight > 0)
+                {
+                    bulkInFlight--;
+                }
+                return;
+            }
+            next = std::move(parkedDispatches.front());
+            parkedDispatches.pop_front();
+            // The slot transfers to the parked request
+        }
+        next();
+    }
+
+    uint64_t getShedCount() const
+    {
+        return shedCount;
+    }
+
+  private:
+    RequestScheduler() = default;
+
+    std::deque<std::function<void()>> parkedDispatches;
+    size_t bulkInFlight = 0;
+    uint64_t shedCount = 0;
+    std::mutex mutex;
+};
+
+} // namespace qos
+} // namespace crow
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include "logging.hpp"
+#include "runtime_config.hpp"
+
+#include <boost/asio/ip/address.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace crow
+{
+namespace rate_limit
+{
+
+// Token-bucket throttling keyed by session (and by bare client IP for
+// unauthenticated traffic), enforced right after authentication.  Each key
+// refills at the configured sustained rate up to the burst ceiling; a
+// buggy client retry-looping on an error burns its burst in a moment and
+// then holds at the sustained rate with 429s, which costs this process a
+// map lookup instead of a D-Bus fan-out per retry.  Loopback is exempt so
+// on-box tooling and the operator console never throttle.  A rate of 0
+// disables the limiter entirely.
+class RateLimiter
+{
+  public:
+    static RateLimiter& getInstance()
+    {
+        static RateLimiter limiter;
+        return limiter;
+    }
+
+    // True when the request may proceed
+    bool admit(const std::string& sessionId,
+               const boost::asio::ip::address& ip)
+    {
+        uint64_t rps = crow::runtime_config::RuntimeTuning::getInstance()
+                           .rateLimitRequestsPerSecond.load(
+                               std::memory_order_relaxed);
+        uint64_t burst = crow::runtime_config::RuntimeTuning::getInstance()
+                             .rateLimitBurst.load(std::memory_order_relaxed);
+        if (rps == 0)
+        {
+            return true;
+        }
+        if (ip.is_loopback() || ip.is_unspecified())
+        {
+            return true;
+        }
+        std::string key;
+        if (!sessionId.empty())
+        {
+            key = sessionId;
+        }
+        else
+        {
+            key = ip.to_string();
+        }
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex);
+        pruneIfCrowded(now);
+        Bucket& bucket = buckets[key];
+        if (bucket.last.time_since_epoch().count() == 0)
+        {
+            bucket.tokens = static_cast<double>(burst);
+        }
+        else
+        {
+            double elapsed =
+                std::chrono::duration<double>(now - bucket.last).count();
+            bucket.tokens = std::min(
+                static_cast<double>(burst),
+                bucket.tokens + elapsed * static_cast<double>(rps));
+        }
+        bucket.last = now;
+        if (bucket.tokens >= 1.0)
+        {
+            bucket.tokens -= 1.0;
+            return true;
+        }
+        rejectedCount++;
+        return false;
+    }
+
+    uint64_t getRejectedCount() const
+    {
+        return rejectedCount;
+    }
+
+  private:
+    RateLimiter() = default;
+
+    struct Bucket
+    {
+        double tokens = 0.0;
+        std::chrono::time_point<std::chrono::steady_clock> last;
+    };
+
+    // Callers must hold the mutex.  Idle buckets refill to burst and stop
+    // mattering; drop them once the table grows past a bound so a scan of
+    // spoofed source addresses can't grow it forever.
+    void pruneIfCrowded(std::chrono::time_point<std::chrono::steady_clock> now)
+    {
+        if (buckets.size() < maxBuckets)
+        {
+            return;
+        }
+        for (auto it = buckets.begin(); it != buckets.end();)
+        {
+            if (now - it->second.last > std::chrono::minutes(5))
+            {
+                it = buckets.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    static constexpr size_t maxBuckets = 1024;
+
+    std::unordered_map<std::string, Bucket> buckets;
+    std::mutex mutex;
+    uint64_t rejectedCount = 0;
+};
+
+} // namespace rate_limit
+} // namespace crow
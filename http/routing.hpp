@@ -12,16 +12,24 @@
 #include "websocket.hpp"
 
 #include <async_resp.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -55,6 +63,14 @@ class BaseRule
         res.result(boost::beast::http::status::not_found);
         res.end();
     }
+    // Upgrades over the AF_UNIX listener aren't supported; in-band agents
+    // use plain Redfish requests
+    virtual void handleUpgrade(const Request&, Response& res,
+                               boost::asio::local::stream_protocol::socket&&)
+    {
+        res.result(boost::beast::http::status::not_found);
+        res.end();
+    }
 #ifdef BMCWEB_ENABLE_SSL
     virtual void
         handleUpgrade(const Request&, Response& res,
@@ -79,6 +95,16 @@ class BaseRule
             return true;
         }
 
+        // Nearly every rule carries exactly one required privilege set,
+        // precomputed into a mask at registration: one AND decides it.
+        if (privilegesSet.size() == 1)
+        {
+            return (userPrivileges.mask() & requiredPrivilegeMask) ==
+                   requiredPrivilegeMask;
+        }
+
+        // Rules with alternative privilege sets (OR semantics) can't
+        // collapse to a single mask; keep the set walk for those.
         for (const redfish::Privileges& requiredPrivileges : privilegesSet)
         {
             if (userPrivileges.isSupersetOf(requiredPrivileges))
@@ -89,9 +115,31 @@ class BaseRule
         return false;
     }
 
+    void updatePrivilegeMask()
+    {
+        if (privilegesSet.size() == 1)
+        {
+            requiredPrivilegeMask = privilegesSet[0].mask();
+        }
+    }
+
     size_t methodsBitfield{
         1 << static_cast<size_t>(boost::beast::http::verb::get)};
 
+    bool isImmutable = false;
+
+    // Identical in-flight GETs on this route share one execution
+    bool coalesceGet = false;
+
+    // Route opted out of response compression (pre-compressed or
+    // incompressible payloads)
+    bool compressionDisabled = false;
+
+    // 0 means the global limit applies
+    size_t bodyLimitBytes = 0;
+
+    uint64_t requiredPrivilegeMask = 0;
+
     std::vector<redfish::Privileges> privilegesSet;
 
     std::string rule;
@@ -124,6 +172,22 @@ struct CallParams
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp;
 };
 
+// Returns string parameters as references into RoutingParams instead of the
+// by-value get<std::string>, so typical routes dispatch without copying the
+// decoded segment; numeric parameters stay by value.
+template <typename T>
+decltype(auto) getParam(const RoutingParams& params, unsigned pos)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        return (params.stringParams[pos]);
+    }
+    else
+    {
+        return params.template get<T>(pos);
+    }
+}
+
 template <typename F, int NInt, int NUint, int NDouble, int NString,
           typename S1, typename S2>
 struct Call
@@ -194,7 +258,7 @@ struct Call<F, NInt, NUint, NDouble, NString, black_magic::S<>,
     {
         cparams.handler(
             cparams.req, cparams.asyncResp,
-            cparams.params.template get<typename Args1::type>(Args1::pos)...);
+            getParam<typename Args1::type>(cparams.params, Args1::pos)...);
     }
 };
 
@@ -342,7 +406,8 @@ class WebSocketRule : public BaseRule
             myConnection = std::make_shared<
                 crow::websocket::ConnectionImpl<boost::asio::ip::tcp::socket>>(
                 req, std::move(adaptor), openHandler, messageHandler,
-                closeHandler, errorHandler);
+                binaryMessageHandler, closeHandler, errorHandler,
+                deflateEnabled, idleTimeoutSeconds);
         myConnection->start();
     }
 #ifdef BMCWEB_ENABLE_SSL
@@ -355,7 +420,8 @@ class WebSocketRule : public BaseRule
             myConnection = std::make_shared<crow::websocket::ConnectionImpl<
                 boost::beast::ssl_stream<boost::asio::ip::tcp::socket>>>(
                 req, std::move(adaptor), openHandler, messageHandler,
-                closeHandler, errorHandler);
+                binaryMessageHandler, closeHandler, errorHandler,
+                deflateEnabled, idleTimeoutSeconds);
         myConnection->start();
     }
 #endif
@@ -374,6 +440,34 @@ class WebSocketRule : public BaseRule
         return *this;
     }
 
+    // Binary-only routes take each frame by move instead of through the
+    // shared string path; text frames on such routes still go to onmessage.
+    template <typename Func>
+    self_t& onmessagebinary(Func f)
+    {
+        binaryMessageHandler = f;
+        return *this;
+    }
+
+    // Negotiates RFC 7692 permessage-deflate with clients that offer it;
+    // meant for text-heavy routes crossing slow management links
+    self_t& permessageDeflate()
+    {
+        deflateEnabled = true;
+        return *this;
+    }
+
+    // Per-route idle lifecycle: beast pings at half this interval and
+    // closes the stream when a peer neither answers nor sends for the
+    // full interval, so a NAT-dropped client frees its session, buffers
+    // and backend socket in seconds instead of when TCP gives up.  0
+    // keeps the transport-default behavior.
+    self_t& idleTimeout(uint16_t seconds)
+    {
+        idleTimeoutSeconds = seconds;
+        return *this;
+    }
+
     template <typename Func>
     self_t& onclose(Func f)
     {
@@ -394,6 +488,10 @@ class WebSocketRule : public BaseRule
         openHandler;
     std::function<void(crow::websocket::Connection&, const std::string&, bool)>
         messageHandler;
+    std::function<void(crow::websocket::Connection&, std::string&&)>
+        binaryMessageHandler;
+    bool deflateEnabled = false;
+    uint16_t idleTimeoutSeconds = 0;
     std::function<void(crow::websocket::Connection&, const std::string&)>
         closeHandler;
     std::function<void(crow::websocket::Connection&)> errorHandler;
@@ -532,6 +630,52 @@ struct RuleParameterTraits
         return *self;
     }
 
+    // Marks a route whose response is byte-identical for the life of the
+    // firmware image.  The router snapshots the first finished response and
+    // answers later GETs straight from the cache, skipping the handler.
+    // Only privilege-free routes are eligible; the cached copy is served
+    // before any privilege evaluation happens.
+    self_t& immutable()
+    {
+        self_t* self = static_cast<self_t*>(this);
+        self->isImmutable = true;
+        return *self;
+    }
+
+    // Declares that this route's responses aren't worth compressing
+    // (already compressed, binary, or latency-critical); the size
+    // threshold already exempts tiny payloads everywhere, so this is for
+    // shape, not size.
+    self_t& noCompression()
+    {
+        self_t* self = static_cast<self_t*>(this);
+        self->compressionDisabled = true;
+        return *self;
+    }
+
+    // Opt-in for read-only routes whose concurrent identical GETs can
+    // share one execution: a request arriving while the same user's GET of
+    // the same target is already running attaches to it and receives a
+    // copy of the single response, so a client stampede costs one D-Bus
+    // fan-out instead of one per client.  Only suitable for routes that
+    // produce plain JSON responses.
+    self_t& coalesceInFlightGets()
+    {
+        self_t* self = static_cast<self_t*>(this);
+        self->coalesceGet = true;
+        return *self;
+    }
+
+    // Declares this route's request body limit, enforced at header-parse
+    // time.  Routes without one fall back to the global limit sized for
+    // firmware uploads.
+    self_t& bodyLimit(size_t bytes)
+    {
+        self_t* self = static_cast<self_t*>(this);
+        self->bodyLimitBytes = bytes;
+        return *self;
+    }
+
     self_t& privileges(
         const std::initializer_list<std::initializer_list<const char*>>& p)
     {
@@ -540,6 +684,7 @@ struct RuleParameterTraits
         {
             self->privilegesSet.emplace_back(privilege);
         }
+        self->updatePrivilegeMask();
         return *self;
     }
 
@@ -551,6 +696,7 @@ struct RuleParameterTraits
         {
             self->privilegesSet.emplace_back(privilege);
         }
+        self->updatePrivilegeMask();
         return *self;
     }
 };
@@ -834,6 +980,7 @@ class Trie
     void validate()
     {
         optimize();
+        freezeLiteralRoutes();
     }
 
     void findRouteIndexes(const std::string& reqUrl,
@@ -885,6 +1032,13 @@ class Trie
         if (node == nullptr)
         {
             node = head();
+            // Fast path: exact-match URLs registered with a literal pattern
+            // resolve through the frozen table without walking the nodes.
+            auto literal = literalRoutes.find(reqUrl);
+            if (literal != literalRoutes.end())
+            {
+                return literal->second;
+            }
         }
         if (pos == reqUrl.size())
         {
@@ -1081,6 +1235,11 @@ class Trie
             throw std::runtime_error("handler already exists for " + url);
         }
         nodes[idx].ruleIndex = ruleIndex;
+
+        if (url.find('<') == std::string::npos)
+        {
+            literalUrls.emplace_back(url);
+        }
     }
 
   private:
@@ -1149,7 +1308,36 @@ class Trie
         return static_cast<unsigned>(nodes.size() - 1);
     }
 
+    // All route patterns come in through the BMCWEB_ROUTE macro as literals,
+    // so every parameter-free pattern can be frozen into a flat hash table
+    // once registration is done.  Each entry caches the full find() result so
+    // the fast path cannot disagree with the node walk about which rule wins
+    // when a parameterized pattern also covers the same URL.
+    void freezeLiteralRoutes()
+    {
+        literalRoutes.reserve(literalUrls.size());
+        for (const std::string& url : literalUrls)
+        {
+            literalRoutes.emplace(url, find(url));
+        }
+        literalUrls.clear();
+        literalUrls.shrink_to_fit();
+    }
+
+    struct TransparentHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view url) const
+        {
+            return std::hash<std::string_view>{}(url);
+        }
+    };
+
     std::vector<Node> nodes;
+    std::vector<std::string> literalUrls;
+    std::unordered_map<std::string, std::pair<unsigned, RoutingParams>,
+                       TransparentHash, std::equal_to<>>
+        literalRoutes;
 };
 
 class Router
@@ -1400,6 +1588,315 @@ class Router
                          << static_cast<uint32_t>(req.method()) << " / "
                          << rules[ruleIndex]->getMethods();
 
+        // Immutable, privilege-free routes are answered from the response
+        // cache once the first hit has populated it; the handler (and any
+        // D-Bus fan-out it would do) is skipped entirely.
+        if (rules[ruleIndex]->isImmutable &&
+            rules[ruleIndex]->privilegesSet.empty() &&
+            req.method() == boost::beast::http::verb::get &&
+            req.urlParams.begin() == req.urlParams.end())
+        {
+            std::lock_guard<std::mutex> lock(immutableCacheMutex);
+            auto cacheHit = immutableCache.find(std::string(req.url));
+            if (cacheHit != immutableCache.end())
+            {
+                BMCWEB_LOG_DEBUG << "Serving " << req.url
+                                 << " from immutable response cache";
+                asyncResp->res.result(cacheHit->second.status);
+                if (!cacheHit->second.contentType.empty())
+                {
+                    asyncResp->res.addHeader("Content-Type",
+                                             cacheHit->second.contentType);
+                }
+                asyncResp->res.body() = cacheHit->second.body;
+                asyncResp->res.jsonValue = cacheHit->second.jsonValue;
+                return;
+            }
+            // First hit: chain in front of the connection's completion
+            // handler and snapshot the finished response.  Capture the
+            // Response by reference rather than the AsyncResp, which would
+            // keep its own completion from ever firing.
+            crow::Response& res = asyncResp->res;
+            asyncResp->res.setCompleteRequestHandler(
+                [this, key = std::string(req.url), &res,
+                 inner{res.releaseCompleteRequestHandler()}]() {
+                    if (res.resultInt() == 200)
+                    {
+                        std::lock_guard<std::mutex> lock(immutableCacheMutex);
+                        ImmutableCacheEntry& entry = immutableCache[key];
+                        entry.status = res.result();
+                        entry.contentType = std::string(
+                            res.stringResponse
+                                ->base()[boost::beast::http::field::
+                                             content_type]);
+                        entry.body = res.body();
+                        entry.jsonValue = res.jsonValue;
+                    }
+                    if (inner)
+                    {
+                        inner();
+                    }
+                });
+        }
+
+        // Long-poll stage, registered first so it runs last, after the
+        // query-parameter stages have shaped the response.  A GET carrying
+        // ?wait=<seconds> plus If-None-Match parks when the rendered
+        // response still matches the client's ETag: the handler re-runs on
+        // a 1-second cadence (cheap against the signal-driven caches)
+        // until the payload differs or the deadline passes, which answers
+        // 304.  Near-instant change visibility at a fraction of the
+        // request volume, with ordinary GET semantics when anything
+        // changed.
+        if (req.method() == boost::beast::http::verb::get &&
+            req.urlParams.find("wait") != req.urlParams.end() &&
+            !req.getHeaderValue(boost::beast::http::field::if_none_match)
+                 .empty())
+        {
+            crow::Response& res = asyncResp->res;
+            {
+                std::lock_guard<std::mutex> lock(longPollsMutex);
+                if (longPolls.find(&res) == longPolls.end())
+                {
+                    std::string waitValue = req.urlParams.find("wait")->value();
+                    uint64_t waitSeconds =
+                        std::strtoul(waitValue.c_str(), nullptr, 10);
+                    waitSeconds = std::clamp<uint64_t>(waitSeconds, 1, 60);
+                    LongPollState& state = longPolls[&res];
+                    state.deadline = std::chrono::steady_clock::now() +
+                                     std::chrono::seconds(waitSeconds);
+                    state.etag = std::string(req.getHeaderValue(
+                        boost::beast::http::field::if_none_match));
+                }
+            }
+            res.setCompleteRequestHandler(
+                [this, &req, &res,
+                 inner{res.releaseCompleteRequestHandler()}]() {
+                    LongPollState state;
+                    {
+                        std::lock_guard<std::mutex> lock(longPollsMutex);
+                        auto it = longPolls.find(&res);
+                        if (it == longPolls.end())
+                        {
+                            if (inner)
+                            {
+                                inner();
+                            }
+                            return;
+                        }
+                        state = it->second;
+                    }
+                    std::string etag = Response::computeEtag(
+                        res.jsonValue.empty()
+                            ? std::string_view(res.body())
+                            : std::string_view(res.jsonValue.dump(
+                                  2, ' ', true,
+                                  nlohmann::json::error_handler_t::replace)));
+                    if (res.resultInt() != 200 || etag.empty() ||
+                        etag != state.etag)
+                    {
+                        // Changed (or errored): answer now
+                        std::lock_guard<std::mutex> lock(longPollsMutex);
+                        longPolls.erase(&res);
+                        if (inner)
+                        {
+                            inner();
+                        }
+                        return;
+                    }
+                    if (std::chrono::steady_clock::now() >= state.deadline)
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(longPollsMutex);
+                            longPolls.erase(&res);
+                        }
+                        res.result(
+                            boost::beast::http::status::not_modified);
+                        res.jsonValue = nlohmann::json();
+                        res.body().clear();
+                        if (inner)
+                        {
+                            inner();
+                        }
+                        return;
+                    }
+                    // A client that disconnected while parked must not
+                    // keep driving handler re-runs for the rest of its
+                    // wait window; finish through the connection's own
+                    // completion handler, which knows the socket is dead
+                    if (!res.isAlive())
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(longPollsMutex);
+                            longPolls.erase(&res);
+                        }
+                        if (inner)
+                        {
+                            inner();
+                        }
+                        return;
+                    }
+                    // Still unchanged and time remains: retry shortly.  The
+                    // captured inner handler keeps the connection alive
+                    // while parked.
+                    // On the primary io_context: the re-run enters the
+                    // router (and D-Bus) again, which must not happen from
+                    // a reactor thread
+                    auto timer = std::make_shared<boost::asio::steady_timer>(
+                        crow::connections::systemBus->get_io_context());
+                    timer->expires_after(std::chrono::seconds(1));
+                    timer->async_wait([this, &req, &res, timer,
+                                       inner](const boost::system::error_code&
+                                                  timerEc) {
+                        if (timerEc || !res.isAlive())
+                        {
+                            // Shutdown or the client went away mid-park:
+                            // stop re-running and hand the connection its
+                            // completion handler instead of dropping it
+                            {
+                                std::lock_guard<std::mutex> lock(
+                                    longPollsMutex);
+                                longPolls.erase(&res);
+                            }
+                            if (inner)
+                            {
+                                inner();
+                            }
+                            return;
+                        }
+                        // Full reset so the re-run starts from a pristine
+                        // response (headers included); completion and
+                        // liveness plumbing are re-established below and by
+                        // the connection's existing helpers
+                        res.clear();
+                        res.setCompleteRequestHandler(std::function<void()>(
+                            inner));
+                        auto retry = std::make_shared<bmcweb::AsyncResp>(res);
+                        this->handle(req, retry);
+                    });
+                });
+        }
+
+        // In-flight GET coalescing for routes that opted in.  The first
+        // request becomes the leader; identical (user, target) GETs that
+        // arrive while it runs are parked, and the leader's completion -
+        // running after the query-parameter stages below, since handlers
+        // fire in reverse registration order - copies its finished response
+        // to every waiter.  Waiters then complete through their own
+        // connections' handlers as their AsyncResp references drop.
+        if (rules[ruleIndex]->coalesceGet &&
+            req.method() == boost::beast::http::verb::get &&
+            req.session != nullptr)
+        {
+            std::string key = req.session->username + '\x01' +
+                              std::string(req.target());
+            std::lock_guard<std::mutex> lock(inFlightGetsMutex);
+            auto [it, inserted] = inFlightGets.try_emplace(std::move(key));
+            if (!inserted)
+            {
+                BMCWEB_LOG_DEBUG << "Coalescing GET " << req.target()
+                                 << " onto in-flight request";
+                it->second.push_back(asyncResp);
+                return;
+            }
+            crow::Response& res = asyncResp->res;
+            res.setCompleteRequestHandler(
+                [this, key{it->first}, &res,
+                 inner{res.releaseCompleteRequestHandler()}]() {
+                    std::vector<std::shared_ptr<bmcweb::AsyncResp>> waiters;
+                    {
+                        std::lock_guard<std::mutex> lock(inFlightGetsMutex);
+                        auto found = inFlightGets.find(key);
+                        if (found != inFlightGets.end())
+                        {
+                            waiters = std::move(found->second);
+                            inFlightGets.erase(found);
+                        }
+                    }
+                    for (const std::shared_ptr<bmcweb::AsyncResp>& waiter :
+                         waiters)
+                    {
+                        waiter->res.result(res.result());
+                        std::string_view contentType =
+                            res.stringResponse->base()
+                                [boost::beast::http::field::content_type];
+                        if (!contentType.empty())
+                        {
+                            waiter->res.addHeader("Content-Type", contentType);
+                        }
+                        waiter->res.body() = res.body();
+                        waiter->res.jsonValue = res.jsonValue;
+                    }
+                    if (inner)
+                    {
+                        inner();
+                    }
+                });
+        }
+
+        // Query-parameter stages.  Completion handlers run in reverse
+        // registration order, so registering select, then $expand, then
+        // paging yields: slice Members -> expand the surviving stubs ->
+        // filter selected properties -> hand off to the connection.
+        if (req.method() == boost::beast::http::verb::get)
+        {
+            crow::Response& res = asyncResp->res;
+
+            auto selectIt = req.urlParams.find("$select");
+            if (selectIt != req.urlParams.end())
+            {
+                std::string selectValue = selectIt->value();
+                std::vector<std::string> properties;
+                boost::split(properties, selectValue, boost::is_any_of(","));
+                res.setCompleteRequestHandler(
+                    [&res, properties{std::move(properties)},
+                     inner{res.releaseCompleteRequestHandler()}]() {
+                        applySelect(res, properties);
+                        if (inner)
+                        {
+                            inner();
+                        }
+                    });
+            }
+
+            auto expandIt = req.urlParams.find("$expand");
+            if (expandIt != req.urlParams.end())
+            {
+                std::string expandValue = expandIt->value();
+                if (!expandValue.empty() &&
+                    (expandValue[0] == '.' || expandValue[0] == '*'))
+                {
+                    res.setCompleteRequestHandler(
+                        [this, &req, &res,
+                         inner{res.releaseCompleteRequestHandler()}]() mutable {
+                            expandMembers(req, res, std::move(inner));
+                        });
+                }
+            }
+
+            uint64_t top = 0;
+            uint64_t skip = 0;
+            bool topPresent = false;
+            bool skipPresent = false;
+            if (!parsePagingParam(req, asyncResp, "$top", top, topPresent) ||
+                !parsePagingParam(req, asyncResp, "$skip", skip, skipPresent))
+            {
+                return;
+            }
+            if (topPresent || skipPresent)
+            {
+                res.setCompleteRequestHandler(
+                    [&res, url{std::string(req.url)}, top, skip, topPresent,
+                     inner{res.releaseCompleteRequestHandler()}]() {
+                        applyPaging(res, url, top, skip, topPresent);
+                        if (inner)
+                        {
+                            inner();
+                        }
+                    });
+            }
+        }
+
         if (req.session == nullptr)
         {
             rules[ruleIndex]->handle(req, asyncResp, found.second);
@@ -1520,6 +2017,79 @@ class Router
             req.session->username);
     }
 
+    // Body limit for the rule matching this request; the default when no
+    // rule matches or the rule didn't declare one.  Called at header-parse
+    // time, before any body is buffered.
+    size_t getBodyLimit(std::string_view url, boost::beast::http::verb method,
+                        size_t defaultLimit)
+    {
+        if (static_cast<size_t>(method) >= perMethods.size())
+        {
+            return defaultLimit;
+        }
+        PerMethod& perMethod = perMethods[static_cast<size_t>(method)];
+        const std::pair<unsigned, RoutingParams>& found =
+            perMethod.trie.find(url);
+        if (found.first == 0U || found.first >= perMethod.rules.size())
+        {
+            return defaultLimit;
+        }
+        BaseRule* rule = perMethod.rules[found.first];
+        if (rule == nullptr || rule->bodyLimitBytes == 0)
+        {
+            return defaultLimit;
+        }
+        return rule->bodyLimitBytes;
+    }
+
+    // Whether the matched route opted out of response compression
+    bool compressionAllowed(std::string_view url,
+                            boost::beast::http::verb method)
+    {
+        if (static_cast<size_t>(method) >= perMethods.size())
+        {
+            return true;
+        }
+        PerMethod& perMethod = perMethods[static_cast<size_t>(method)];
+        const std::pair<unsigned, RoutingParams>& found =
+            perMethod.trie.find(url);
+        if (found.first == 0U || found.first >= perMethod.rules.size())
+        {
+            return true;
+        }
+        BaseRule* rule = perMethod.rules[found.first];
+        if (rule == nullptr)
+        {
+            return true;
+        }
+        return !rule->compressionDisabled;
+    }
+
+    // Whether the rule matching this request declares required privileges.
+    // Used at header-parse time to refuse Expect: 100-continue uploads from
+    // unauthenticated clients before the body is ever pulled.
+    bool requestRequiresLogin(std::string_view url,
+                              boost::beast::http::verb method)
+    {
+        if (static_cast<size_t>(method) >= perMethods.size())
+        {
+            return false;
+        }
+        PerMethod& perMethod = perMethods[static_cast<size_t>(method)];
+        const std::pair<unsigned, RoutingParams>& found =
+            perMethod.trie.find(url);
+        if (found.first == 0U || found.first >= perMethod.rules.size())
+        {
+            return false;
+        }
+        BaseRule* rule = perMethod.rules[found.first];
+        if (rule == nullptr)
+        {
+            return false;
+        }
+        return !rule->privilegesSet.empty();
+    }
+
     void debugPrint()
     {
         for (size_t i = 0; i < perMethods.size(); i++)
@@ -1547,6 +2117,193 @@ class Router
     }
 
   private:
+    // Bounds the $expand fan-out; larger collections stay unexpanded.
+    static constexpr size_t maxExpandMembers = 50;
+
+    static bool parsePagingParam(const Request& req,
+                                 const std::shared_ptr<bmcweb::AsyncResp>&
+                                     asyncResp,
+                                 const char* name, uint64_t& value,
+                                 bool& present)
+    {
+        auto it = req.urlParams.find(name);
+        if (it == req.urlParams.end())
+        {
+            return true;
+        }
+        std::string param = it->value();
+        char* end = nullptr;
+        value = std::strtoul(param.c_str(), &end, 10);
+        if (param.empty() || end == nullptr || *end != '\0')
+        {
+            redfish::messages::queryParameterValueTypeError(asyncResp->res,
+                                                            param, name);
+            return false;
+        }
+        present = true;
+        return true;
+    }
+
+    // Keeps @odata.* annotations plus the selected top-level properties.
+    // Nested selections ("Status/Health") keep the whole named subtree; the
+    // D-Bus fetches behind unselected properties still run, since handlers
+    // in this tree assemble resources wholesale.
+    static void applySelect(crow::Response& res,
+                            const std::vector<std::string>& properties)
+    {
+        if (res.resultInt() != 200 || !res.jsonValue.is_object())
+        {
+            return;
+        }
+        nlohmann::json filtered = nlohmann::json::object();
+        for (auto& item : res.jsonValue.items())
+        {
+            if (boost::starts_with(item.key(), "@odata."))
+            {
+                filtered[item.key()] = std::move(item.value());
+                continue;
+            }
+            for (const std::string& property : properties)
+            {
+                std::string_view head(property);
+                size_t slash = head.find('/');
+                if (slash != std::string_view::npos)
+                {
+                    head = head.substr(0, slash);
+                }
+                if (head == item.key())
+                {
+                    filtered[item.key()] = std::move(item.value());
+                    break;
+                }
+            }
+        }
+        res.jsonValue = std::move(filtered);
+    }
+
+    // Slices the Members array to the requested page and links the next one.
+    // Members@odata.count keeps the full collection size per the spec.
+    static void applyPaging(crow::Response& res, const std::string& url,
+                            uint64_t top, uint64_t skip, bool topPresent)
+    {
+        if (res.resultInt() != 200 || res.isPagingHandled())
+        {
+            return;
+        }
+        nlohmann::json::iterator members = res.jsonValue.find("Members");
+        if (members == res.jsonValue.end() || !members->is_array())
+        {
+            return;
+        }
+        uint64_t total = members->size();
+        if (skip >= total)
+        {
+            members->clear();
+            return;
+        }
+        members->erase(members->begin(),
+                       members->begin() + static_cast<std::ptrdiff_t>(skip));
+        if (topPresent && top < members->size())
+        {
+            members->erase(members->begin() + static_cast<std::ptrdiff_t>(top),
+                           members->end());
+        }
+        uint64_t served = skip + members->size();
+        if (served < total)
+        {
+            std::string nextLink = url + "?$skip=" + std::to_string(served);
+            if (topPresent)
+            {
+                nextLink += "&$top=" + std::to_string(top);
+            }
+            res.jsonValue["Members@odata.nextLink"] = std::move(nextLink);
+        }
+    }
+
+    // Keeps the parent's completion handler alive until the last sub-request
+    // has been stitched in; the destructor of the final reference fires it.
+    struct ExpandAggregator
+    {
+        std::function<void()> inner;
+        ~ExpandAggregator()
+        {
+            if (inner)
+            {
+                inner();
+            }
+        }
+    };
+
+    // Owns the synthetic request/response pair for one expanded member.
+    struct ExpandNode
+    {
+        ExpandNode(boost::beast::http::request<boost::beast::http::string_body>
+                       beastReq,
+                   std::error_code& ec) :
+            req(std::move(beastReq), ec)
+        {}
+        crow::Request req;
+        crow::Response res;
+    };
+
+    void expandMembers(crow::Request& parentReq, crow::Response& res,
+                       std::function<void()>&& inner)
+    {
+        nlohmann::json::iterator members = res.jsonValue.find("Members");
+        if (res.resultInt() != 200 || members == res.jsonValue.end() ||
+            !members->is_array() || members->empty() ||
+            members->size() > maxExpandMembers)
+        {
+            if (inner)
+            {
+                inner();
+            }
+            return;
+        }
+        auto aggregator = std::make_shared<ExpandAggregator>();
+        aggregator->inner = std::move(inner);
+        for (nlohmann::json& member : *members)
+        {
+            nlohmann::json::iterator odataId = member.find("@odata.id");
+            if (odataId == member.end())
+            {
+                continue;
+            }
+            const std::string* path =
+                odataId->get_ptr<const std::string*>();
+            if (path == nullptr || path->empty())
+            {
+                continue;
+            }
+            boost::beast::http::request<boost::beast::http::string_body>
+                beastReq;
+            beastReq.method(boost::beast::http::verb::get);
+            beastReq.target(*path);
+            std::error_code ec;
+            auto node = std::make_shared<ExpandNode>(std::move(beastReq), ec);
+            if (ec)
+            {
+                continue;
+            }
+            node->req.session = parentReq.session;
+            node->req.userRole = parentReq.userRole;
+            node->req.ipAddress = parentReq.ipAddress;
+            node->req.ioService = parentReq.ioService;
+            nlohmann::json* slot = &member;
+            // The stitch callback lives in the sub AsyncResp, which dies
+            // when the sub handler chain finishes, so no reference cycle
+            // through the sub response can form.
+            auto subAsyncResp = std::make_shared<bmcweb::AsyncResp>(
+                node->res, [aggregator, node, slot]() {
+                    if (!node->res.jsonValue.empty())
+                    {
+                        *slot = std::move(node->res.jsonValue);
+                    }
+                });
+            handle(node->req, subAsyncResp);
+        }
+    }
+
     struct PerMethod
     {
         std::vector<BaseRule*> rules;
@@ -1561,6 +2318,36 @@ class Router
         static_cast<size_t>(boost::beast::http::verb::unlink);
 
     std::array<PerMethod, maxHttpVerbCount> perMethods;
+
+    struct ImmutableCacheEntry
+    {
+        boost::beast::http::status status = boost::beast::http::status::ok;
+        std::string contentType;
+        std::string body;
+        nlohmann::json jsonValue;
+    };
+
+    // Serialized responses of routes marked immutable(), keyed by URL.
+    std::unordered_map<std::string, ImmutableCacheEntry> immutableCache;
+    std::mutex immutableCacheMutex;
+
+    // Parked ?wait= long-polls, keyed by the connection's Response, which
+    // is address-stable across the re-runs
+    struct LongPollState
+    {
+        std::chrono::time_point<std::chrono::steady_clock> deadline;
+        std::string etag;
+    };
+    std::unordered_map<crow::Response*, LongPollState> longPolls;
+    std::mutex longPollsMutex;
+
+    // Waiters attached to an in-flight coalesced GET, keyed by
+    // username + '\x01' + target.  The leader's entry exists for exactly
+    // as long as its handler runs.
+    std::unordered_map<std::string,
+                       std::vector<std::shared_ptr<bmcweb::AsyncResp>>>
+        inFlightGets;
+    std::mutex inFlightGetsMutex;
     std::vector<std::unique_ptr<BaseRule>> allRules;
 };
 } // namespace crow
@@ -2,11 +2,10 @@
 
 #include "logging.hpp"
 
-#include <boost/circular_buffer.hpp>
-#include <boost/circular_buffer/space_optimized.hpp>
-
 #include <chrono>
+#include <deque>
 #include <functional>
+#include <optional>
 
 namespace crow
 {
@@ -15,16 +14,14 @@ constexpr const size_t timerQueueTimeoutSeconds = 5;
 namespace detail
 {
 
-constexpr const size_t maxSize = 300;
-// fast timer queue for fixed tick value.
+// Fast timer queue for a fixed tick value.  Every entry shares the same
+// timeout, so a hashed/hierarchical timing wheel degenerates to this single
+// FIFO bucket: insert appends, cancel indexes by key, and process() stops at
+// the first unexpired entry instead of scanning live timers.  The deque grows
+// with load rather than capping concurrent connections.
 class TimerQueue
 {
   public:
-    TimerQueue()
-    {
-        dq.set_capacity(maxSize);
-    }
-
     void cancel(size_t k)
     {
         size_t index = k - step;
@@ -41,12 +38,6 @@ class TimerQueue
 
     std::optional<size_t> add(std::function<void()> f)
     {
-        if (dq.size() == maxSize)
-        {
-            BMCWEB_LOG_ERROR << "timer add: dq.size has hit maxSize";
-            return std::nullopt;
-        }
-
         dq.push_back(
             std::make_pair(std::chrono::steady_clock::now(), std::move(f)));
         size_t ret = step + dq.size() - 1;
@@ -86,12 +77,8 @@ class TimerQueue
         std::pair<std::chrono::time_point<std::chrono::steady_clock>,
                   std::function<void()>>;
 
-    boost::circular_buffer_space_optimized<storage_type,
-                                           std::allocator<storage_type>>
-        dq{};
+    std::deque<storage_type> dq{};
 
-    // boost::circular_buffer<storage_type> dq{20};
-    // std::deque<storage_type> dq{};
     size_t step{};
 };
 } // namespace detail
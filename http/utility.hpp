@@ -421,12 +421,28 @@ inline std::string base64encode(const std::string_view data)
     ret.resize((size + 2) / 3 * 4);
     auto it = ret.begin();
 
+    // Full blocks run branch-free: pack three bytes into one word and index
+    // the key table four times.  This path carries KVM frame encodes, where
+    // the per-byte conditionals of the old loop showed up in profiles; the
+    // compiler auto-vectorizes the packing where the target allows.
+    size_t fullBlocks = size / 3;
     size_t i = 0;
-    while (i < size)
+    for (size_t block = 0; block < fullBlocks; block++)
     {
-        size_t keyIndex;
+        uint32_t triple =
+            (static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << 16) |
+            (static_cast<uint32_t>(static_cast<uint8_t>(data[i + 1])) << 8) |
+            static_cast<uint32_t>(static_cast<uint8_t>(data[i + 2]));
+        *it++ = key[(triple >> 18) & 0x3F];
+        *it++ = key[(triple >> 12) & 0x3F];
+        *it++ = key[(triple >> 6) & 0x3F];
+        *it++ = key[triple & 0x3F];
+        i += 3;
+    }
 
-        keyIndex = static_cast<size_t>(data[i] & 0xFC) >> 2;
+    if (i < size)
+    {
+        size_t keyIndex = static_cast<size_t>(data[i] & 0xFC) >> 2;
         *it++ = key[keyIndex];
 
         if (i + 1 < size)
@@ -434,22 +450,9 @@ inline std::string base64encode(const std::string_view data)
             keyIndex = static_cast<size_t>(data[i] & 0x03) << 4;
             keyIndex += static_cast<size_t>(data[i + 1] & 0xF0) >> 4;
             *it++ = key[keyIndex];
-
-            if (i + 2 < size)
-            {
-                keyIndex = static_cast<size_t>(data[i + 1] & 0x0F) << 2;
-                keyIndex += static_cast<size_t>(data[i + 2] & 0xC0) >> 6;
-                *it++ = key[keyIndex];
-
-                keyIndex = static_cast<size_t>(data[i + 2] & 0x3F);
-                *it++ = key[keyIndex];
-            }
-            else
-            {
-                keyIndex = static_cast<size_t>(data[i + 1] & 0x0F) << 2;
-                *it++ = key[keyIndex];
-                *it++ = '=';
-            }
+            keyIndex = static_cast<size_t>(data[i + 1] & 0x0F) << 2;
+            *it++ = key[keyIndex];
+            *it++ = '=';
         }
         else
         {
@@ -458,8 +461,6 @@ inline std::string base64encode(const std::string_view data)
             *it++ = '=';
             *it++ = '=';
         }
-
-        i += 3;
     }
 
     return ret;
@@ -571,6 +572,20 @@ inline bool base64Decode(const std::string_view input, std::string& output)
     return true;
 }
 
+// Joins URL pieces (static prefixes and member IDs) into one string with a
+// single allocation: lengths are summed up front, reserved once, and each
+// piece appended in place.  Collection GETs build thousands of @odata.id
+// values per response; the operator+ chains they replace allocated a
+// temporary per '+'.
+template <typename... Pieces>
+inline std::string joinUrl(const Pieces&... pieces)
+{
+    std::string url;
+    url.reserve((std::string_view(pieces).size() + ...));
+    (url.append(std::string_view(pieces)), ...);
+    return url;
+}
+
 inline std::string convertToAscii(const uint64_t& element)
 {
     uint64_t tmpelement = element;
@@ -599,12 +614,17 @@ inline std::string getDateTime(const std::time_t& time)
     std::array<char, 128> dateTime;
     std::string redfishDateTime("0000-00-00T00:00:00Z00:00");
 
-    if (std::strftime(dateTime.begin(), dateTime.size(), "%FT%T%z",
-                      std::localtime(&time)))
+    size_t sz = std::strftime(dateTime.begin(), dateTime.size(), "%FT%T%z",
+                              std::localtime(&time));
+    if (sz > 2)
     {
-        // insert the colon required by the ISO 8601 standard
-        redfishDateTime = std::string(dateTime.data());
-        redfishDateTime.insert(redfishDateTime.end() - 2, ':');
+        // Build the result in one pass with the colon the ISO 8601 offset
+        // requires, instead of constructing and then shifting the tail
+        redfishDateTime.clear();
+        redfishDateTime.reserve(sz + 1);
+        redfishDateTime.append(dateTime.data(), sz - 2);
+        redfishDateTime += ':';
+        redfishDateTime.append(dateTime.data() + sz - 2, 2);
     }
 
     return redfishDateTime;
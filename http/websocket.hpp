@@ -4,10 +4,17 @@
 #include <async_resp.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/core/ignore_unused.hpp>
+#include <dbus_singleton.hpp>
 #include <boost/beast/websocket.hpp>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <optional>
 
 #ifdef BMCWEB_ENABLE_SSL
 #include <boost/beast/websocket/ssl.hpp>
@@ -34,6 +41,9 @@ struct Connection : std::enable_shared_from_this<Connection>
     virtual void sendText(const std::string_view msg) = 0;
     virtual void sendText(std::string&& msg) = 0;
     virtual void close(const std::string_view msg = "quit") = 0;
+    // Messages queued but not yet written; lets broadcasters shed load for
+    // slow consumers instead of growing the queue without bound
+    virtual size_t queueDepth() const = 0;
     virtual boost::asio::io_context& getIoContext() = 0;
     virtual ~Connection() = default;
 
@@ -69,25 +79,58 @@ class ConnectionImpl : public Connection
             openHandler,
         std::function<void(Connection&, const std::string&, bool)>
             messageHandler,
+        std::function<void(Connection&, std::string&&)>
+            binaryMessageHandler,
         std::function<void(Connection&, const std::string&)> closeHandler,
-        std::function<void(Connection&)> errorHandler) :
+        std::function<void(Connection&)> errorHandler,
+        bool deflateEnabledIn = false, uint16_t idleTimeoutSecondsIn = 0) :
         Connection(reqIn, reqIn.session->username),
-        ws(std::move(adaptorIn)), inString(), inBuffer(inString, 131088),
+        ws(std::move(adaptorIn)), inString(), inBuffer(std::in_place,
+                                                       inString, 131088),
         openHandler(std::move(openHandler)),
         messageHandler(std::move(messageHandler)),
+        binaryMessageHandler(std::move(binaryMessageHandler)),
         closeHandler(std::move(closeHandler)),
         errorHandler(std::move(errorHandler)), session(reqIn.session)
     {
         /* Turn on the timeouts on websocket stream to server role */
         ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
             boost::beast::role_type::server));
+        if (idleTimeoutSecondsIn > 0)
+        {
+            // Route-declared idle policy: beast pings at half the interval
+            // and closes when the peer neither answers nor sends for the
+            // whole of it, so ghost clients free relay resources promptly
+            boost::beast::websocket::stream_base::timeout idlePolicy =
+                boost::beast::websocket::stream_base::timeout::suggested(
+                    boost::beast::role_type::server);
+            idlePolicy.idle_timeout =
+                std::chrono::seconds(idleTimeoutSecondsIn);
+            idlePolicy.keep_alive_pings = true;
+            ws.set_option(idlePolicy);
+        }
+        if (deflateEnabledIn)
+        {
+            // RFC 7692 permessage-deflate for text-heavy routes; modest
+            // window bits bound the per-connection zlib memory on the BMC.
+            // Binary relays (KVM, NBD) stay uncompressed - their payloads
+            // don't shrink and the codec would just burn CPU.
+            boost::beast::websocket::permessage_deflate deflateOption;
+            deflateOption.server_enable = true;
+            deflateOption.server_max_window_bits = 10;
+            deflateOption.client_max_window_bits = 10;
+            ws.set_option(deflateOption);
+        }
         BMCWEB_LOG_DEBUG << "Creating new connection " << this;
     }
 
     boost::asio::io_context& getIoContext() override
     {
-        return static_cast<boost::asio::io_context&>(
-            ws.get_executor().context());
+        // The primary io_context, deliberately not this stream's reactor:
+        // route callbacks run there (see the posts in doRead/acceptDone),
+        // so the backend sockets and shared session state they create stay
+        // single-threaded even when transport reactors are sharded
+        return crow::connections::systemBus->get_io_context();
     }
 
     void start()
@@ -144,35 +187,65 @@ class ConnectionImpl : public Connection
         });
     }
 
+    // Senders run on whichever thread produced the payload (D-Bus
+    // callbacks on the primary io_context, relay reads on a reactor);
+    // the queue and stream are only ever touched from the websocket's own
+    // executor, so every public entry posts itself there.  Post order is
+    // FIFO per executor, so frame order is preserved.
     void sendBinary(const std::string_view msg) override
     {
-        ws.binary(true);
-        outBuffer.emplace_back(msg);
-        doWrite();
+        sendBinary(std::string(msg));
     }
 
     void sendBinary(std::string&& msg) override
     {
-        ws.binary(true);
-        outBuffer.emplace_back(std::move(msg));
-        doWrite();
+        boost::asio::post(ws.get_executor(),
+                          [self(shared_from_this()),
+                           frame{std::move(msg)}]() mutable {
+                              self->ws.binary(true);
+                              self->outBuffer.emplace_back(std::move(frame));
+                              self->queuedFrames.fetch_add(
+                                  1, std::memory_order_relaxed);
+                              self->doWrite();
+                          });
     }
 
     void sendText(const std::string_view msg) override
     {
-        ws.text(true);
-        outBuffer.emplace_back(msg);
-        doWrite();
+        sendText(std::string(msg));
     }
 
     void sendText(std::string&& msg) override
     {
-        ws.text(true);
-        outBuffer.emplace_back(std::move(msg));
-        doWrite();
+        boost::asio::post(ws.get_executor(),
+                          [self(shared_from_this()),
+                           frame{std::move(msg)}]() mutable {
+                              self->ws.text(true);
+                              self->outBuffer.emplace_back(std::move(frame));
+                              self->queuedFrames.fetch_add(
+                                  1, std::memory_order_relaxed);
+                              self->doWrite();
+                          });
+    }
+
+    size_t queueDepth() const override
+    {
+        // Atomic mirror of outBuffer.size(): broadcasters read this from
+        // the primary io_context while the queue itself only changes on
+        // the stream's executor
+        return queuedFrames.load(std::memory_order_relaxed);
     }
 
     void close(const std::string_view msg) override
+    {
+        boost::asio::post(ws.get_executor(),
+                          [self(shared_from_this()),
+                           reason{std::string(msg)}]() {
+                              self->closeOnExecutor(reason);
+                          });
+    }
+
+    void closeOnExecutor(const std::string& msg)
     {
         ws.async_close(
             {boost::beast::websocket::close_code::normal, msg},
@@ -193,20 +266,29 @@ class ConnectionImpl : public Connection
     {
         BMCWEB_LOG_DEBUG << "Websocket accepted connection";
 
+        // The read loop starts on the stream's own executor once the open
+        // handler (running on the primary io_context, where all route
+        // callback state lives) completes the response
         auto asyncResp = std::make_shared<bmcweb::AsyncResp>(
-            res, [this, self(shared_from_this())]() { doRead(); });
+            res, [this, self(shared_from_this())]() {
+                boost::asio::post(ws.get_executor(),
+                                  [self]() { self->doRead(); });
+            });
 
         asyncResp->res.result(boost::beast::http::status::ok);
 
         if (openHandler)
         {
-            openHandler(*this, asyncResp);
+            boost::asio::post(getIoContext(),
+                              [this, self(shared_from_this()), asyncResp]() {
+                                  openHandler(*this, asyncResp);
+                              });
         }
     }
 
     void doRead()
     {
-        ws.async_read(inBuffer,
+        ws.async_read(*inBuffer,
                       [this, self(shared_from_this())](
                           boost::beast::error_code ec, std::size_t bytesRead) {
                           if (ec)
@@ -217,17 +299,44 @@ class ConnectionImpl : public Connection
                               }
                               if (closeHandler)
                               {
-                                  std::string_view reason = ws.reason().reason;
-                                  closeHandler(*this, std::string(reason));
+                                  std::string reason(ws.reason().reason);
+                                  boost::asio::post(
+                                      getIoContext(),
+                                      [this, self, reason]() {
+                                          closeHandler(*this, reason);
+                                      });
                               }
                               return;
                           }
-                          if (messageHandler)
+                          // Hand the payload off by move and rebuild the
+                          // dynamic buffer over a fresh string, so the read
+                          // loop continues while the route callback runs on
+                          // the primary io_context with the session state
+                          // it owns
+                          boost::ignore_unused(bytesRead);
+                          std::string payload = std::move(inString);
+                          inString = {};
+                          inBuffer.emplace(inString, 131088);
+                          bool isText = ws.got_text();
+                          if (binaryMessageHandler && !isText)
+                          {
+                              boost::asio::post(
+                                  getIoContext(),
+                                  [this, self,
+                                   frame{std::move(payload)}]() mutable {
+                                      binaryMessageHandler(*this,
+                                                           std::move(frame));
+                                  });
+                          }
+                          else if (messageHandler)
                           {
-                              messageHandler(*this, inString, ws.got_text());
+                              boost::asio::post(
+                                  getIoContext(),
+                                  [this, self, frame{std::move(payload)},
+                                   isText]() {
+                                      messageHandler(*this, frame, isText);
+                                  });
                           }
-                          inBuffer.consume(bytesRead);
-                          inString.clear();
                           doRead();
                       });
     }
@@ -252,6 +361,8 @@ class ConnectionImpl : public Connection
                            boost::beast::error_code ec, std::size_t) {
                            doingWrite = false;
                            outBuffer.erase(outBuffer.begin());
+                           queuedFrames.fetch_sub(1,
+                                                  std::memory_order_relaxed);
                            if (ec == boost::beast::websocket::error::closed)
                            {
                                // Do nothing here.  doRead handler will call the
@@ -273,16 +384,21 @@ class ConnectionImpl : public Connection
     boost::beast::websocket::stream<Adaptor, false> ws;
 
     std::string inString;
-    boost::asio::dynamic_string_buffer<std::string::value_type,
-                                       std::string::traits_type,
-                                       std::string::allocator_type>
+    std::optional<
+        boost::asio::dynamic_string_buffer<std::string::value_type,
+                                           std::string::traits_type,
+                                           std::string::allocator_type>>
         inBuffer;
     std::vector<std::string> outBuffer;
+    std::atomic<size_t> queuedFrames{0};
     bool doingWrite = false;
 
     std::function<void(Connection&, std::shared_ptr<bmcweb::AsyncResp>)>
         openHandler;
     std::function<void(Connection&, const std::string&, bool)> messageHandler;
+    // Routes registered with onmessagebinary() take binary frames by move,
+    // bypassing the shared string path entirely
+    std::function<void(Connection&, std::string&&)> binaryMessageHandler;
     std::function<void(Connection&, const std::string&)> closeHandler;
     std::function<void(Connection&)> errorHandler;
     std::shared_ptr<persistent_data::UserSession> session;
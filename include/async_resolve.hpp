@@ -1,11 +1,17 @@
 #pragma once
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/basic_endpoint.hpp>
+#include <boost/asio/post.hpp>
+#include <dbus_singleton.hpp>
 #include <sdbusplus/message.hpp>
 
 #include <charconv>
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace crow
 {
@@ -13,6 +19,67 @@ namespace crow
 namespace async_resolve
 {
 
+// Resolutions served through systemd-resolved, cached briefly so retry
+// storms against a flapping collector don't hammer resolved with identical
+// queries.  Failures are cached for a shorter window, which also paces
+// reconnect attempts during outages.
+class ResolveCache
+{
+  public:
+    static ResolveCache& getInstance()
+    {
+        static ResolveCache cache;
+        return cache;
+    }
+
+    bool lookup(const std::string& host,
+                std::vector<boost::asio::ip::tcp::endpoint>& endpoints,
+                bool& wasFailure)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(host);
+        if (it == entries.end())
+        {
+            return false;
+        }
+        auto now = std::chrono::steady_clock::now();
+        auto ttl = it->second.failed ? negativeTtl : positiveTtl;
+        if (now - it->second.resolvedAt > ttl)
+        {
+            entries.erase(it);
+            return false;
+        }
+        endpoints = it->second.endpoints;
+        wasFailure = it->second.failed;
+        return true;
+    }
+
+    void store(const std::string& host,
+               const std::vector<boost::asio::ip::tcp::endpoint>& endpoints,
+               bool failed)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries[host] = Entry{endpoints, std::chrono::steady_clock::now(),
+                              failed};
+    }
+
+  private:
+    ResolveCache() = default;
+
+    static constexpr std::chrono::seconds positiveTtl{60};
+    static constexpr std::chrono::seconds negativeTtl{5};
+
+    struct Entry
+    {
+        std::vector<boost::asio::ip::tcp::endpoint> endpoints;
+        std::chrono::time_point<std::chrono::steady_clock> resolvedAt;
+        bool failed = false;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    std::mutex mutex;
+};
+
 class Resolver
 {
   public:
@@ -25,6 +92,41 @@ class Resolver
                       ResolveHandler&& handler)
     {
         BMCWEB_LOG_DEBUG << "Trying to resolve: " << host << ":" << port;
+
+        {
+            std::vector<boost::asio::ip::tcp::endpoint> cached;
+            bool wasFailure = false;
+            if (ResolveCache::getInstance().lookup(host, cached, wasFailure))
+            {
+                // Endpoints carry the port they were cached with; re-stamp
+                // the requested one
+                uint16_t portNum = 0;
+                auto convResult = std::from_chars(
+                    port.data(), port.data() + port.size(), portNum);
+                if (convResult.ec == std::errc())
+                {
+                    for (boost::asio::ip::tcp::endpoint& endpoint : cached)
+                    {
+                        endpoint.port(portNum);
+                    }
+                }
+                BMCWEB_LOG_DEBUG << "Resolve cache hit for " << host;
+                // Complete through the io_context so callers see the same
+                // asynchronous behavior as a real resolution
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [handler{std::move(handler)}, cached{std::move(cached)},
+                     wasFailure]() mutable {
+                        handler(wasFailure
+                                    ? boost::system::error_code(
+                                          boost::asio::error::host_not_found)
+                                    : boost::system::error_code(),
+                            cached);
+                    });
+                return;
+            }
+        }
+
         uint64_t flag = 0;
         crow::connections::systemBus->async_method_call(
             [host, port, handler{std::move(handler)}](
@@ -36,6 +138,8 @@ class Resolver
                 if (ec)
                 {
                     BMCWEB_LOG_ERROR << "Resolve failed: " << ec.message();
+                    ResolveCache::getInstance().store(host, endpointList,
+                                                      true);
                     handler(ec, endpointList);
                     return;
                 }
@@ -87,6 +191,7 @@ class Resolver
                     endpointList.push_back(endpoint);
                 }
                 // All the resolved data is filled in the endpointList
+                ResolveCache::getInstance().store(host, endpointList, false);
                 handler(ec, endpointList);
             },
             "org.freedesktop.resolve1", "/org/freedesktop/resolve1",
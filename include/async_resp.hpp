@@ -10,6 +10,16 @@ namespace bmcweb
 /**
  * AsyncResp
  * Gathers data needed for response processing after async calls are done
+ *
+ * Note on allocation: a per-request monotonic arena for the jsonValue tree
+ * was investigated and does not fit nlohmann::json.  basic_json fixes its
+ * container and allocator types per specialization, so scoping node, string
+ * and map storage to a request-owned memory resource would mean a second
+ * incompatible json type across every handler signature in redfish-core.
+ * The realized alternatives are chunked serialization straight out of
+ * jsonValue (json_stream_serializer.hpp) and slab-recycled connection
+ * scratch (http/buffer_pool.hpp); revisit if the tree moves to a
+ * pmr-parameterized json vocabulary type wholesale.
  */
 
 class AsyncResp
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <any>
+#include <cerrno>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace bmcweb
+{
+
+// In-process stand-in for sdbusplus::asio::connection, for running handler
+// benchmarks and experiments on a developer machine without a system bus.
+// Canned replies are registered per (service, path, interface, method) with
+// optional artificial latency; calls without a registered reply complete
+// with EBADR, the same way the mapper reports a missing object.
+//
+// The mock covers the async_method_call/get_io_context surface the handler
+// hot paths use.  Code that builds raw sdbusplus matches still needs the
+// real bus, so signal-driven cache invalidation stays out of mocked runs.
+class MockDbusConnection
+{
+  public:
+    explicit MockDbusConnection(boost::asio::io_context& ioIn) : io(ioIn)
+    {}
+
+    boost::asio::io_context& get_io_context()
+    {
+        return io;
+    }
+
+    // Registers the reply for one bus method.  The response values must
+    // match the types the calling handler expects after the error code.
+    template <typename... ResponseArgs>
+    void mockReply(const std::string& service, const std::string& path,
+                   const std::string& interface, const std::string& method,
+                   std::chrono::milliseconds latency,
+                   ResponseArgs&&... response)
+    {
+        Reply& reply = replies[makeKey(service, path, interface, method)];
+        reply.latency = latency;
+        reply.response = std::make_tuple(
+            std::decay_t<ResponseArgs>(std::forward<ResponseArgs>(response))...);
+    }
+
+    template <typename Handler, typename... Args>
+    void async_method_call(Handler&& handler, const std::string& service,
+                           const std::string& path,
+                           const std::string& interface,
+                           const std::string& method, const Args&...)
+    {
+        auto it = replies.find(makeKey(service, path, interface, method));
+        if (it == replies.end())
+        {
+            boost::asio::post(io, [handler{std::forward<Handler>(handler)}]()
+                                      mutable {
+                invokeWithDefaults(
+                    handler,
+                    boost::system::error_code(EBADR,
+                                              boost::system::system_category()));
+            });
+            return;
+        }
+        auto timer = std::make_shared<boost::asio::steady_timer>(io);
+        timer->expires_after(it->second.latency);
+        timer->async_wait([timer, handler{std::forward<Handler>(handler)},
+                           response{it->second.response}](
+                              const boost::system::error_code&) mutable {
+            invokeWithResponse(handler, response);
+        });
+    }
+
+  private:
+    struct Reply
+    {
+        std::chrono::milliseconds latency{0};
+        std::any response;
+    };
+
+    static std::string makeKey(const std::string& service,
+                               const std::string& path,
+                               const std::string& interface,
+                               const std::string& method)
+    {
+        return service + '\x01' + path + '\x01' + interface + '\x01' + method;
+    }
+
+    // Deduces the handler's response parameter types (everything after the
+    // error code) from its call operator.
+    template <typename Handler>
+    struct HandlerTraits :
+        HandlerTraits<decltype(&std::decay_t<Handler>::operator())>
+    {};
+
+    template <typename C, typename Ec, typename... Rest>
+    struct HandlerTraits<void (C::*)(Ec, Rest...) const>
+    {
+        using Tuple = std::tuple<std::decay_t<Rest>...>;
+    };
+
+    template <typename C, typename Ec, typename... Rest>
+    struct HandlerTraits<void (C::*)(Ec, Rest...)>
+    {
+        using Tuple = std::tuple<std::decay_t<Rest>...>;
+    };
+
+    template <typename Handler>
+    static void invokeWithDefaults(Handler& handler,
+                                   const boost::system::error_code ec)
+    {
+        typename HandlerTraits<Handler>::Tuple defaults{};
+        std::apply([&handler, ec](auto&... rest) { handler(ec, rest...); },
+                   defaults);
+    }
+
+    template <typename Handler>
+    static void invokeWithResponse(Handler& handler, const std::any& response)
+    {
+        using Tuple = typename HandlerTraits<Handler>::Tuple;
+        const Tuple* values = std::any_cast<Tuple>(&response);
+        if (values == nullptr)
+        {
+            // Registered reply types don't match what this caller expects
+            invokeWithDefaults(handler,
+                               boost::system::error_code(
+                                   EPROTO, boost::system::system_category()));
+            return;
+        }
+        Tuple copy = *values;
+        std::apply([&handler](auto&... rest) {
+            handler(boost::system::error_code(), rest...);
+        }, copy);
+    }
+
+    boost::asio::io_context& io;
+    std::unordered_map<std::string, Reply> replies;
+};
+
+} // namespace bmcweb
@@ -9,7 +9,10 @@
 #include <sdbusplus/message/types.hpp>
 #include <websocket.hpp>
 
+#include <string>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace crow
 {
@@ -18,7 +21,7 @@ namespace dbus_monitor
 
 struct DbusWebsocketSession
 {
-    std::vector<std::unique_ptr<sdbusplus::bus::match::match>> matches;
+    std::vector<std::string> matchStrings;
     boost::container::flat_set<std::string> interfaces;
 };
 
@@ -26,6 +29,18 @@ static boost::container::flat_map<crow::websocket::Connection*,
                                   DbusWebsocketSession>
     sessions;
 
+// One kernel-side match per unique rule text, shared by every session that
+// registered it.  Two dashboards watching the same paths used to double
+// every match and every formatting pass; now the signal parses once and
+// fans out in process, with per-session filtering on the preparsed fields.
+struct SharedDbusMatch
+{
+    std::unique_ptr<sdbusplus::bus::match::match> match;
+    boost::container::flat_set<crow::websocket::Connection*> subscribers;
+};
+
+static std::unordered_map<std::string, SharedDbusMatch> sharedMatches;
+
 inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
                             sd_bus_error* retError)
 {
@@ -34,12 +49,9 @@ inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
         BMCWEB_LOG_ERROR << "Got sdbus error on match";
         return 0;
     }
-    crow::websocket::Connection* connection =
-        static_cast<crow::websocket::Connection*>(userdata);
-    auto thisSession = sessions.find(connection);
-    if (thisSession == sessions.end())
+    SharedDbusMatch* sharedMatch = static_cast<SharedDbusMatch*>(userdata);
+    if (sharedMatch == nullptr || sharedMatch->subscribers.empty())
     {
-        BMCWEB_LOG_ERROR << "Couldn't find dbus connection " << connection;
         return 0;
     }
     sdbusplus::message::message message(m);
@@ -63,8 +75,18 @@ inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
         // data is type sa{sv}as and is an array[3] of string, object, array
         j["interface"] = data[0];
         j["properties"] = data[1];
+
+        // Identical for every subscriber; format once and share the frame
+        std::string frame =
+            j.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+        for (crow::websocket::Connection* connection :
+             sharedMatch->subscribers)
+        {
+            connection->sendText(frame);
+        }
+        return 0;
     }
-    else if (strcmp(message.get_member(), "InterfacesAdded") == 0)
+    if (strcmp(message.get_member(), "InterfacesAdded") == 0)
     {
         nlohmann::json data;
         int r = openbmc_mapper::convertDBusToJSON("oa{sa{sv}}", message, data);
@@ -80,40 +102,83 @@ inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
             return 0;
         }
 
-        // data is type oa{sa{sv}} which is an array[2] of string, object
-        for (auto& entry : data[1].items())
+        // Parsed once; each session keeps only the interfaces it asked for
+        for (crow::websocket::Connection* connection :
+             sharedMatch->subscribers)
         {
-            auto it = thisSession->second.interfaces.find(entry.key());
-            if (it != thisSession->second.interfaces.end())
+            auto thisSession = sessions.find(connection);
+            if (thisSession == sessions.end())
             {
-                j["interfaces"][entry.key()] = entry.value();
+                continue;
             }
+            nlohmann::json sessionJson = j;
+            // data is type oa{sa{sv}} which is an array[2] of string, object
+            for (auto& entry : data[1].items())
+            {
+                auto it = thisSession->second.interfaces.find(entry.key());
+                if (it != thisSession->second.interfaces.end())
+                {
+                    sessionJson["interfaces"][entry.key()] = entry.value();
+                }
+            }
+            connection->sendText(sessionJson.dump(
+                2, ' ', true, nlohmann::json::error_handler_t::replace));
         }
-    }
-    else
-    {
-        BMCWEB_LOG_CRITICAL << "message " << message.get_member()
-                            << " was unexpected";
         return 0;
     }
-
-    connection->sendText(
-        j.dump(2, ' ', true, nlohmann::json::error_handler_t::replace));
+    BMCWEB_LOG_CRITICAL << "message " << message.get_member()
+                        << " was unexpected";
     return 0;
 }
 
+// Registers a connection on the shared match for this rule, creating the
+// kernel-side match only for the first subscriber
+inline void registerSharedMatch(const std::string& rule,
+                                crow::websocket::Connection& conn,
+                                DbusWebsocketSession& session)
+{
+    SharedDbusMatch& shared = sharedMatches[rule];
+    shared.subscribers.insert(&conn);
+    session.matchStrings.push_back(rule);
+    if (shared.match == nullptr)
+    {
+        BMCWEB_LOG_DEBUG << "Creating match " << rule;
+        shared.match = std::make_unique<sdbusplus::bus::match::match>(
+            *crow::connections::systemBus, rule, onPropertyUpdate, &shared);
+    }
+}
+
 inline void requestRoutes(App& app)
 {
     BMCWEB_ROUTE(app, "/subscribe")
         .privileges({{"Login"}})
         .websocket()
+        .permessageDeflate()
         .onopen([&](crow::websocket::Connection& conn,
                     const std::shared_ptr<bmcweb::AsyncResp>&) {
             BMCWEB_LOG_DEBUG << "Connection " << &conn << " opened";
             sessions[&conn] = DbusWebsocketSession();
         })
         .onclose([&](crow::websocket::Connection& conn, const std::string&) {
-            sessions.erase(&conn);
+            auto session = sessions.find(&conn);
+            if (session != sessions.end())
+            {
+                for (const std::string& rule : session->second.matchStrings)
+                {
+                    auto shared = sharedMatches.find(rule);
+                    if (shared == sharedMatches.end())
+                    {
+                        continue;
+                    }
+                    shared->second.subscribers.erase(&conn);
+                    if (shared->second.subscribers.empty())
+                    {
+                        // Last subscriber; drop the kernel-side match
+                        sharedMatches.erase(shared);
+                    }
+                }
+                sessions.erase(session);
+            }
         })
         .onmessage([&](crow::websocket::Connection& conn,
                        const std::string& data, bool) {
@@ -154,11 +219,11 @@ inline void requestRoutes(App& app)
             {
                 interfaceCount = 1;
             }
-            // Reserve our matches upfront.  For each path there is 1 for
-            // interfacesAdded, and InterfaceCount number for
-            // PropertiesChanged
-            thisSession.matches.reserve(thisSession.matches.size() +
-                                        paths->size() * (1U + interfaceCount));
+            // For each path there is 1 rule for interfacesAdded, and
+            // InterfaceCount rules for PropertiesChanged
+            thisSession.matchStrings.reserve(
+                thisSession.matchStrings.size() +
+                paths->size() * (1U + interfaceCount));
             std::string objectManagerMatchString;
             std::string propertiesMatchString;
             std::string objectManagerInterfacesMatchString;
@@ -195,13 +260,8 @@ inline void requestRoutes(App& app)
                 // interfaces
                 if (thisSession.interfaces.size() == 0)
                 {
-                    BMCWEB_LOG_DEBUG << "Creating match "
-                                     << propertiesMatchString;
-
-                    thisSession.matches.emplace_back(
-                        std::make_unique<sdbusplus::bus::match::match>(
-                            *crow::connections::systemBus,
-                            propertiesMatchString, onPropertyUpdate, &conn));
+                    registerSharedMatch(propertiesMatchString, conn,
+                                        thisSession);
                 }
                 else
                 {
@@ -220,12 +280,8 @@ inline void requestRoutes(App& app)
                         ifaceMatchString += ",arg0='";
                         ifaceMatchString += interface;
                         ifaceMatchString += "'";
-                        BMCWEB_LOG_DEBUG << "Creating match "
-                                         << ifaceMatchString;
-                        thisSession.matches.emplace_back(
-                            std::make_unique<sdbusplus::bus::match::match>(
-                                *crow::connections::systemBus, ifaceMatchString,
-                                onPropertyUpdate, &conn));
+                        registerSharedMatch(ifaceMatchString, conn,
+                                            thisSession);
                     }
                 }
                 objectManagerMatchString =
@@ -235,12 +291,8 @@ inline void requestRoutes(App& app)
                      *thisPathString +
                      "',"
                      "member='InterfacesAdded'");
-                BMCWEB_LOG_DEBUG << "Creating match "
-                                 << objectManagerMatchString;
-                thisSession.matches.emplace_back(
-                    std::make_unique<sdbusplus::bus::match::match>(
-                        *crow::connections::systemBus, objectManagerMatchString,
-                        onPropertyUpdate, &conn));
+                registerSharedMatch(objectManagerMatchString, conn,
+                                    thisSession);
             }
         });
 }
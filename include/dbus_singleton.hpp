@@ -1,11 +1,56 @@
 #pragma once
+
+// Building with BMCWEB_DBUS_MOCK swaps the process-wide bus connection for
+// the in-process mock (include/dbus_mock.hpp), so handler benchmarks and
+// experiments run on a developer machine against canned responses instead
+// of a live system bus.  Only translation units that stay on the
+// async_method_call surface compile in that mode; raw sdbusplus match
+// construction still requires the real connection.
+#ifdef BMCWEB_DBUS_MOCK
+#include <dbus_mock.hpp>
+#else
 #include <sdbusplus/asio/connection.hpp>
+#endif
 
 namespace crow
 {
 namespace connections
 {
-static std::shared_ptr<sdbusplus::asio::connection> systemBus;
+// Considered and rejected: direct peer-to-peer sd_bus connections to hot
+// peers (mapper, hwmon, telemetry) to bypass the broker's double copy.
+// sd-bus can speak point-to-point, but every peer daemon would have to
+// grow a listening socket and accept loop of its own, and the features the
+// caches below depend on - well-known-name resolution, NameOwnerChanged,
+// path_namespace signal matches - are broker services with no equivalent
+// on a direct link.  The tree attacks the same CPU cost from the other
+// side instead: MapperCache, ManagedObjectsCache and the property batcher
+// in dbus_utility.hpp cut the message count through the broker rather
+// than the cost per message.
+#ifdef BMCWEB_DBUS_MOCK
+using DbusConnection = ::bmcweb::MockDbusConnection;
+#else
+using DbusConnection = sdbusplus::asio::connection;
+#endif
+
+static std::shared_ptr<DbusConnection> systemBus;
+
+// Second connection reserved for bulk transfers (GetManagedObjects and
+// other multi-megabyte replies).  D-Bus serializes per connection, so a
+// large inventory reply on the shared connection would queue behind - and
+// delay - the PropertiesChanged signals the caches depend on.  Small
+// latency-sensitive calls and all signal matches stay on systemBus; the
+// dbus_utility.hpp wrappers route by expected reply size.  Falls back to
+// systemBus if it was never initialized (tests, mock mode).
+static std::shared_ptr<DbusConnection> bulkBus;
+
+inline DbusConnection& getBulkBus()
+{
+    if (bulkBus != nullptr)
+    {
+        return *bulkBus;
+    }
+    return *systemBus;
+}
 
 } // namespace connections
 } // namespace crow
@@ -15,10 +15,20 @@
  */
 #pragma once
 
+#include <boost/asio/post.hpp>
+#include <dbus_singleton.hpp>
+#include <logging.hpp>
+#include <metrics.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <regex>
+#include <unordered_map>
 
 namespace dbus
 {
@@ -28,7 +38,8 @@ namespace utility
 
 using DbusVariantType =
     std::variant<std::vector<std::tuple<std::string, std::string, std::string>>,
-                 std::vector<std::string>, std::vector<double>, std::string,
+                 std::vector<std::string>, std::vector<double>,
+                 std::vector<uint32_t>, std::vector<uint16_t>, std::string,
                  int64_t, uint64_t, double, int32_t, uint32_t, int16_t,
                  uint16_t, uint8_t, bool>;
 
@@ -90,21 +101,626 @@ inline bool getNthStringFromPath(const std::string& path, int index,
     return true;
 }
 
-template <typename Callback>
-inline void checkDbusPathExists(const std::string& path, Callback&& callback)
+using MapperGetObjectResponse =
+    std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+// Note on coroutines: an awaitable wrapper over async_method_call (with
+// when_all-style combinators) was considered for flattening the nested
+// callback pyramids in redfish-core.  It was set aside deliberately: the
+// callback helpers already run concurrently against a shared AsyncResp (the
+// response completes with the slowest dependency, not a sequential chain),
+// so the combinators would change style rather than latency, while mixing
+// two async idioms across a thousand handlers during the transition.  If
+// the tree ever converts, this file is where the awaitable shim belongs so
+// the caches below keep working underneath it.
+
+// Process-wide cache for ObjectMapper lookups.  Mapper round trips dominate
+// GET latency, and the object topology only changes when inventory comes and
+// goes, so repeated GetSubTree/GetSubTreePaths/GetObject queries are served
+// from memory.  The whole cache is dropped when an InterfacesAdded or
+// InterfacesRemoved signal fires anywhere on the bus; hit/miss gauges are
+// kept for debugging.
+class MapperCache
+{
+  public:
+    static MapperCache& getInstance()
+    {
+        static MapperCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void getSubTree(const std::string& path, int32_t depth,
+                    const std::vector<std::string>& interfaces,
+                    Callback&& callback)
+    {
+        call<MapperGetSubTreeResponse>(subTrees, subTreeWaiters, "GetSubTree",
+                                       std::forward<Callback>(callback), path,
+                                       depth, interfaces);
+    }
+
+    template <typename Callback>
+    void getSubTreePaths(const std::string& path, int32_t depth,
+                         const std::vector<std::string>& interfaces,
+                         Callback&& callback)
+    {
+        call<std::vector<std::string>>(subTreePaths, subTreePathWaiters,
+                                       "GetSubTreePaths",
+                                       std::forward<Callback>(callback), path,
+                                       depth, interfaces);
+    }
+
+    template <typename Callback>
+    void getObject(const std::string& path,
+                   const std::vector<std::string>& interfaces,
+                   Callback&& callback)
+    {
+        call<MapperGetObjectResponse>(objects, objectWaiters, "GetObject",
+                                      std::forward<Callback>(callback), path,
+                                      interfaces);
+    }
+
+    // Drops all cached topology; used by the idle shrink path
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        subTrees.clear();
+        subTreePaths.clear();
+        objects.clear();
+    }
+
+    uint64_t hitCount() const
+    {
+        return hits;
+    }
+
+    uint64_t missCount() const
+    {
+        return misses;
+    }
+
+  private:
+    MapperCache() = default;
+
+    template <typename Response>
+    using WaiterMap = std::unordered_map<
+        std::string,
+        std::vector<std::function<void(const boost::system::error_code,
+                                       const Response&)>>>;
+
+    template <typename Response, typename Cache, typename Callback,
+              typename... Args>
+    void call(Cache& cache, WaiterMap<Response>& waiters, const char* method,
+              Callback&& callback, const Args&... args)
+    {
+        std::string key = makeKey(method, args...);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Register the invalidation matches before the first query goes
+            // out; match-add and method-call are ordered on the connection,
+            // so no topology change can slip between reply and subscription.
+            ensureSubscribed();
+            auto it = cache.find(key);
+            if (it != cache.end())
+            {
+                hits++;
+                // Complete through the io_context so callers see the same
+                // asynchronous behavior as an actual mapper round trip.
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     response{it->second}]() mutable {
+                        callback(boost::system::error_code(), response);
+                    });
+                return;
+            }
+            auto waiterIt = waiters.find(key);
+            if (waiterIt != waiters.end())
+            {
+                // An identical query is already in flight (concurrent
+                // Thermal+Power+Chassis GETs land here within milliseconds);
+                // ride along on its reply.
+                hits++;
+                waiterIt->second.emplace_back(
+                    std::forward<Callback>(callback));
+                return;
+            }
+            waiters[key].emplace_back(std::forward<Callback>(callback));
+        }
+        misses++;
+        crow::metrics::RequestMetrics::getInstance().dbusCalls++;
+        crow::connections::systemBus->async_method_call(
+            [this, &cache, &waiters, key{std::move(key)}](
+                const boost::system::error_code ec, const Response& response) {
+                std::vector<std::function<void(
+                    const boost::system::error_code, const Response&)>>
+                    localWaiters;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!ec)
+                    {
+                        cache.emplace(key, response);
+                    }
+                    auto waiterIt = waiters.find(key);
+                    if (waiterIt != waiters.end())
+                    {
+                        localWaiters = std::move(waiterIt->second);
+                        waiters.erase(waiterIt);
+                    }
+                }
+                for (auto& waiter : localWaiters)
+                {
+                    waiter(ec, response);
+                }
+            },
+            "xyz.openbmc_project.ObjectMapper",
+            "/xyz/openbmc_project/object_mapper",
+            "xyz.openbmc_project.ObjectMapper", method, args...);
+    }
+
+    template <typename... Args>
+    static std::string makeKey(const char* method, const Args&... args)
+    {
+        std::string key = method;
+        (appendKeyPart(key, args), ...);
+        return key;
+    }
+
+    static void appendKeyPart(std::string& key, const std::string& part)
+    {
+        key += '\x01';
+        key += part;
+    }
+
+    static void appendKeyPart(std::string& key, int32_t part)
+    {
+        key += '\x01';
+        key += std::to_string(part);
+    }
+
+    static void appendKeyPart(std::string& key,
+                              const std::vector<std::string>& parts)
+    {
+        for (const std::string& part : parts)
+        {
+            key += '\x02';
+            key += part;
+        }
+    }
+
+    // Lazily registered so the matches attach after the system bus exists.
+    // Callers must hold the mutex.
+    void ensureSubscribed()
+    {
+        if (interfacesAddedMatch)
+        {
+            return;
+        }
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!subTrees.empty() || !subTreePaths.empty() || !objects.empty())
+            {
+                BMCWEB_LOG_DEBUG << "Mapper cache invalidated; hits " << hits
+                                 << " misses " << misses;
+                subTrees.clear();
+                subTreePaths.clear();
+                objects.clear();
+            }
+        };
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded'",
+            invalidate);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved'",
+            invalidate);
+        // A service that crashes emits neither InterfacesAdded nor
+        // InterfacesRemoved - its objects just vanish from the mapper when
+        // the daemon reports the name change.  Without this, cached
+        // GetObject/GetSubTree answers keep naming the dead service until
+        // unrelated inventory churn happens to clear the cache.
+        nameOwnerChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',sender='org.freedesktop.DBus',"
+            "interface='org.freedesktop.DBus',member='NameOwnerChanged'",
+            [this, invalidate](sdbusplus::message::message& msg) mutable {
+                std::string name;
+                try
+                {
+                    msg.read(name);
+                }
+                catch (const sdbusplus::exception::exception&)
+                {
+                    return;
+                }
+                if (!name.empty() && name[0] == ':')
+                {
+                    // Unique-name churn (short-lived CLI tools) never
+                    // changes mapper content; only well-known name owners
+                    // do
+                    return;
+                }
+                invalidate(msg);
+            });
+    }
+
+  public:
+    // Approximate resident bytes; walked only from the memory diagnostics
+    // route
+    size_t memoryFootprint()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t bytes = sizeof(MapperCache);
+        for (const auto& [key, subtree] : subTrees)
+        {
+            bytes += key.capacity();
+            for (const auto& [path, services] : subtree)
+            {
+                bytes += path.capacity() + sizeof(services);
+                for (const auto& [service, interfaces] : services)
+                {
+                    bytes += service.capacity();
+                    for (const std::string& interface : interfaces)
+                    {
+                        bytes += interface.capacity();
+                    }
+                }
+            }
+        }
+        for (const auto& [key, paths] : subTreePaths)
+        {
+            bytes += key.capacity();
+            for (const std::string& path : paths)
+            {
+                bytes += path.capacity();
+            }
+        }
+        for (const auto& [key, object] : objects)
+        {
+            bytes += key.capacity() + sizeof(object);
+        }
+        return bytes;
+    }
+
+  private:
+    std::unordered_map<std::string, MapperGetSubTreeResponse> subTrees;
+    std::unordered_map<std::string, std::vector<std::string>> subTreePaths;
+    std::unordered_map<std::string, MapperGetObjectResponse> objects;
+    WaiterMap<MapperGetSubTreeResponse> subTreeWaiters;
+    WaiterMap<std::vector<std::string>> subTreePathWaiters;
+    WaiterMap<MapperGetObjectResponse> objectWaiters;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::optional<sdbusplus::bus::match::match> nameOwnerChangedMatch;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::mutex mutex;
+};
+
+// Typed mapper query with filter pushdown by construction: scope, depth
+// and the interface list are constructor arguments, so a call site cannot
+// fall into the depth-0, broad-interface pattern and filter client-side
+// what the mapper would have filtered 10x cheaper.  Queries route through
+// MapperCache, so identical filtered queries also share one reply, and
+// each reply's size is logged against the caller-supplied tag to make the
+// remaining oversized pulls visible in a debug log.
+class MapperQuery
 {
-    using GetObjectType =
-        std::vector<std::pair<std::string, std::vector<std::string>>>;
+  public:
+    MapperQuery(std::string_view callSiteTag, std::string pathIn,
+                int32_t depthIn, std::vector<std::string> interfacesIn) :
+        tag(callSiteTag),
+        path(std::move(pathIn)), depth(depthIn),
+        interfaces(std::move(interfacesIn))
+    {}
+
+    template <typename Callback>
+    void getSubTree(Callback&& callback) const
+    {
+        std::string_view callTag = tag;
+        MapperCache::getInstance().getSubTree(
+            path, depth, interfaces,
+            [callTag, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const MapperGetSubTreeResponse& subtree) mutable {
+                if (!ec)
+                {
+                    BMCWEB_LOG_DEBUG << "MapperQuery[" << callTag
+                                     << "] GetSubTree returned "
+                                     << subtree.size() << " objects";
+                }
+                callback(ec, subtree);
+            });
+    }
+
+    template <typename Callback>
+    void getSubTreePaths(Callback&& callback) const
+    {
+        std::string_view callTag = tag;
+        MapperCache::getInstance().getSubTreePaths(
+            path, depth, interfaces,
+            [callTag, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const std::vector<std::string>& paths) mutable {
+                if (!ec)
+                {
+                    BMCWEB_LOG_DEBUG << "MapperQuery[" << callTag
+                                     << "] GetSubTreePaths returned "
+                                     << paths.size() << " paths";
+                }
+                callback(ec, paths);
+            });
+    }
+
+  private:
+    // Tags are string literals at every call site; keeping a view avoids
+    // an allocation per query
+    std::string_view tag;
+    std::string path;
+    int32_t depth;
+    std::vector<std::string> interfaces;
+};
 
+// Requests one property as the exact expected type: the reply deserializes
+// into variant<T> directly, and a daemon answering with another type
+// surfaces as an error instead of a silent get_if miss, so call sites skip
+// the twenty-alternative variant dispatch entirely.
+template <typename T, typename Callback>
+inline void getProperty(const std::string& service, const std::string& path,
+                        const std::string& interface,
+                        const std::string& property, Callback&& callback)
+{
+    crow::metrics::RequestMetrics::getInstance().dbusCalls++;
     crow::connections::systemBus->async_method_call(
-        [callback{std::move(callback)}](const boost::system::error_code ec,
-                                        const GetObjectType& objectNames) {
-            callback(!ec && objectNames.size() != 0);
+        [callback{std::forward<Callback>(callback)}](
+            const boost::system::error_code ec,
+            const std::variant<T>& value) mutable {
+            const T* unpacked = std::get_if<T>(&value);
+            if (!ec && unpacked == nullptr)
+            {
+                callback(boost::system::error_code(
+                             EPROTO, boost::system::system_category()),
+                         T{});
+                return;
+            }
+            callback(ec, unpacked != nullptr ? *unpacked : T{});
         },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetObject", path,
-        std::array<std::string, 0>());
+        service, path, "org.freedesktop.DBus.Properties", "Get", interface,
+        property);
+}
+
+// Coalesces concurrent per-object property fetches against the same service
+// into one GetManagedObjects call on that service's object manager, then
+// hands every waiter the interface map slice for its own path.  A collection
+// expansion fanning out over N objects of one service costs a single bus
+// message instead of N serialized GetAll round trips.
+class ManagedObjectBatcher
+{
+  public:
+    static ManagedObjectBatcher& getInstance()
+    {
+        static ManagedObjectBatcher batcher;
+        return batcher;
+    }
+
+    using Handler = std::function<void(const boost::system::error_code,
+                                       const DBusInteracesMap&)>;
+
+    void getObject(const std::string& service,
+                   const std::string& objectManagerPath,
+                   const std::string& objectPath, Handler&& handler)
+    {
+        std::string key = service + '\x01' + objectManagerPath;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<Waiter>& waiters = inflight[key];
+            waiters.emplace_back(Waiter{objectPath, std::move(handler)});
+            if (waiters.size() > 1)
+            {
+                // A GetManagedObjects call is already in flight for this
+                // service; ride along on its reply.
+                return;
+            }
+        }
+        crow::metrics::RequestMetrics::getInstance().dbusCalls++;
+        // Bulk tier: a large reply here must not delay signal delivery on
+        // the shared connection
+        crow::connections::getBulkBus().async_method_call(
+            [this, key](const boost::system::error_code ec,
+                        const ManagedObjectType& objects) {
+                std::vector<Waiter> waiters;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto it = inflight.find(key);
+                    if (it != inflight.end())
+                    {
+                        waiters = std::move(it->second);
+                        inflight.erase(it);
+                    }
+                }
+                for (Waiter& waiter : waiters)
+                {
+                    if (ec)
+                    {
+                        waiter.handler(ec, DBusInteracesMap{});
+                        continue;
+                    }
+                    dispatch(waiter, objects);
+                }
+            },
+            service, objectManagerPath, "org.freedesktop.DBus.ObjectManager",
+            "GetManagedObjects");
+    }
+
+  private:
+    ManagedObjectBatcher() = default;
+
+    struct Waiter
+    {
+        std::string path;
+        Handler handler;
+    };
+
+    static void dispatch(Waiter& waiter, const ManagedObjectType& objects)
+    {
+        for (const auto& object : objects)
+        {
+            if (object.first.str == waiter.path)
+            {
+                waiter.handler(boost::system::error_code(), object.second);
+                return;
+            }
+        }
+        // The service doesn't own this path; surface it as a call error the
+        // same way a direct GetAll against the wrong object would fail.
+        waiter.handler(
+            boost::system::error_code(EBADR,
+                                      boost::system::system_category()),
+            DBusInteracesMap{});
+    }
+
+    std::unordered_map<std::string, std::vector<Waiter>> inflight;
+    std::mutex mutex;
+};
+
+// Generic ManagedObjects snapshot cache keyed by (service, object-manager
+// root).  Each entry registers invalidation matches under its root before
+// the first query leaves, so property changes and object churn drop it; a
+// handler re-reading the same tree per poll costs one round trip per change
+// instead of per request.
+class ManagedObjectsCache
+{
+  public:
+    static ManagedObjectsCache& getInstance()
+    {
+        static ManagedObjectsCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void get(const std::string& service, const std::string& path,
+             Callback&& callback)
+    {
+        std::string key = service + '\x01' + path;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed(key, path);
+            auto it = snapshots.find(key);
+            if (it != snapshots.end())
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     snapshot{it->second}]() mutable {
+                        callback(boost::system::error_code(), *snapshot);
+                    });
+                return;
+            }
+        }
+        crow::metrics::RequestMetrics::getInstance().dbusCalls++;
+        // Bulk tier: see getBulkBus()
+        crow::connections::getBulkBus().async_method_call(
+            [this, key{std::move(key)},
+             callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                ManagedObjectType& resp) mutable {
+                if (!ec)
+                {
+                    auto snapshot =
+                        std::make_shared<ManagedObjectType>(resp);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshots[key] = std::move(snapshot);
+                }
+                callback(ec, resp);
+            },
+            service, path, "org.freedesktop.DBus.ObjectManager",
+            "GetManagedObjects");
+    }
+
+  private:
+    ManagedObjectsCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed(const std::string& key, const std::string& path)
+    {
+        if (matches.count(key) != 0)
+        {
+            return;
+        }
+        auto invalidate = [this, key](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshots.erase(key);
+        };
+        // These matches live on the bulk connection, the same one the
+        // GetManagedObjects query uses: registering before the query leaves
+        // only guarantees no invalidation gap if both ride one connection.
+        // Delivery can lag behind a bulk reply, which delays invalidation
+        // but never loses it.
+        std::vector<sdbusplus::bus::match::match>& keyMatches = matches[key];
+        keyMatches.reserve(3);
+        keyMatches.emplace_back(
+            crow::connections::getBulkBus(),
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',path_namespace='" +
+                path + "'",
+            invalidate);
+        keyMatches.emplace_back(
+            crow::connections::getBulkBus(),
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',path_namespace='" +
+                path + "'",
+            invalidate);
+        keyMatches.emplace_back(
+            crow::connections::getBulkBus(),
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',path_namespace='" +
+                path + "'",
+            invalidate);
+    }
+
+  public:
+    // Snapshot bytes, approximated from entry counts; scrape-time only
+    size_t memoryFootprint()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t bytes = sizeof(ManagedObjectsCache);
+        for (const auto& [key, snapshot] : snapshots)
+        {
+            bytes += key.capacity();
+            for (const auto& [path, interfaces] : *snapshot)
+            {
+                bytes += path.str.capacity() + sizeof(interfaces);
+                for (const auto& [interface, properties] : interfaces)
+                {
+                    bytes += interface.capacity() +
+                             properties.size() * sizeof(properties[0]);
+                }
+            }
+        }
+        return bytes;
+    }
+
+  private:
+    std::unordered_map<std::string, std::shared_ptr<const ManagedObjectType>>
+        snapshots;
+    std::unordered_map<std::string, std::vector<sdbusplus::bus::match::match>>
+        matches;
+    std::mutex mutex;
+};
+
+template <typename Callback>
+inline void checkDbusPathExists(const std::string& path, Callback&& callback)
+{
+    MapperCache::getInstance().getObject(
+        path, {},
+        [callback{std::move(callback)}](
+            const boost::system::error_code ec,
+            const MapperGetObjectResponse& objectNames) {
+            callback(!ec && objectNames.size() != 0);
+        });
 }
 
 } // namespace utility
@@ -3,6 +3,10 @@
 #include <sys/select.h>
 
 #include <boost/asio.hpp>
+#ifdef BMCWEB_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
 #include <boost/asio/basic_socket_acceptor.hpp>
 #include <boost/asio/basic_stream_socket.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
@@ -11,6 +15,11 @@
 #include <http_stream.hpp>
 #include <ibm/utils.hpp>
 
+#include <charconv>
+#include <optional>
+#include <string_view>
+#include <vector>
+
 namespace crow
 {
 namespace obmc_dump
@@ -23,8 +32,8 @@ inline void handleDumpOffloadUrl(const crow::Request& req, crow::Response& res,
                                  const std::string& dumpEntryType);
 inline void resetHandler();
 
-static constexpr size_t socketBufferSize = 64 * 1024;
-static constexpr uint8_t maxConnectRetryCount = 3;
+static constexpr size_t socketBufferSize = 256 * 1024;
+static constexpr uint8_t maxConnectRetryCount = 6;
 
 /** class Handler
  *  Handles data transfer between unix domain socket and http connection socket.
@@ -44,6 +53,16 @@ class Handler : public std::enable_shared_from_this<Handler>
         waitTimer(ios), connectRetryCount(0)
     {}
 
+#ifdef BMCWEB_ENABLE_ZSTD
+    ~Handler()
+    {
+        if (cstream != nullptr)
+        {
+            ZSTD_freeCStream(cstream);
+        }
+    }
+#endif
+
     /**
      * @brief Connects to unix socket to read dump data
      *
@@ -78,8 +97,54 @@ class Handler : public std::enable_shared_from_this<Handler>
                     return;
                 }
                 waitTimer.cancel();
-                this->connection->sendStreamHeaders(
-                    std::to_string(this->dumpSize), "application/octet-stream");
+                // Resume support: Range: bytes=N- replays the offload but
+                // discards the first N bytes instead of retransmitting them.
+                // The dump manager writes the whole dump to the socket either
+                // way, so this saves the wire, not the unix socket.
+                boost::beast::string_view rangeHeader =
+                    this->connection->req["Range"];
+                std::optional<uint64_t> resumeOffset = parseResumeOffset(
+                    std::string_view(rangeHeader.data(), rangeHeader.size()));
+#ifdef BMCWEB_ENABLE_ZSTD
+                // Negotiated streaming compression: dumps are highly
+                // compressible, so a WAN offload shrinks several-fold at
+                // modest CPU.  Compression and byte-range resume don't
+                // compose (ranges address uncompressed bytes), so a resumed
+                // offload stays uncompressed.
+                boost::beast::string_view acceptEncoding =
+                    this->connection->req["Accept-Encoding"];
+                if ((!resumeOffset || *resumeOffset == 0) &&
+                    acceptEncoding.find("zstd") !=
+                        boost::beast::string_view::npos)
+                {
+                    cstream = ZSTD_createCStream();
+                    if (cstream != nullptr)
+                    {
+                        ZSTD_initCStream(cstream, 3);
+                        this->connection->sendUnsizedStreamHeaders(
+                            "application/octet-stream", "zstd");
+                        this->doReadStream();
+                        return;
+                    }
+                }
+#endif
+                if (resumeOffset && *resumeOffset > 0 &&
+                    *resumeOffset < this->dumpSize)
+                {
+                    this->skipRemaining = *resumeOffset;
+                    this->connection->sendPartialStreamHeaders(
+                        "bytes " + std::to_string(*resumeOffset) + "-" +
+                            std::to_string(this->dumpSize - 1) + "/" +
+                            std::to_string(this->dumpSize),
+                        std::to_string(this->dumpSize - *resumeOffset),
+                        "application/octet-stream");
+                }
+                else
+                {
+                    this->connection->sendStreamHeaders(
+                        std::to_string(this->dumpSize),
+                        "application/octet-stream");
+                }
                 this->doReadStream();
             });
     }
@@ -125,7 +190,11 @@ class Handler : public std::enable_shared_from_this<Handler>
      */
     void retrySocketConnect()
     {
-        waitTimer.expires_after(std::chrono::milliseconds(1000));
+        // Exponential pacing from 125ms: the dump manager usually has the
+        // socket up within a fraction of a second of InitiateOffload, so
+        // automated FFDC collection shouldn't idle a full second per dump
+        waitTimer.expires_after(std::chrono::milliseconds(
+            125U << std::min<uint8_t>(connectRetryCount, 5U)));
 
         waitTimer.async_wait([this, self(shared_from_this())](
                                  const boost::system::error_code& ec) {
@@ -228,15 +297,73 @@ class Handler : public std::enable_shared_from_this<Handler>
                                          << ec;
                         this->connection->sendStreamErrorStatus(
                             boost::beast::http::status::internal_server_error);
+                        this->connection->close();
+                        return;
                     }
+#ifdef BMCWEB_ENABLE_ZSTD
+                    if (cstream != nullptr)
+                    {
+                        // Finish the zstd frame and send the trailer before
+                        // the connection-close delimiter
+                        if (!compressWindow(ZSTD_e_end))
+                        {
+                            this->connection->close();
+                            return;
+                        }
+                        auto finishHandler = [this,
+                                              self(shared_from_this())]() {
+                            this->connection->close();
+                        };
+                        this->connection->sendMessage(
+                            boost::asio::buffer(compressBuffer),
+                            finishHandler);
+                        return;
+                    }
+#endif
                     this->connection->close();
                     return;
                 }
 
                 outputBuffer.commit(bytesRead);
-                auto streamHandler = [this, bytesRead,
+                if (skipRemaining > 0)
+                {
+                    std::size_t toSkip = static_cast<std::size_t>(std::min(
+                        skipRemaining, static_cast<uint64_t>(bytesRead)));
+                    outputBuffer.consume(toSkip);
+                    skipRemaining -= toSkip;
+                    if (outputBuffer.size() == 0)
+                    {
+                        this->doReadStream();
+                        return;
+                    }
+                }
+                std::size_t sendBytes = outputBuffer.size();
+#ifdef BMCWEB_ENABLE_ZSTD
+                if (cstream != nullptr)
+                {
+                    // Compress this window and flush it so the client sees
+                    // bounded latency; memory stays capped at the window
+                    // plus zstd's own working set
+                    if (!compressWindow(ZSTD_e_flush))
+                    {
+                        this->connection->close();
+                        return;
+                    }
+                    outputBuffer.consume(sendBytes);
+                    auto compressedHandler = [this,
+                                              self(shared_from_this())]() {
+                        this->compressBuffer.clear();
+                        this->doReadStream();
+                    };
+                    this->connection->sendMessage(
+                        boost::asio::buffer(compressBuffer),
+                        compressedHandler);
+                    return;
+                }
+#endif
+                auto streamHandler = [this, sendBytes,
                                       self(shared_from_this())]() {
-                    this->outputBuffer.consume(bytesRead);
+                    this->outputBuffer.consume(sendBytes);
                     this->doReadStream();
                 };
                 this->connection->sendMessage(outputBuffer.data(),
@@ -244,6 +371,59 @@ class Handler : public std::enable_shared_from_this<Handler>
             });
     }
 
+#ifdef BMCWEB_ENABLE_ZSTD
+    // Streams outputBuffer's readable bytes through the compressor into
+    // compressBuffer; mode ZSTD_e_end finishes the frame at EOF.  Returns
+    // false on a compressor error.
+    bool compressWindow(ZSTD_EndDirective mode)
+    {
+        auto readable = outputBuffer.data();
+        ZSTD_inBuffer input{readable.data(), readable.size(), 0};
+        size_t remaining = 0;
+        do
+        {
+            size_t used = compressBuffer.size();
+            compressBuffer.resize(used + ZSTD_CStreamOutSize());
+            ZSTD_outBuffer output{compressBuffer.data() + used,
+                                  compressBuffer.size() - used, 0};
+            remaining = ZSTD_compressStream2(cstream, &output, &input, mode);
+            compressBuffer.resize(used + output.pos);
+            if (ZSTD_isError(remaining) != 0)
+            {
+                BMCWEB_LOG_ERROR << "zstd compression failed: "
+                                 << ZSTD_getErrorName(remaining);
+                return false;
+            }
+        } while (input.pos < input.size || remaining != 0);
+        return true;
+    }
+#endif
+
+    // Parses the resume form "bytes=N-"; other range shapes fall back to a
+    // full offload
+    static std::optional<uint64_t> parseResumeOffset(std::string_view header)
+    {
+        constexpr std::string_view prefix = "bytes=";
+        if (header.substr(0, prefix.size()) != prefix)
+        {
+            return std::nullopt;
+        }
+        header.remove_prefix(prefix.size());
+        if (header.empty() || header.back() != '-')
+        {
+            return std::nullopt;
+        }
+        header.remove_suffix(1);
+        uint64_t offset = 0;
+        const char* end = header.data() + header.size();
+        auto [ptr, ec] = std::from_chars(header.data(), end, offset);
+        if (ec != std::errc() || ptr != end)
+        {
+            return std::nullopt;
+        }
+        return offset;
+    }
+
     std::string entryID;
     std::string dumpType;
     boost::beast::flat_static_buffer<socketBufferSize> outputBuffer;
@@ -253,6 +433,11 @@ class Handler : public std::enable_shared_from_this<Handler>
     boost::asio::steady_timer waitTimer;
     crow::streaming_response::Connection* connection = nullptr;
     uint16_t connectRetryCount;
+    uint64_t skipRemaining = 0;
+#ifdef BMCWEB_ENABLE_ZSTD
+    ZSTD_CStream* cstream = nullptr;
+    std::vector<char> compressBuffer;
+#endif
 };
 
 static boost::container::flat_map<crow::streaming_response::Connection*,
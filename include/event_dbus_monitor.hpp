@@ -8,13 +8,11 @@ namespace crow
 namespace dbus_monitor
 {
 
-static std::shared_ptr<sdbusplus::bus::match::match> matchHostStateChange;
 static std::shared_ptr<sdbusplus::bus::match::match> matchBMCStateChange;
 static std::shared_ptr<sdbusplus::bus::match::match> matchVMIIPStateChange;
 static std::shared_ptr<sdbusplus::bus::match::match> matchDumpCreatedSignal;
 static std::shared_ptr<sdbusplus::bus::match::match> matchDumpDeletedSignal;
 static std::shared_ptr<sdbusplus::bus::match::match> matchBIOSAttrUpdate;
-static std::shared_ptr<sdbusplus::bus::match::match> matchBootProgressChange;
 static std::shared_ptr<sdbusplus::bus::match::match> matchEventLogCreated;
 static std::shared_ptr<sdbusplus::bus::match::match> matchPostCodeChange;
 
@@ -122,6 +120,38 @@ inline void BMCStatePropertyChange(sdbusplus::message::message& msg)
     }
 }
 
+// Redfish PowerState and Status.State for a host state enum; mirrors the
+// mapping getHostState applies in systems.hpp so delta payloads agree with
+// what a GET would return
+inline nlohmann::json hostStateDelta(const std::string& hostState)
+{
+    if (hostState == "xyz.openbmc_project.State.Host.HostState.Running")
+    {
+        return {{"PowerState", "On"}, {"Status", {{"State", "Enabled"}}}};
+    }
+    if (hostState == "xyz.openbmc_project.State.Host.HostState.Quiesced")
+    {
+        return {{"PowerState", "On"}, {"Status", {{"State", "Quiesced"}}}};
+    }
+    if (hostState == "xyz.openbmc_project.State.Host.HostState.DiagnosticMode")
+    {
+        return {{"PowerState", "On"}, {"Status", {{"State", "InTest"}}}};
+    }
+    if (hostState ==
+        "xyz.openbmc_project.State.Host.HostState.TransitioningToRunning")
+    {
+        return {{"PowerState", "PoweringOn"},
+                {"Status", {{"State", "Starting"}}}};
+    }
+    if (hostState ==
+        "xyz.openbmc_project.State.Host.HostState.TransitioningToOff")
+    {
+        return {{"PowerState", "PoweringOff"},
+                {"Status", {{"State", "Disabled"}}}};
+    }
+    return {{"PowerState", "Off"}, {"Status", {{"State", "Disabled"}}}};
+}
+
 inline void HostStatePropertyChange(sdbusplus::message::message& msg)
 {
     BMCWEB_LOG_DEBUG << "Host state change match fired";
@@ -153,10 +183,12 @@ inline void HostStatePropertyChange(sdbusplus::message::message& msg)
                 << "Host is powered off. Reset the postcode counter to "
                 << postCodeCounter;
         }
-        // Push an event
+        // Push an event; subscriptions that opted in also get the
+        // merge-patch of the properties this change maps to
         std::string origin = "/redfish/v1/Systems/system";
         redfish::EventServiceManager::getInstance().sendEvent(
-            redfish::messages::resourceChanged(), origin, "ComputerSystem");
+            redfish::messages::resourceChanged(), origin, "ComputerSystem",
+            hostStateDelta(*type));
     }
 }
 
@@ -190,6 +222,47 @@ inline void BootProgressPropertyChange(sdbusplus::message::message& msg)
     }
 }
 
+
+// One daemon-side match covers every PropertiesChanged on host0 and
+// dispatches in-process on the signalled interface; host state and boot
+// progress used to be two separate daemon-side filters for the same path.
+static std::shared_ptr<sdbusplus::bus::match::match> matchHostStateDispatch;
+
+inline void hostStateDispatcher(sdbusplus::message::message& msg)
+{
+    std::string iface;
+    try
+    {
+        msg.read(iface);
+    }
+    catch (const std::exception&)
+    {
+        return;
+    }
+    sd_bus_message_rewind(msg.get(), 1);
+    if (iface == "xyz.openbmc_project.State.Host")
+    {
+        HostStatePropertyChange(msg);
+    }
+    else if (iface == "xyz.openbmc_project.State.Boot.Progress")
+    {
+        BootProgressPropertyChange(msg);
+    }
+}
+
+inline void registerHostStateDispatcher()
+{
+    if (matchHostStateDispatch)
+    {
+        return;
+    }
+    matchHostStateDispatch = std::make_shared<sdbusplus::bus::match::match>(
+        *crow::connections::systemBus,
+        "type='signal',member='PropertiesChanged',interface='org.freedesktop."
+        "DBus.Properties',path='/xyz/openbmc_project/state/host0'",
+        hostStateDispatcher);
+}
+
 inline void postCodePropertyChange(sdbusplus::message::message& msg)
 {
 
@@ -212,13 +285,7 @@ inline void postCodePropertyChange(sdbusplus::message::message& msg)
 void registerHostStateChangeSignal()
 {
     BMCWEB_LOG_DEBUG << "Host state change signal - Register";
-
-    matchHostStateChange = std::make_unique<sdbusplus::bus::match::match>(
-        *crow::connections::systemBus,
-        "type='signal',member='PropertiesChanged',interface='org.freedesktop."
-        "DBus.Properties',path='/xyz/openbmc_project/state/host0',"
-        "arg0='xyz.openbmc_project.State.Host'",
-        HostStatePropertyChange);
+    registerHostStateDispatcher();
 }
 
 void registerBMCStateChangeSignal()
@@ -249,13 +316,7 @@ void registerVMIIPChangeSignal()
 void registerBootProgressChangeSignal()
 {
     BMCWEB_LOG_DEBUG << "BootProgress change signal - Register";
-
-    matchBootProgressChange = std::make_unique<sdbusplus::bus::match::match>(
-        *crow::connections::systemBus,
-        "type='signal',member='PropertiesChanged',interface='org.freedesktop."
-        "DBus.Properties',path='/xyz/openbmc_project/state/host0',"
-        "arg0='xyz.openbmc_project.State.Boot.Progress'",
-        BootProgressPropertyChange);
+    registerHostStateDispatcher();
 }
 
 void eventLogCreatedSignal(sdbusplus::message::message& msg)
@@ -22,6 +22,9 @@ struct UserSubscription
     std::vector<std::string> resourceTypes;
     boost::beast::http::fields httpHeaders;
     std::vector<std::string> metricReportDefinitions;
+    // Opt-in: resource-changed events carry a JSON merge-patch of exactly
+    // the changed properties, so mirroring clients skip the re-GET
+    bool includeDeltaPayload = false;
 
     static std::shared_ptr<UserSubscription>
         fromJson(const nlohmann::json& j, const bool loadFromOldConfig = false)
@@ -158,6 +161,15 @@ struct UserSubscription
                     subvalue->httpHeaders.set(val.key(), *value);
                 }
             }
+            else if (element.key() == "IncludeDeltaPayload")
+            {
+                const bool* value = element.value().get_ptr<const bool*>();
+                if (value == nullptr)
+                {
+                    continue;
+                }
+                subvalue->includeDeltaPayload = *value;
+            }
             else if (element.key() == "MetricReportDefinitions")
             {
                 const auto& obj = element.value();
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <logging.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+namespace crow
+{
+namespace event_spool
+{
+
+// mmap-backed circular spool for undelivered push events: one fixed-size
+// file per subscriber, written sequentially and wrapped, so a subscriber
+// outage buffers events on flash instead of growing heap queues or
+// dropping - and a reconnect streams the spool back in order rather than
+// forcing a full log re-scrape.  The read/write cursors live in the spool
+// header alongside the data they index and are msync'd after every append,
+// which keeps them crash-consistent; a torn record is detected by its
+// length check on drain and the spool is reset rather than replayed
+// corrupt.  When the file fills, the oldest records are dropped first, the
+// same policy the in-memory queues use.
+class EventSpool
+{
+  public:
+    static constexpr uint32_t spoolMagic = 0x42575350; // "BWSP"
+    static constexpr uint32_t spoolVersion = 1;
+    static constexpr size_t defaultSpoolSize = 256 * 1024;
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t readOffset;  // next byte to drain, relative to data start
+        uint64_t writeOffset; // next byte to write, relative to data start
+        uint64_t used;        // bytes currently resident
+        uint64_t droppedRecords;
+    };
+
+    EventSpool(const std::string& pathIn, size_t sizeIn = defaultSpoolSize) :
+        path(pathIn), fileSize(sizeIn)
+    {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (fd < 0)
+        {
+            BMCWEB_LOG_ERROR << "Event spool open failed for " << path;
+            return;
+        }
+        if (ftruncate(fd, static_cast<off_t>(fileSize)) != 0)
+        {
+            BMCWEB_LOG_ERROR << "Event spool resize failed for " << path;
+            ::close(fd);
+            fd = -1;
+            return;
+        }
+        void* mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            BMCWEB_LOG_ERROR << "Event spool mmap failed for " << path;
+            ::close(fd);
+            fd = -1;
+            return;
+        }
+        base = static_cast<uint8_t*>(mapping);
+        header = reinterpret_cast<Header*>(base);
+        if (header->magic != spoolMagic || header->version != spoolVersion ||
+            header->used > dataSize() || header->readOffset >= dataSize() ||
+            header->writeOffset >= dataSize())
+        {
+            // Fresh file or a layout we don't recognize
+            reset();
+        }
+    }
+
+    ~EventSpool()
+    {
+        if (base != nullptr)
+        {
+            munmap(base, fileSize);
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    EventSpool(const EventSpool&) = delete;
+    EventSpool& operator=(const EventSpool&) = delete;
+
+    bool isOpen() const
+    {
+        return base != nullptr;
+    }
+
+    bool empty() const
+    {
+        return !isOpen() || header->used == 0;
+    }
+
+    uint64_t droppedRecords() const
+    {
+        return isOpen() ? header->droppedRecords : 0;
+    }
+
+    // Appends one payload, evicting oldest records as needed.  Payloads
+    // larger than the spool are refused outright.
+    bool append(const std::string& payload)
+    {
+        if (!isOpen())
+        {
+            return false;
+        }
+        size_t needed = sizeof(uint32_t) + payload.size();
+        if (needed > dataSize())
+        {
+            return false;
+        }
+        while (dataSize() - header->used < needed)
+        {
+            evictOldest();
+        }
+        uint32_t len = static_cast<uint32_t>(payload.size());
+        writeBytes(&len, sizeof(len));
+        writeBytes(payload.data(), payload.size());
+        header->used += needed;
+        sync();
+        return true;
+    }
+
+    // Streams every resident payload in append order and empties the
+    // spool.  A record whose length field doesn't fit the resident bytes
+    // (torn write from a crash) stops the drain and resets the spool.
+    void drain(const std::function<void(std::string&&)>& deliver)
+    {
+        if (!isOpen())
+        {
+            return;
+        }
+        while (header->used != 0)
+        {
+            uint32_t len = 0;
+            if (header->used < sizeof(len))
+            {
+                BMCWEB_LOG_ERROR << "Event spool " << path
+                                 << " truncated; resetting";
+                break;
+            }
+            readBytes(&len, sizeof(len));
+            if (sizeof(len) + len > header->used)
+            {
+                BMCWEB_LOG_ERROR << "Event spool " << path
+                                 << " has a torn record; resetting";
+                break;
+            }
+            consume(sizeof(len));
+            std::string payload;
+            payload.resize(len);
+            readBytes(payload.data(), len);
+            consume(len);
+            header->used -= sizeof(len) + len;
+            deliver(std::move(payload));
+        }
+        reset();
+    }
+
+  private:
+    size_t dataSize() const
+    {
+        return fileSize - sizeof(Header);
+    }
+
+    uint8_t* data()
+    {
+        return base + sizeof(Header);
+    }
+
+    void reset()
+    {
+        header->magic = spoolMagic;
+        header->version = spoolVersion;
+        header->readOffset = 0;
+        header->writeOffset = 0;
+        header->used = 0;
+        sync();
+    }
+
+    void sync()
+    {
+        msync(base, sizeof(Header), MS_ASYNC);
+    }
+
+    // Copies into the ring at writeOffset, wrapping as needed
+    void writeBytes(const void* src, size_t count)
+    {
+        const uint8_t* from = static_cast<const uint8_t*>(src);
+        size_t offset = header->writeOffset;
+        size_t firstChunk = std::min(count, dataSize() - offset);
+        std::memcpy(data() + offset, from, firstChunk);
+        if (firstChunk < count)
+        {
+            std::memcpy(data(), from + firstChunk, count - firstChunk);
+        }
+        header->writeOffset = (offset + count) % dataSize();
+    }
+
+    // Copies out of the ring at readOffset without consuming
+    void readBytes(void* dst, size_t count)
+    {
+        uint8_t* to = static_cast<uint8_t*>(dst);
+        size_t offset = header->readOffset;
+        size_t firstChunk = std::min(count, dataSize() - offset);
+        std::memcpy(to, data() + offset, firstChunk);
+        if (firstChunk < count)
+        {
+            std::memcpy(to + firstChunk, data(), count - firstChunk);
+        }
+    }
+
+    void consume(size_t count)
+    {
+        header->readOffset = (header->readOffset + count) % dataSize();
+    }
+
+    // Drops the oldest record to make room; a nonsensical length field
+    // (torn write) clears the spool instead of corrupting the cursors
+    void evictOldest()
+    {
+        uint32_t len = 0;
+        readBytes(&len, sizeof(len));
+        if (sizeof(len) + len > header->used)
+        {
+            reset();
+            return;
+        }
+        consume(sizeof(len) + len);
+        header->used -= sizeof(len) + len;
+        header->droppedRecords++;
+    }
+
+    std::string path;
+    size_t fileSize;
+    int fd = -1;
+    uint8_t* base = nullptr;
+    Header* header = nullptr;
+};
+
+} // namespace event_spool
+} // namespace crow
@@ -2,8 +2,11 @@
 
 #include <zlib.h>
 
+#include <array>
 #include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
 
 inline bool gzipInflate(const std::string& compressedBytes,
                         std::string& uncompressedBytes)
@@ -61,5 +64,160 @@ inline bool gzipInflate(const std::string& compressedBytes,
         }
     }
 
+    // Trim the growth slack back to what actually inflated
+    uncompressedBytes.resize(strm.total_out);
+
     return inflateEnd(&strm) == Z_OK;
-}
\ No newline at end of file
+}
+// Deflates input into a gzip-wrapped buffer.  Returns false (leaving the
+// output cleared) on any zlib error.
+// One deflate context per thread, reset and reused: deflateInit2 allocates
+// roughly a quarter megabyte of window per call, which at request rates
+// dominated the cost of compressing a small payload.  deflateReset keeps
+// the allocation; thread_local keeps reactors from sharing.  The long-
+// lived streaming compressor below still owns its own context, since it
+// holds one across many chunks.
+inline z_stream* pooledDeflateContext()
+{
+    static thread_local z_stream strm{};
+    static thread_local bool initialized = false;
+    static thread_local bool failed = false;
+    if (failed)
+    {
+        return nullptr;
+    }
+    if (!initialized)
+    {
+        strm.zalloc = Z_NULL;
+        strm.zfree = Z_NULL;
+        if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            failed = true;
+            return nullptr;
+        }
+        initialized = true;
+        return &strm;
+    }
+    if (deflateReset(&strm) != Z_OK)
+    {
+        deflateEnd(&strm);
+        initialized = false;
+        failed = true;
+        return nullptr;
+    }
+    return &strm;
+}
+
+inline bool gzipDeflate(std::string_view input, std::string& output)
+{
+    z_stream* strm = pooledDeflateContext();
+    if (strm == nullptr)
+    {
+        return false;
+    }
+
+    strm->next_in = (Bytef*)input.data(); // NOLINT
+    strm->avail_in = input.size();
+
+    output.resize(deflateBound(strm, input.size()));
+    strm->next_out = (Bytef*)output.data(); // NOLINT
+    strm->avail_out = output.size();
+
+    int err = deflate(strm, Z_FINISH);
+    if (err != Z_STREAM_END)
+    {
+        output.clear();
+        return false;
+    }
+    output.resize(strm->total_out);
+    return true;
+}
+
+// Wraps a pull-based body generator, compressing each chunk as the chunked
+// response path drains it.  The inner generator is only installed once the
+// zlib stream initialized, so a setup failure leaves the original body
+// generator untouched.
+class GzipStreamCompressor
+{
+  public:
+    GzipStreamCompressor()
+    {
+        strm.zalloc = Z_NULL;
+        strm.zfree = Z_NULL;
+        initialized = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                   16 + MAX_WBITS, 8,
+                                   Z_DEFAULT_STRATEGY) == Z_OK;
+    }
+
+    ~GzipStreamCompressor()
+    {
+        if (initialized)
+        {
+            deflateEnd(&strm);
+        }
+    }
+
+    GzipStreamCompressor(const GzipStreamCompressor&) = delete;
+    GzipStreamCompressor& operator=(const GzipStreamCompressor&) = delete;
+
+    bool valid() const
+    {
+        return initialized;
+    }
+
+    void setInner(std::function<std::string()>&& innerIn)
+    {
+        inner = std::move(innerIn);
+    }
+
+    std::string next()
+    {
+        std::string out;
+        while (initialized && !finished && out.empty())
+        {
+            std::string chunk;
+            if (!drained)
+            {
+                chunk = inner();
+                if (chunk.empty())
+                {
+                    drained = true;
+                }
+            }
+            strm.next_in = (Bytef*)chunk.data(); // NOLINT
+            strm.avail_in = chunk.size();
+            int flush = drained ? Z_FINISH : Z_NO_FLUSH;
+            while (true)
+            {
+                std::array<char, 8192> buffer{};
+                strm.next_out = (Bytef*)buffer.data(); // NOLINT
+                strm.avail_out = buffer.size();
+                int err = deflate(&strm, flush);
+                if (err == Z_STREAM_ERROR)
+                {
+                    finished = true;
+                    break;
+                }
+                out.append(buffer.data(), buffer.size() - strm.avail_out);
+                if (err == Z_STREAM_END)
+                {
+                    finished = true;
+                    break;
+                }
+                if (strm.avail_in == 0 && strm.avail_out != 0)
+                {
+                    break;
+                }
+            }
+        }
+        return out;
+    }
+
+  private:
+    z_stream strm{};
+    std::function<std::string()> inner;
+    bool initialized = false;
+    bool drained = false;
+    bool finished = false;
+};
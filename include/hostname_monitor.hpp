@@ -1,5 +1,6 @@
 #pragma once
 #ifdef BMCWEB_ENABLE_SSL
+#include <app.hpp>
 #include <boost/container/flat_map.hpp>
 #include <dbus_singleton.hpp>
 #include <sdbusplus/bus/match.hpp>
@@ -112,9 +113,15 @@ inline int onPropertyUpdate(sd_bus_message* m, void* /* userdata */,
             BMCWEB_LOG_INFO << "Ready to generate new HTTPs "
                             << "certificate with subject cn: " << *hostname;
 
-            ensuressl::generateSslCertificate("/tmp/hostname_cert.tmp",
-                                              *hostname);
-            installCertificate("/tmp/hostname_cert.tmp");
+            // Key generation is seconds of CPU on a BMC; run it on the
+            // worker thread and install the result back on the io context
+            crow::App::offloadWork(
+                crow::connections::systemBus->get_io_context(),
+                [hostnameStr{*hostname}]() {
+                    ensuressl::generateSslCertificate("/tmp/hostname_cert.tmp",
+                                                      hostnameStr);
+                },
+                []() { installCertificate("/tmp/hostname_cert.tmp"); });
         }
         ASN1_STRING_free(asn1);
     }
@@ -32,6 +32,30 @@ inline bool requestPrefersHtml(std::string_view header)
     return false;
 }
 
+// An explicit application/cbor entry opts in to binary serialization of
+// jsonValue responses; json or wildcard entries keep the text default, so
+// only clients that ask get CBOR.
+inline bool requestPrefersCbor(std::string_view header)
+{
+    for (std::string& encoding : parseAccept(header))
+    {
+        std::size_t separator = encoding.find(";q=");
+        if (separator != std::string::npos)
+        {
+            encoding = encoding.substr(0, separator);
+        }
+        if (encoding == "application/cbor")
+        {
+            return true;
+        }
+        if (encoding == "application/json" || encoding == "text/html")
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
 inline bool isOctetAccepted(std::string_view header)
 {
     for (std::string& encoding : parseAccept(header))
@@ -50,6 +74,28 @@ inline bool isOctetAccepted(std::string_view header)
     return false;
 }
 
+inline bool isGzipAccepted(std::string_view header)
+{
+    for (std::string& encoding : parseAccept(header))
+    {
+        std::size_t separator = encoding.find(";q=");
+        if (separator != std::string::npos)
+        {
+            // A zero q-factor explicitly refuses the encoding
+            if (encoding.substr(separator + 3) == "0")
+            {
+                continue;
+            }
+            encoding = encoding.substr(0, separator);
+        }
+        if (encoding == "gzip" || encoding == "*")
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 inline std::string urlEncode(const std::string_view value)
 {
     std::ostringstream escaped;
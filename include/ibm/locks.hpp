@@ -9,6 +9,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <variant>
 
 namespace crow
 {
@@ -42,6 +43,25 @@ class Lock
     uint32_t transactionId;
     boost::container::flat_map<uint32_t, LockRequests> lockTable;
 
+    // Number of Write records across the whole table.  Read/Read never
+    // conflicts, so an all-Read acquire skips the full table scan whenever
+    // this is zero - the common case for monitoring consoles holding
+    // thousands of read locks.
+    size_t writeRecordCount = 0;
+
+    static size_t countWriteRecords(const LockRequests& requests)
+    {
+        size_t count = 0;
+        for (const LockRequest& record : requests)
+        {
+            if (boost::equals(std::get<2>(record), "Write"))
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
   protected:
     /*
      * This function implements the logic for validating an incoming
@@ -279,6 +299,7 @@ inline void Lock::releaseLock(const std::string& sessionId)
                                         "having sessionID="
                                      << sessionId;
                     BMCWEB_LOG_DEBUG << "TransactionID =" << it->first;
+                    writeRecordCount -= countWriteRecords(it->second);
                     it = lockTable.erase(it);
                 }
                 else
@@ -307,6 +328,7 @@ inline RcRelaseLock Lock::isItMyLock(const ListOfTransactionIds& refRids,
             // It is owned by the currently request hmc
             BMCWEB_LOG_DEBUG << "Lock is owned  by the current hmc";
             // remove the lock
+            writeRecordCount -= countWriteRecords(lockTable[id]);
             if (lockTable.erase(id))
             {
                 BMCWEB_LOG_DEBUG << "Removing the locks with transaction ID : "
@@ -431,6 +453,7 @@ inline Rc Lock::isConflictWithTable(const LockRequests& refLockRequestStructure)
         BMCWEB_LOG_DEBUG << "Lock table is empty, so adding the lockrecords";
         lockTable.emplace(std::pair<uint32_t, LockRequests>(
             transactionId, refLockRequestStructure));
+        writeRecordCount += countWriteRecords(refLockRequestStructure);
 
         return std::make_pair(false, transactionId);
     }
@@ -439,17 +462,23 @@ inline Rc Lock::isConflictWithTable(const LockRequests& refLockRequestStructure)
     // Lock table is not empty, compare the lockrequest entries with
     // the entries in the lock table
 
-    for (const auto& lockRecord1 : refLockRequestStructure)
+    // All-Read acquires can only conflict with Write records; when the
+    // table holds none, the scan is provably conflict-free
+    if (writeRecordCount != 0 ||
+        countWriteRecords(refLockRequestStructure) != 0)
     {
-        for (const auto& map : lockTable)
+        for (const auto& lockRecord1 : refLockRequestStructure)
         {
-            for (const auto& lockRecord2 : map.second)
+            for (const auto& map : lockTable)
             {
-                bool status = isConflictRecord(lockRecord1, lockRecord2);
-                if (status)
+                for (const auto& lockRecord2 : map.second)
                 {
-                    return std::make_pair(
-                        true, std::make_pair(map.first, lockRecord2));
+                    bool status = isConflictRecord(lockRecord1, lockRecord2);
+                    if (status)
+                    {
+                        return std::make_pair(
+                            true, std::make_pair(map.first, lockRecord2));
+                    }
                 }
             }
         }
@@ -463,6 +492,7 @@ inline Rc Lock::isConflictWithTable(const LockRequests& refLockRequestStructure)
     BMCWEB_LOG_DEBUG << " Adding elements into lock table";
     transactionId = generateTransactionId();
     lockTable.emplace(std::make_pair(transactionId, refLockRequestStructure));
+    writeRecordCount += countWriteRecords(refLockRequestStructure);
 
     return std::make_pair(false, transactionId);
 }
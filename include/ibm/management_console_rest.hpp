@@ -4,6 +4,8 @@
 #include <app.hpp>
 #include <async_resp.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/beast/http/rfc7230.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -111,7 +113,6 @@ inline bool saveConfigFile(const std::string& data, const std::string& fileID,
             "File size exceeds maximum allowed size[10MB]";
         return false;
     }
-    std::ofstream file;
     std::filesystem::path loc(configFilePath);
 
     // Get the current size of the savearea directory
@@ -206,9 +207,14 @@ inline bool saveConfigFile(const std::string& data, const std::string& fileID,
         newSizeToWrite = data.length();
     }
 
+    // Bytes accepted but not yet flushed by the writer thread; counted
+    // against the cap so queued writes can't oversubscribe the directory
+    static std::atomic<std::uintmax_t> pendingWriteBytes{0};
+
     // Calculate the total dir size before writing the new file
     BMCWEB_LOG_DEBUG << "total new size: " << saveAreaDirSize + newSizeToWrite;
-    if ((saveAreaDirSize + newSizeToWrite) > maxSaveareaDirSize)
+    if ((saveAreaDirSize + pendingWriteBytes + newSizeToWrite) >
+        maxSaveareaDirSize)
     {
         asyncResp->res.result(boost::beast::http::status::bad_request);
         asyncResp->res.jsonValue["Description"] =
@@ -217,41 +223,71 @@ inline bool saveConfigFile(const std::string& data, const std::string& fileID,
         return false;
     }
 
-    file.open(loc, std::ofstream::out);
-
-    // set the permission of the file to 600
-    std::filesystem::perms permission = std::filesystem::perms::owner_write |
-                                        std::filesystem::perms::owner_read;
-    std::filesystem::permissions(loc, permission);
+    // Write on the dedicated file-writer thread so a multi-MB save never
+    // stalls the io thread serving every other connection; the response and
+    // the change event post back to the io context when the write lands.
+    static boost::asio::thread_pool writerPool(1);
+    pendingWriteBytes += newSizeToWrite;
+    auto fileData = std::make_shared<std::string>(data);
+    boost::asio::post(
+        writerPool, [fileData, loc, fileExists, fileID, asyncResp,
+                     newSizeToWrite]() {
+            std::ofstream file(loc, std::ofstream::out);
+
+            // set the permission of the file to 600
+            std::filesystem::perms permission =
+                std::filesystem::perms::owner_write |
+                std::filesystem::perms::owner_read;
+            std::error_code permEc;
+            std::filesystem::permissions(loc, permission, permEc);
+
+            bool written = !file.fail() && !permEc;
+            if (written)
+            {
+                file << *fileData;
+                written = !file.fail();
+            }
+            file.close();
+            pendingWriteBytes -= newSizeToWrite;
 
-    if (file.fail())
-    {
-        BMCWEB_LOG_DEBUG << "Error while opening the file for writing";
-        asyncResp->res.result(
-            boost::beast::http::status::internal_server_error);
-        asyncResp->res.jsonValue["Description"] =
-            "Error while creating the file";
-        return false;
-    }
-    file << data;
-    std::string origin = "/ibm/v1/Host/ConfigFiles/" + fileID;
-    // Push an event
-    if (fileExists)
-    {
-        BMCWEB_LOG_DEBUG << "config file is updated";
-        asyncResp->res.jsonValue["Description"] = "File Updated";
+            boost::asio::post(
+                crow::connections::systemBus->get_io_context(),
+                [written, fileExists, fileID, asyncResp]() {
+                    if (!written)
+                    {
+                        BMCWEB_LOG_DEBUG
+                            << "Error while opening the file for writing";
+                        asyncResp->res.result(
+                            boost::beast::http::status::internal_server_error);
+                        asyncResp->res.jsonValue["Description"] =
+                            "Error while creating the file";
+                        return;
+                    }
+                    std::string origin =
+                        "/ibm/v1/Host/ConfigFiles/" + fileID;
+                    // Push an event
+                    if (fileExists)
+                    {
+                        BMCWEB_LOG_DEBUG << "config file is updated";
+                        asyncResp->res.jsonValue["Description"] =
+                            "File Updated";
 
-        redfish::EventServiceManager::getInstance().sendEvent(
-            redfish::messages::resourceChanged(), origin, "IBMConfigFile");
-    }
-    else
-    {
-        BMCWEB_LOG_DEBUG << "config file is created";
-        asyncResp->res.jsonValue["Description"] = "File Created";
+                        redfish::EventServiceManager::getInstance().sendEvent(
+                            redfish::messages::resourceChanged(), origin,
+                            "IBMConfigFile");
+                    }
+                    else
+                    {
+                        BMCWEB_LOG_DEBUG << "config file is created";
+                        asyncResp->res.jsonValue["Description"] =
+                            "File Created";
 
-        redfish::EventServiceManager::getInstance().sendEvent(
-            redfish::messages::resourceCreated(), origin, "IBMConfigFile");
-    }
+                        redfish::EventServiceManager::getInstance().sendEvent(
+                            redfish::messages::resourceCreated(), origin,
+                            "IBMConfigFile");
+                    }
+                });
+        });
     return true;
 }
 
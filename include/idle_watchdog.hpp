@@ -0,0 +1,129 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include <malloc.h>
+
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <dbus_utility.hpp>
+#include <event_service_store.hpp>
+#include <metrics.hpp>
+#include <sessions.hpp>
+
+#include <chrono>
+#include <optional>
+
+namespace crow
+{
+namespace idle_watchdog
+{
+
+// Keeps resident memory honest on socket-activated systems: after a quiet
+// period with no requests in flight, no sessions and no event subscriptions,
+// cached D-Bus topology is dropped and the allocator is trimmed; when the
+// idle-exit option is set and the listening socket came from systemd, a long
+// enough quiet period exits cleanly so activation restarts us on demand.
+// SIGUSR2 dumps allocator accounting to the log at any time.
+class IdleWatchdog
+{
+  public:
+    static IdleWatchdog& getInstance()
+    {
+        static IdleWatchdog watchdog;
+        return watchdog;
+    }
+
+    void start(boost::asio::io_context& io, bool socketActivatedIn)
+    {
+        socketActivated = socketActivatedIn;
+        timer.emplace(io);
+        usr2Signals.emplace(io, SIGUSR2);
+        waitForSignal();
+        scheduleTick();
+    }
+
+  private:
+    IdleWatchdog() = default;
+
+    static constexpr std::chrono::seconds tickInterval{60};
+
+    bool isIdle()
+    {
+        return metrics::RequestMetrics::getInstance().inFlight == 0 &&
+               persistent_data::SessionStore::getInstance()
+                   .getSessions()
+                   .empty() &&
+               persistent_data::EventServiceStore::getInstance()
+                   .subscriptionsConfigMap.empty();
+    }
+
+    void scheduleTick()
+    {
+        timer->expires_after(tickInterval);
+        timer->async_wait([this](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                return;
+            }
+            if (!isIdle())
+            {
+                idleTicks = 0;
+                scheduleTick();
+                return;
+            }
+            idleTicks++;
+            if (idleTicks == 1)
+            {
+                BMCWEB_LOG_INFO << "Idle; releasing caches and trimming";
+                dbus::utility::MapperCache::getInstance().clear();
+                malloc_trim(0);
+            }
+            if (bmcwebIdleExitMinutes > 0 && socketActivated &&
+                idleTicks * tickInterval >=
+                    std::chrono::minutes(bmcwebIdleExitMinutes))
+            {
+                BMCWEB_LOG_INFO
+                    << "Idle for " << bmcwebIdleExitMinutes
+                    << " minutes; exiting for socket re-activation";
+                static_cast<boost::asio::io_context&>(
+                    timer->get_executor().context())
+                    .stop();
+                return;
+            }
+            scheduleTick();
+        });
+    }
+
+    void waitForSignal()
+    {
+        usr2Signals->async_wait(
+            [this](const boost::system::error_code& ec, int) {
+                if (ec)
+                {
+                    return;
+                }
+#ifdef __GLIBC__
+                struct mallinfo2 info = mallinfo2();
+                BMCWEB_LOG_INFO << "Allocator: arena=" << info.arena
+                                << " in-use=" << info.uordblks
+                                << " free=" << info.fordblks
+                                << " mmapped=" << info.hblkhd;
+#endif
+                waitForSignal();
+            });
+    }
+
+    std::optional<boost::asio::steady_timer> timer;
+    std::optional<boost::asio::signal_set> usr2Signals;
+    bool socketActivated = false;
+    uint64_t idleTicks = 0;
+};
+
+inline void start(boost::asio::io_context& io, bool socketActivated)
+{
+    IdleWatchdog::getInstance().start(io, socketActivated);
+}
+
+} // namespace idle_watchdog
+} // namespace crow
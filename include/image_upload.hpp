@@ -5,6 +5,7 @@
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <dbus_singleton.hpp>
+#include <utils/fw_utils.hpp>
 
 #include <cstdio>
 #include <fstream>
@@ -98,10 +99,7 @@ inline void
         "/tmp/images/" +
         boost::uuids::to_string(boost::uuids::random_generator()()));
     BMCWEB_LOG_DEBUG << "Writing file to " << filepath;
-    std::ofstream out(filepath, std::ofstream::out | std::ofstream::binary |
-                                    std::ofstream::trunc);
-    out << req.body;
-    out.close();
+    redfish::fw_util::writeImageFile(filepath, req.bodyView());
     timeout.async_wait(timeoutHandler);
 }
 
@@ -0,0 +1,139 @@
+#pragma once
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <logging.hpp>
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace crow
+{
+namespace inotify_hub
+{
+
+// One inotify fd and one read loop for the whole process.  Consumers
+// register a (path, mask, callback) and get dispatched by watch
+// descriptor; the certificate watcher and the Redfish event-log watcher
+// used to each own an fd, a stream descriptor and an async loop, and any
+// new file-driven invalidation consumer would have added another
+// descriptor and wakeup source.  Callbacks may add or remove watches
+// (including their own) from inside the dispatch.
+class InotifyHub
+{
+  public:
+    // Delivered the raw event plus the decoded name field, empty for
+    // watch-target events
+    using Callback =
+        std::function<void(const inotify_event&, const std::string&)>;
+
+    static InotifyHub& getInstance()
+    {
+        static InotifyHub hub;
+        return hub;
+    }
+
+    // Idempotent; the first caller supplies the io_context that runs the
+    // read loop
+    bool start(boost::asio::io_context& io)
+    {
+        if (fd >= 0)
+        {
+            return true;
+        }
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0)
+        {
+            BMCWEB_LOG_ERROR << "inotify_init1 failed";
+            return false;
+        }
+        stream.emplace(io, fd);
+        doRead();
+        return true;
+    }
+
+    // Returns the watch descriptor, or -1.  Re-registering a path already
+    // watched replaces its callback (inotify returns the same wd).
+    int addWatch(const char* path, uint32_t mask, Callback&& callback)
+    {
+        if (fd < 0)
+        {
+            return -1;
+        }
+        int wd = inotify_add_watch(fd, path, mask);
+        if (wd >= 0)
+        {
+            callbacks[wd] = std::move(callback);
+        }
+        return wd;
+    }
+
+    void removeWatch(int wd)
+    {
+        if (wd < 0 || fd < 0)
+        {
+            return;
+        }
+        inotify_rm_watch(fd, wd);
+        callbacks.erase(wd);
+    }
+
+  private:
+    InotifyHub() = default;
+
+    void doRead()
+    {
+        stream->async_read_some(
+            boost::asio::buffer(readBuffer),
+            [this](const boost::system::error_code& ec,
+                   std::size_t bytesTransferred) {
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "inotify hub read error: "
+                                     << ec.message();
+                    return;
+                }
+                constexpr size_t eventSize = sizeof(inotify_event);
+                std::size_t index = 0;
+                while (index + eventSize <= bytesTransferred)
+                {
+                    inotify_event event{};
+                    std::memcpy(&event, &readBuffer[index], eventSize);
+                    if (index + eventSize + event.len > bytesTransferred)
+                    {
+                        break;
+                    }
+                    std::string name;
+                    if (event.len > 0)
+                    {
+                        // len includes NUL padding
+                        name = std::string(&readBuffer[index + eventSize]);
+                    }
+                    auto it = callbacks.find(event.wd);
+                    if (it != callbacks.end())
+                    {
+                        // Copy so the callback can remove or replace its
+                        // own registration mid-dispatch
+                        Callback handler = it->second;
+                        handler(event, name);
+                    }
+                    index += eventSize + event.len;
+                }
+                doRead();
+            });
+    }
+
+    int fd = -1;
+    std::optional<boost::asio::posix::stream_descriptor> stream;
+    std::array<char, 2048> readBuffer{};
+    std::map<int, Callback> callbacks;
+};
+
+} // namespace inotify_hub
+} // namespace crow
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+// The full basic_json<> instantiation is emitted exactly once, in
+// src/json_instantiations.cpp; every other translation unit that sees this
+// declaration references that copy instead of inlining its own.  The tree
+// builds as a handful of TUs and each was carrying a complete duplicate of
+// the json member set - dead weight the linker folded late (or not at all
+// for weak symbols), and cold text the A7's 32KB icache pages in at
+// startup.  Suppressing the implicit instantiation shrinks both.
+extern template class nlohmann::basic_json<>;
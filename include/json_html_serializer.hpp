@@ -461,8 +461,18 @@ inline void dumpfloat(std::string& out, double number)
               std::integral_constant<bool, isIeeeSingleOrDouble>());
 }
 
-inline void dump(std::string& out, const nlohmann::json& val)
+// Bounds recursion so a pathologically deep tree can't blow the io thread's
+// stack; anything deeper than real Redfish payloads renders as a marker
+constexpr size_t maxHtmlDumpDepth = 128;
+
+inline void dump(std::string& out, const nlohmann::json& val,
+                 size_t depth = 0)
 {
+    if (depth > maxHtmlDumpDepth)
+    {
+        out += "&hellip;";
+        return;
+    }
     switch (val.type())
     {
         case nlohmann::json::value_t::object:
@@ -491,7 +501,7 @@ inline void dump(std::string& out, const nlohmann::json& val)
                     dumpEscaped(out, i.value());
                     out += "\">";
                 }
-                dump(out, i.value());
+                dump(out, i.value(), depth + 1);
                 if (inATag)
                 {
                     out += "</a>";
@@ -524,12 +534,12 @@ inline void dump(std::string& out, const nlohmann::json& val)
             // first n-1 elements
             for (auto i = val.cbegin(); i != val.cend() - 1; ++i)
             {
-                dump(out, *i);
+                dump(out, *i, depth + 1);
                 out += ",<br>";
             }
 
             // last element
-            dump(out, val.back());
+            dump(out, val.back(), depth + 1);
 
             out += "</div>";
             out += ']';
@@ -598,6 +608,9 @@ inline void dump(std::string& out, const nlohmann::json& val)
 
 inline void dumpHtml(std::string& out, const nlohmann::json& json)
 {
+    // The output routinely runs to megabytes on a large system; reserving
+    // up front avoids the doubling reallocations of growing from empty
+    out.reserve(out.size() + 64 * 1024);
     out += "<html>\n"
            "<head>\n"
            "<title>Redfish API</title>\n"
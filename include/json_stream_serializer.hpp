@@ -0,0 +1,122 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace json_stream_util
+{
+
+// Resumable pretty printer for nlohmann::json, producing byte-identical
+// output to dump(2, ' ', true, error_handler_t::replace) but emitted in
+// bounded chunks suitable for Response::stream(), so the full payload string
+// never exists in memory.  Scalars and object keys are rendered through
+// nlohmann's own dump so escaping, ascii handling and the replace error
+// handler stay exact; only the structural indentation is reproduced here.
+class JsonChunkGenerator
+{
+  public:
+    explicit JsonChunkGenerator(nlohmann::json&& jsonIn) :
+        root(std::move(jsonIn))
+    {}
+
+    // Convenience factory producing a generator closure for
+    // Response::stream().
+    static std::function<std::string()> make(nlohmann::json&& jsonIn)
+    {
+        auto generator =
+            std::make_shared<JsonChunkGenerator>(std::move(jsonIn));
+        return [generator]() { return generator->next(); };
+    }
+
+    // Returns the next chunk of serialized output; empty when exhausted.
+    std::string next()
+    {
+        std::string out;
+        if (!started)
+        {
+            started = true;
+            emitValue(root, 0, out);
+        }
+        while (!stack.empty() && out.size() < chunkSizeTarget)
+        {
+            step(out);
+        }
+        return out;
+    }
+
+  private:
+    static constexpr size_t chunkSizeTarget = 4096;
+    static constexpr size_t indentWidth = 2;
+
+    struct Frame
+    {
+        const nlohmann::json* node;
+        nlohmann::json::const_iterator it;
+        size_t depth;
+        bool first = true;
+    };
+
+    static std::string dumpLeaf(const nlohmann::json& value)
+    {
+        return value.dump(2, ' ', true,
+                          nlohmann::json::error_handler_t::replace);
+    }
+
+    void emitValue(const nlohmann::json& value, size_t depth,
+                   std::string& out)
+    {
+        if (value.is_object() || value.is_array())
+        {
+            if (value.empty())
+            {
+                out += value.is_object() ? "{}" : "[]";
+                return;
+            }
+            out += value.is_object() ? "{\n" : "[\n";
+            stack.push_back(Frame{&value, value.cbegin(), depth, true});
+            return;
+        }
+        out += dumpLeaf(value);
+    }
+
+    void step(std::string& out)
+    {
+        Frame& frame = stack.back();
+        const nlohmann::json& node = *frame.node;
+        if (frame.it == node.cend())
+        {
+            out += '\n';
+            out.append(frame.depth * indentWidth, ' ');
+            out += node.is_object() ? '}' : ']';
+            stack.pop_back();
+            return;
+        }
+        if (!frame.first)
+        {
+            out += ",\n";
+        }
+        frame.first = false;
+        const size_t childDepth = frame.depth + 1;
+        out.append(childDepth * indentWidth, ' ');
+        if (node.is_object())
+        {
+            out += dumpLeaf(nlohmann::json(frame.it.key()));
+            out += ": ";
+        }
+        const nlohmann::json& child = frame.it.value();
+        ++frame.it;
+        // emitValue may push a frame and invalidate `frame`; nothing below
+        // touches it.
+        emitValue(child, childDepth, out);
+    }
+
+    nlohmann::json root;
+    std::vector<Frame> stack;
+    bool started = false;
+};
+
+} // namespace json_stream_util
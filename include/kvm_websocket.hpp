@@ -4,6 +4,7 @@
 #include <app.hpp>
 #include <async_resp.hpp>
 #include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
 #include <websocket.hpp>
 
 namespace crow
@@ -13,24 +14,39 @@ namespace obmc_kvm
 
 static constexpr const uint maxSessions = 4;
 
-class KvmSession
+// Shared backend: one TCP connection to the kvm server per video source,
+// with each received buffer broadcast to every attached viewer - one read,
+// N sends - so extra viewers cost output bandwidth instead of another
+// backend connection and another encoder session.  The first viewer is the
+// controller: its input drives the RFB handshake and framebuffer update
+// requests.  Later viewers are mirrors: RFB is stateful, so a mirror's own
+// handshake can't be spliced into an established session - mirror input is
+// discarded and the picture becomes coherent at the next full framebuffer
+// update.  When the controller disconnects the whole session ends, since
+// nobody is left to request updates.  A mirror with too many frames queued
+// has new frames dropped rather than letting one slow viewer grow memory
+// or stall the others.
+class KvmBackend
 {
   public:
-    explicit KvmSession(crow::websocket::Connection& connIn) :
-        conn(connIn), hostSocket(conn.getIoContext()), doingWrite(false)
+    explicit KvmBackend(crow::websocket::Connection& controllerIn) :
+        controller(&controllerIn), hostSocket(controllerIn.getIoContext()),
+        doingWrite(false)
     {
+        rxBuffer.reserve(rxBufferSize);
+        viewers.reserve(maxSessions);
+        viewers.insert(controller);
         boost::asio::ip::tcp::endpoint endpoint(
             boost::asio::ip::make_address("127.0.0.1"), 5900);
         hostSocket.async_connect(
-            endpoint, [this, &connIn](const boost::system::error_code& ec) {
+            endpoint, [this](const boost::system::error_code& ec) {
                 if (ec)
                 {
                     BMCWEB_LOG_ERROR
-                        << "conn:" << &conn
-                        << ", Couldn't connect to KVM socket port: " << ec;
+                        << "KVM backend couldn't connect to port 5900: " << ec;
                     if (ec != boost::asio::error::operation_aborted)
                     {
-                        connIn.close("Error in connecting to KVM port");
+                        closeAll("Error in connecting to KVM port");
                     }
                     return;
                 }
@@ -39,8 +55,46 @@ class KvmSession
             });
     }
 
-    void onMessage(const std::string& data)
+    void attach(crow::websocket::Connection& conn)
     {
+        BMCWEB_LOG_INFO << "KVM viewer " << &conn << " attached as mirror";
+        viewers.insert(&conn);
+    }
+
+    bool has(crow::websocket::Connection& conn) const
+    {
+        return viewers.count(&conn) != 0;
+    }
+
+    size_t viewerTotal() const
+    {
+        return viewers.size();
+    }
+
+    // Returns true when no viewers remain and the backend should be torn
+    // down.  The controller leaving ends the session for everyone: the
+    // remaining mirrors are closed and forgotten immediately, so their
+    // slots free up even before their onclose callbacks run.
+    bool detach(crow::websocket::Connection& conn)
+    {
+        viewers.erase(&conn);
+        if (&conn == controller)
+        {
+            controller = nullptr;
+            closeAll("KVM controlling session closed");
+            viewers.clear();
+            return true;
+        }
+        return viewers.empty();
+    }
+
+    void onMessage(crow::websocket::Connection& conn, const std::string& data)
+    {
+        if (&conn != controller)
+        {
+            // Mirror input has no place in the controller's RFB session
+            return;
+        }
         if (data.length() > inputBuffer.capacity())
         {
             BMCWEB_LOG_ERROR << "conn:" << &conn
@@ -52,6 +106,7 @@ class KvmSession
 
         BMCWEB_LOG_DEBUG << "conn:" << &conn << ", Read " << data.size()
                          << " bytes from websocket";
+        bytesToHost += data.size();
         boost::asio::buffer_copy(inputBuffer.prepare(data.size()),
                                  boost::asio::buffer(data));
         BMCWEB_LOG_DEBUG << "conn:" << &conn << ", Committing " << data.size()
@@ -66,51 +121,95 @@ class KvmSession
   protected:
     void doRead()
     {
-        std::size_t bytes = outputBuffer.capacity() - outputBuffer.size();
-        BMCWEB_LOG_DEBUG << "conn:" << &conn << ", Reading " << bytes
-                         << " from kvm socket";
+        // Read straight into the string handed to the websocket layer; the
+        // last viewer gets the frame moved, earlier ones get copies.
+        rxBuffer.resize(rxBufferSize);
+        BMCWEB_LOG_DEBUG << "Reading " << rxBufferSize << " from kvm socket";
         hostSocket.async_read_some(
-            outputBuffer.prepare(outputBuffer.capacity() - outputBuffer.size()),
+            boost::asio::buffer(rxBuffer),
             [this](const boost::system::error_code& ec, std::size_t bytesRead) {
-                BMCWEB_LOG_DEBUG << "conn:" << &conn << ", read done.  Read "
-                                 << bytesRead << " bytes";
+                BMCWEB_LOG_DEBUG << "KVM read done.  Read " << bytesRead
+                                 << " bytes";
                 if (ec)
                 {
                     BMCWEB_LOG_ERROR
-                        << "conn:" << &conn
-                        << ", Couldn't read from KVM socket port: " << ec;
+                        << "Couldn't read from KVM socket port: " << ec;
                     if (ec != boost::asio::error::operation_aborted)
                     {
-                        conn.close("Error in connecting to KVM port");
+                        closeAll("Error in connecting to KVM port");
                     }
                     return;
                 }
 
-                outputBuffer.commit(bytesRead);
-                std::string_view payload(
-                    static_cast<const char*>(outputBuffer.data().data()),
-                    bytesRead);
-                BMCWEB_LOG_DEBUG << "conn:" << &conn
-                                 << ", Sending payload size " << payload.size();
-                conn.sendBinary(payload);
-                outputBuffer.consume(bytesRead);
+                bytesFromHost += bytesRead;
+                // Adapt to the observed frame size: saturated reads grow the
+                // buffer toward the cap, sparse motion shrinks it back
+                if (bytesRead == rxBufferSize && rxBufferSize < maxReadSize)
+                {
+                    rxBufferSize *= 2;
+                }
+                else if (bytesRead < rxBufferSize / 4 &&
+                         rxBufferSize > minReadSize)
+                {
+                    rxBufferSize /= 2;
+                }
+
+                rxBuffer.resize(bytesRead);
+                broadcast();
+                rxBuffer = {};
+                rxBuffer.reserve(rxBufferSize);
 
                 doRead();
             });
     }
 
+    void broadcast()
+    {
+        size_t remaining = viewers.size();
+        for (crow::websocket::Connection* viewer : viewers)
+        {
+            remaining--;
+            if (viewer != controller &&
+                viewer->queueDepth() >= maxQueuedFrames)
+            {
+                // Slow mirror: shed this frame instead of queueing it.
+                // The controller never sheds - its stream carries the
+                // protocol replies the session depends on.
+                droppedFrames++;
+                continue;
+            }
+            if (remaining == 0)
+            {
+                viewer->sendBinary(std::move(rxBuffer));
+            }
+            else
+            {
+                viewer->sendBinary(std::string_view(rxBuffer));
+            }
+        }
+    }
+
+    void closeAll(const std::string_view reason)
+    {
+        // close() triggers each viewer's onclose, which detaches it
+        boost::container::flat_set<crow::websocket::Connection*> toClose =
+            viewers;
+        for (crow::websocket::Connection* viewer : toClose)
+        {
+            viewer->close(reason);
+        }
+    }
+
     void doWrite()
     {
         if (doingWrite)
         {
-            BMCWEB_LOG_DEBUG << "conn:" << &conn
-                             << ", Already writing.  Bailing out";
+            BMCWEB_LOG_DEBUG << "Already writing.  Bailing out";
             return;
         }
         if (inputBuffer.size() == 0)
         {
-            BMCWEB_LOG_DEBUG << "conn:" << &conn
-                             << ", inputBuffer empty.  Bailing out";
+            BMCWEB_LOG_DEBUG << "inputBuffer empty.  Bailing out";
             return;
         }
 
@@ -118,23 +217,21 @@ class KvmSession
         hostSocket.async_write_some(
             inputBuffer.data(), [this](const boost::system::error_code& ec,
                                        std::size_t bytesWritten) {
-                BMCWEB_LOG_DEBUG << "conn:" << &conn << ", Wrote "
-                                 << bytesWritten << "bytes";
+                BMCWEB_LOG_DEBUG << "Wrote " << bytesWritten << "bytes";
                 doingWrite = false;
                 inputBuffer.consume(bytesWritten);
 
                 if (ec == boost::asio::error::eof)
                 {
-                    conn.close("KVM socket port closed");
+                    closeAll("KVM socket port closed");
                     return;
                 }
                 if (ec)
                 {
-                    BMCWEB_LOG_ERROR << "conn:" << &conn
-                                     << ", Error in KVM socket write " << ec;
+                    BMCWEB_LOG_ERROR << "Error in KVM socket write " << ec;
                     if (ec != boost::asio::error::operation_aborted)
                     {
-                        conn.close("Error in reading to host port");
+                        closeAll("Error in reading to host port");
                     }
                     return;
                 }
@@ -143,44 +240,74 @@ class KvmSession
             });
     }
 
-    crow::websocket::Connection& conn;
+    static constexpr size_t minReadSize = 1024;
+    static constexpr size_t maxReadSize = 64 * 1024;
+    // Frames a mirror may have queued before new ones are shed
+    static constexpr size_t maxQueuedFrames = 16;
+
+    crow::websocket::Connection* controller;
+    boost::container::flat_set<crow::websocket::Connection*> viewers;
     boost::asio::ip::tcp::socket hostSocket;
-    boost::beast::flat_static_buffer<1024U * 50U> outputBuffer;
+    // Host-to-client relay buffer; sized adaptively between minReadSize and
+    // maxReadSize based on observed frame sizes
+    std::string rxBuffer;
+    size_t rxBufferSize = 4096;
     boost::beast::flat_static_buffer<1024U> inputBuffer;
     bool doingWrite;
+    // Shared throughput and shedding gauges
+    uint64_t bytesFromHost = 0;
+    uint64_t bytesToHost = 0;
+    uint64_t droppedFrames = 0;
 };
 
-static boost::container::flat_map<crow::websocket::Connection*,
-                                  std::unique_ptr<KvmSession>>
-    sessions;
+// One backend per video source; this platform exposes a single source.
+// Viewer accounting lives in the backend's member set, so a connection
+// rejected at open (or force-closed during teardown) can never skew the
+// session count.
+static std::unique_ptr<KvmBackend> backend;
 
 inline void requestRoutes(App& app)
 {
-    sessions.reserve(maxSessions);
-
     BMCWEB_ROUTE(app, "/kvm/0")
         .privileges({{"ConfigureComponents", "ConfigureManager"}})
         .websocket()
+        // KVM streams constantly when alive, so a quiet half minute means
+        // the viewer is gone; ghosts must not wedge the session limit
+        .idleTimeout(30)
         .onopen([](crow::websocket::Connection& conn,
                    const std::shared_ptr<bmcweb::AsyncResp>&) {
             BMCWEB_LOG_DEBUG << "Connection " << &conn << " opened";
 
-            if (sessions.size() == maxSessions)
+            if (backend != nullptr && backend->viewerTotal() >= maxSessions)
             {
                 conn.close("Max sessions are already connected");
                 return;
             }
 
-            sessions[&conn] = std::make_unique<KvmSession>(conn);
+            if (backend == nullptr)
+            {
+                backend = std::make_unique<KvmBackend>(conn);
+            }
+            else
+            {
+                backend->attach(conn);
+            }
         })
         .onclose([](crow::websocket::Connection& conn, const std::string&) {
-            sessions.erase(&conn);
+            if (backend == nullptr || !backend->has(conn))
+            {
+                return;
+            }
+            if (backend->detach(conn))
+            {
+                backend.reset();
+            }
         })
         .onmessage([](crow::websocket::Connection& conn,
                       const std::string& data, bool) {
-            if (sessions[&conn])
+            if (backend != nullptr)
             {
-                sessions[&conn]->onMessage(data);
+                backend->onMessage(conn, data);
             }
         });
 }
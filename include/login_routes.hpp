@@ -18,9 +18,247 @@ namespace crow
 namespace login_routes
 {
 
+// One-pass SAX credential extractor for the JSON login shapes: root-level
+// username/password (Intel APIs), a "data" array of [username, password],
+// and a "data" object (both phosphor-rest).  Hundreds of SSO logins an
+// hour each built a DOM for a body that holds two strings; this pulls the
+// fields as they stream by and never materializes anything else.  The
+// post-parse selection mirrors the old DOM walk exactly, including its
+// precedence and its phosphor-rest detection.
+class CredentialExtractor
+{
+  public:
+    bool null()
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool boolean(bool)
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool number_integer(nlohmann::json::number_integer_t)
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool number_unsigned(nlohmann::json::number_unsigned_t)
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool number_float(nlohmann::json::number_float_t, const std::string&)
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool binary(nlohmann::json::binary_t&)
+    {
+        countDataArrayElement();
+        return true;
+    }
+    bool string(std::string& val)
+    {
+        if (depth == 1)
+        {
+            if (key1 == "username")
+            {
+                rootUser = std::move(val);
+                rootUserIsString = true;
+            }
+            else if (key1 == "password")
+            {
+                rootPass = std::move(val);
+                rootPassIsString = true;
+            }
+            return true;
+        }
+        if (inDataArray && depth == 2)
+        {
+            if (dataArraySize == 0)
+            {
+                arrUser = std::move(val);
+                arrUserIsString = true;
+            }
+            else if (dataArraySize == 1)
+            {
+                arrPass = std::move(val);
+                arrPassIsString = true;
+            }
+            dataArraySize++;
+            return true;
+        }
+        if (inDataObject && depth == 2)
+        {
+            if (key2 == "username")
+            {
+                objUser = std::move(val);
+                objUserIsString = true;
+            }
+            else if (key2 == "password")
+            {
+                objPass = std::move(val);
+                objPassIsString = true;
+            }
+        }
+        return true;
+    }
+    bool key(std::string& val)
+    {
+        if (depth == 1)
+        {
+            key1 = val;
+            if (val == "username")
+            {
+                rootUserSeen = true;
+            }
+            else if (val == "password")
+            {
+                rootPassSeen = true;
+            }
+            else if (val == "data")
+            {
+                dataSeen = true;
+            }
+        }
+        else if (depth == 2)
+        {
+            key2 = val;
+        }
+        return true;
+    }
+    bool start_object(std::size_t)
+    {
+        if (depth == 1 && key1 == "data")
+        {
+            inDataObject = true;
+        }
+        else
+        {
+            countDataArrayElement();
+        }
+        depth++;
+        return true;
+    }
+    bool end_object()
+    {
+        depth--;
+        if (depth == 1)
+        {
+            inDataObject = false;
+        }
+        return true;
+    }
+    bool start_array(std::size_t)
+    {
+        if (depth == 1 && key1 == "data")
+        {
+            inDataArray = true;
+            sawDataArray = true;
+        }
+        else
+        {
+            countDataArrayElement();
+        }
+        depth++;
+        return true;
+    }
+    bool end_array()
+    {
+        depth--;
+        if (depth == 1)
+        {
+            inDataArray = false;
+        }
+        return true;
+    }
+    bool parse_error(std::size_t, const std::string&,
+                     const nlohmann::detail::exception&)
+    {
+        return false;
+    }
+
+    // Applies the same shape precedence the DOM walk used: root-level keys
+    // win outright when both are present, otherwise a two-element data
+    // array (phosphor-rest), otherwise a data object.
+    void select(std::string_view& username, std::string_view& password,
+                bool& looksLikePhosphorRest)
+    {
+        if (rootUserSeen && rootPassSeen)
+        {
+            if (rootUserIsString && rootPassIsString)
+            {
+                username = rootUser;
+                password = rootPass;
+            }
+            return;
+        }
+        if (!dataSeen)
+        {
+            return;
+        }
+        if (dataWasArray())
+        {
+            if (dataArraySize == 2)
+            {
+                looksLikePhosphorRest = true;
+                if (arrUserIsString && arrPassIsString)
+                {
+                    username = arrUser;
+                    password = arrPass;
+                }
+            }
+            return;
+        }
+        if (objUserIsString && objPassIsString)
+        {
+            username = objUser;
+            password = objPass;
+        }
+    }
+
+  private:
+    void countDataArrayElement()
+    {
+        if (inDataArray && depth == 2)
+        {
+            dataArraySize++;
+        }
+    }
+    bool dataWasArray() const
+    {
+        return sawDataArray;
+    }
+
+    size_t depth = 0;
+    std::string key1;
+    std::string key2;
+    bool inDataArray = false;
+    bool inDataObject = false;
+    bool dataSeen = false;
+    bool sawDataArray = false;
+    size_t dataArraySize = 0;
+    std::string rootUser;
+    std::string rootPass;
+    bool rootUserSeen = false;
+    bool rootPassSeen = false;
+    bool rootUserIsString = false;
+    bool rootPassIsString = false;
+    std::string arrUser;
+    std::string arrPass;
+    bool arrUserIsString = false;
+    bool arrPassIsString = false;
+    std::string objUser;
+    std::string objPass;
+    bool objUserIsString = false;
+    bool objPassIsString = false;
+};
+
 inline void requestRoutes(App& app)
 {
     BMCWEB_ROUTE(app, "/login")
+        .bodyLimit(4096)
         .methods(
             boost::beast::http::verb::
                 post)([](const crow::Request& req,
@@ -33,95 +271,18 @@ inline void requestRoutes(App& app)
 
             // This object needs to be declared at this scope so the strings
             // within it are not destroyed before we can use them
-            nlohmann::json loginCredentials;
+            CredentialExtractor extractor;
             // Check if auth was provided by a payload
             if (boost::starts_with(contentType, "application/json"))
             {
-                loginCredentials =
-                    nlohmann::json::parse(req.body, nullptr, false);
-                if (loginCredentials.is_discarded())
+                if (!nlohmann::json::sax_parse(req.body, &extractor))
                 {
                     BMCWEB_LOG_DEBUG << "Bad json in request";
                     asyncResp->res.result(
                         boost::beast::http::status::bad_request);
                     return;
                 }
-
-                // check for username/password in the root object
-                // THis method is how intel APIs authenticate
-                nlohmann::json::iterator userIt =
-                    loginCredentials.find("username");
-                nlohmann::json::iterator passIt =
-                    loginCredentials.find("password");
-                if (userIt != loginCredentials.end() &&
-                    passIt != loginCredentials.end())
-                {
-                    const std::string* userStr =
-                        userIt->get_ptr<const std::string*>();
-                    const std::string* passStr =
-                        passIt->get_ptr<const std::string*>();
-                    if (userStr != nullptr && passStr != nullptr)
-                    {
-                        username = *userStr;
-                        password = *passStr;
-                    }
-                }
-                else
-                {
-                    // Openbmc appears to push a data object that contains the
-                    // same keys (username and password), attempt to use that
-                    auto dataIt = loginCredentials.find("data");
-                    if (dataIt != loginCredentials.end())
-                    {
-                        // Some apis produce an array of value ["username",
-                        // "password"]
-                        if (dataIt->is_array())
-                        {
-                            if (dataIt->size() == 2)
-                            {
-                                nlohmann::json::iterator userIt2 =
-                                    dataIt->begin();
-                                nlohmann::json::iterator passIt2 =
-                                    dataIt->begin() + 1;
-                                looksLikePhosphorRest = true;
-                                if (userIt2 != dataIt->end() &&
-                                    passIt2 != dataIt->end())
-                                {
-                                    const std::string* userStr =
-                                        userIt2->get_ptr<const std::string*>();
-                                    const std::string* passStr =
-                                        passIt2->get_ptr<const std::string*>();
-                                    if (userStr != nullptr &&
-                                        passStr != nullptr)
-                                    {
-                                        username = *userStr;
-                                        password = *passStr;
-                                    }
-                                }
-                            }
-                        }
-                        else if (dataIt->is_object())
-                        {
-                            nlohmann::json::iterator userIt2 =
-                                dataIt->find("username");
-                            nlohmann::json::iterator passIt2 =
-                                dataIt->find("password");
-                            if (userIt2 != dataIt->end() &&
-                                passIt2 != dataIt->end())
-                            {
-                                const std::string* userStr =
-                                    userIt2->get_ptr<const std::string*>();
-                                const std::string* passStr =
-                                    passIt2->get_ptr<const std::string*>();
-                                if (userStr != nullptr && passStr != nullptr)
-                                {
-                                    username = *userStr;
-                                    password = *passStr;
-                                }
-                            }
-                        }
-                    }
-                }
+                extractor.select(username, password, looksLikePhosphorRest);
             }
             else if (boost::starts_with(contentType, "multipart/form-data"))
             {
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace crow
+{
+namespace memory_diag
+{
+
+// Per-subsystem memory attribution.  Owners register a sampler that
+// reports their current resident bytes; samplers run only when the
+// diagnostics route is scraped, so steady-state cost is zero, and
+// continuously counted tags (the connection slab pool) use relaxed
+// atomics.  When RSS climbs on a long-lived system, one GET names the
+// subsystem holding the bytes.
+class MemoryDiagnostics
+{
+  public:
+    using Sampler = std::function<uint64_t()>;
+
+    static MemoryDiagnostics& getInstance()
+    {
+        static MemoryDiagnostics diag;
+        return diag;
+    }
+
+    void registerSampler(const std::string& tag, Sampler&& sampler)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        samplers[tag] = std::move(sampler);
+    }
+
+    nlohmann::json sample()
+    {
+        nlohmann::json result;
+        std::map<std::string, Sampler> copy;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            copy = samplers;
+        }
+        uint64_t total = 0;
+        for (const auto& [tag, sampler] : copy)
+        {
+            uint64_t bytes = sampler();
+            result[tag] = bytes;
+            total += bytes;
+        }
+        result["total_tracked"] = total;
+        return result;
+    }
+
+  private:
+    MemoryDiagnostics() = default;
+
+    std::map<std::string, Sampler> samplers;
+    std::mutex mutex;
+};
+
+} // namespace memory_diag
+} // namespace crow
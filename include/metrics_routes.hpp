@@ -0,0 +1,82 @@
+#pragma once
+
+#include <app.hpp>
+#include <async_resp.hpp>
+#include <dbus_utility.hpp>
+#include <event_service_manager.hpp>
+#include <memory_diagnostics.hpp>
+#include <metrics.hpp>
+#include <qos.hpp>
+#include <rate_limiter.hpp>
+#include <sessions.hpp>
+
+#include <buffer_pool.hpp>
+
+namespace crow
+{
+namespace metrics_routes
+{
+
+// Wires the owners into the diagnostics registry once, at route setup
+inline void registerMemorySamplers()
+{
+    memory_diag::MemoryDiagnostics& diag =
+        memory_diag::MemoryDiagnostics::getInstance();
+    diag.registerSampler("session_store", []() {
+        return persistent_data::SessionStore::getInstance().memoryFootprint();
+    });
+    diag.registerSampler("event_service", []() {
+        return redfish::EventServiceManager::getInstance().memoryFootprint();
+    });
+    diag.registerSampler("dbus_mapper_cache", []() {
+        return dbus::utility::MapperCache::getInstance().memoryFootprint();
+    });
+    diag.registerSampler("dbus_object_snapshots", []() {
+        return dbus::utility::ManagedObjectsCache::getInstance()
+            .memoryFootprint();
+    });
+    diag.registerSampler("connection_slabs", []() {
+        return detail::ConnectionSlab::liveSlabCount.load(
+                   std::memory_order_relaxed) *
+               sizeof(detail::ConnectionSlab);
+    });
+}
+
+inline void requestRoutes(App& app)
+{
+    registerMemorySamplers();
+
+    BMCWEB_ROUTE(app, "/metrics")
+        .privileges({{"Login"}})
+        .methods(boost::beast::http::verb::get)(
+            [](const crow::Request&,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                asyncResp->res.addHeader("Content-Type",
+                                         "text/plain; version=0.0.4");
+                std::string body =
+                    metrics::RequestMetrics::getInstance().serialize();
+                body += "bmcweb_rate_limited_total ";
+                body += std::to_string(rate_limit::RateLimiter::getInstance()
+                                           .getRejectedCount());
+                body += '\n';
+                body += "bmcweb_qos_bulk_shed_total ";
+                body += std::to_string(
+                    qos::RequestScheduler::getInstance().getShedCount());
+                body += '\n';
+                asyncResp->res.body() = std::move(body);
+            });
+
+    // Per-subsystem memory attribution; samplers walk their owners only
+    // when this is scraped
+    BMCWEB_ROUTE(app, "/diagnostics/memory")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::get)(
+            [](const crow::Request&,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                asyncResp->res.jsonValue =
+                    memory_diag::MemoryDiagnostics::getInstance().sample();
+            });
+}
+
+} // namespace metrics_routes
+} // namespace crow
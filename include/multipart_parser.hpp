@@ -479,6 +479,10 @@ class MultipartParser
                 case State::PART_DATA_START:
                     state = State::PART_DATA;
                     partDataMark = i;
+                    // Uploads are dominated by one large file part; reserve
+                    // the remaining body up front so content grows without
+                    // repeatedly reallocating a multi-megabyte string.
+                    mime_fields.rbegin()->content.reserve(len - i);
                     [[fallthrough]];
                 case State::PART_DATA:
                     processPartData(prevIndex, index, buffer, len,
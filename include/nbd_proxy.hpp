@@ -150,9 +150,12 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             return;
         }
 
-        // Trigger async read
+        // Read straight into the string handed to the websocket layer; the
+        // block is moved, not copied, into the send queue, keeping the NBD
+        // pipeline full without an intermediate buffer pass
+        ux2wsBuf.resize(nbdBufferSize);
         peerSocket->async_read_some(
-            ux2wsBuf.prepare(nbdBufferSize),
+            boost::asio::buffer(ux2wsBuf),
             [this, self(shared_from_this())](boost::system::error_code ec,
                                              std::size_t bytesRead) {
                 if (ec)
@@ -165,14 +168,10 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
                     return;
                 }
 
-                // Fetch data from UNIX socket
-
-                ux2wsBuf.commit(bytesRead);
-
                 // Paste it to WebSocket as binary
-                connection.sendBinary(
-                    boost::beast::buffers_to_string(ux2wsBuf.data()));
-                ux2wsBuf.consume(bytesRead);
+                ux2wsBuf.resize(bytesRead);
+                connection.sendBinary(std::move(ux2wsBuf));
+                ux2wsBuf = {};
 
                 // Allow further reads
                 doRead();
@@ -229,8 +228,9 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
 
     bool uxWriteInProgress = false;
 
-    // UNIX => WebSocket buffer
-    boost::beast::multi_buffer ux2wsBuf;
+    // UNIX => WebSocket buffer; handed off wholesale to the websocket send
+    // queue after each read
+    std::string ux2wsBuf;
 
     // WebSocket <= UNIX buffer
     boost::beast::multi_buffer ws2uxBuf;
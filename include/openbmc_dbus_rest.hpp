@@ -67,6 +67,196 @@ inline void setErrorResponse(crow::Response& res,
                      {"status", "error"}};
 }
 
+// Parsed-introspection cache.  The recursive walks behind the bus listing
+// endpoints re-introspect the same (service, path) nodes with a tinyxml2
+// parse on every request; cache the extracted child names instead, and drop
+// a service's entries when NameOwnerChanged says its objects may have moved.
+class IntrospectionCache
+{
+  public:
+    static IntrospectionCache& getInstance()
+    {
+        static IntrospectionCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void getChildNames(const std::string& processName,
+                       const std::string& objectPath, Callback&& callback)
+    {
+        std::string key = processName + '\x01' + objectPath;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            auto it = children.find(key);
+            if (it != children.end())
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     childNames{it->second}]() mutable {
+                        callback(boost::system::error_code(), childNames);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, key{std::move(key)}, processName,
+             callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const std::string& introspectXml) mutable {
+                std::vector<std::string> childNames;
+                if (!ec)
+                {
+                    tinyxml2::XMLDocument doc;
+                    doc.Parse(introspectXml.c_str());
+                    tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
+                    if (pRoot == nullptr)
+                    {
+                        BMCWEB_LOG_ERROR << "XML document failed to parse "
+                                         << processName << "\n";
+                    }
+                    else
+                    {
+                        tinyxml2::XMLElement* node =
+                            pRoot->FirstChildElement("node");
+                        while (node != nullptr)
+                        {
+                            const char* childPath = node->Attribute("name");
+                            if (childPath != nullptr)
+                            {
+                                childNames.emplace_back(childPath);
+                            }
+                            node = node->NextSiblingElement("node");
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    children.emplace(key, childNames);
+                }
+                callback(ec, childNames);
+            },
+            processName, objectPath, "org.freedesktop.DBus.Introspectable",
+            "Introspect");
+    }
+
+    // Raw-XML variant for callers that need the full interface/method
+    // detail.  Parameter order mirrors async_method_call so call sites
+    // convert by swapping the call head and dropping the trailing
+    // Introspectable arguments.
+    template <typename Callback>
+    void getIntrospectXml(Callback&& callback, const std::string& processName,
+                          const std::string& objectPath)
+    {
+        std::string key = processName + '\x01' + objectPath;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            auto it = rawXml.find(key);
+            if (it != rawXml.end())
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     xml{it->second}]() mutable {
+                        callback(boost::system::error_code(), xml);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, key{std::move(key)},
+             callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const std::string& introspectXml) mutable {
+                if (!ec)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    rawXml.emplace(key, introspectXml);
+                }
+                callback(ec, introspectXml);
+            },
+            processName, objectPath, "org.freedesktop.DBus.Introspectable",
+            "Introspect");
+    }
+
+  private:
+    IntrospectionCache() = default;
+
+    // Lazily registered after the system bus exists; callers hold the mutex
+    void ensureSubscribed()
+    {
+        if (nameOwnerChangedMatch)
+        {
+            return;
+        }
+        nameOwnerChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',sender='org.freedesktop.DBus',"
+            "interface='org.freedesktop.DBus',member='NameOwnerChanged'",
+            [this](sdbusplus::message::message& msg) {
+                std::string name;
+                try
+                {
+                    msg.read(name);
+                }
+                catch (const std::exception&)
+                {
+                    return;
+                }
+                const std::string prefix = name + '\x01';
+                std::lock_guard<std::mutex> lock(mutex);
+                auto it = children.begin();
+                while (it != children.end())
+                {
+                    if (it->first.compare(0, prefix.size(), prefix) == 0)
+                    {
+                        it = children.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                auto xmlIt = rawXml.begin();
+                while (xmlIt != rawXml.end())
+                {
+                    if (xmlIt->first.compare(0, prefix.size(), prefix) == 0)
+                    {
+                        xmlIt = rawXml.erase(xmlIt);
+                    }
+                    else
+                    {
+                        ++xmlIt;
+                    }
+                }
+            });
+        // Objects can also come and go while a service stays connected;
+        // drop everything when the object topology changes anywhere.
+        auto invalidateAll = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            children.clear();
+            rawXml.clear();
+        };
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded'",
+            invalidateAll);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved'",
+            invalidateAll);
+    }
+
+    std::unordered_map<std::string, std::vector<std::string>> children;
+    std::unordered_map<std::string, std::string> rawXml;
+    std::optional<sdbusplus::bus::match::match> nameOwnerChangedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::mutex mutex;
+};
+
 inline void
     introspectObjects(const std::string& processName,
                       const std::string& objectPath,
@@ -79,11 +269,11 @@ inline void
                                       {"objects", nlohmann::json::array()}};
     }
 
-    crow::connections::systemBus->async_method_call(
-        [transaction, processName{std::string(processName)},
-         objectPath{std::string(objectPath)}](
+    IntrospectionCache::getInstance().getChildNames(
+        processName, objectPath,
+        [transaction, processName, objectPath](
             const boost::system::error_code ec,
-            const std::string& introspectXml) {
+            const std::vector<std::string>& childNames) {
             if (ec)
             {
                 BMCWEB_LOG_ERROR
@@ -95,39 +285,18 @@ inline void
             transaction->res.jsonValue["objects"].push_back(
                 {{"path", objectPath}});
 
-            tinyxml2::XMLDocument doc;
-
-            doc.Parse(introspectXml.c_str());
-            tinyxml2::XMLNode* pRoot = doc.FirstChildElement("node");
-            if (pRoot == nullptr)
-            {
-                BMCWEB_LOG_ERROR << "XML document failed to parse "
-                                 << processName << " " << objectPath << "\n";
-            }
-            else
+            for (const std::string& childPath : childNames)
             {
-                tinyxml2::XMLElement* node = pRoot->FirstChildElement("node");
-                while (node != nullptr)
+                std::string newpath;
+                if (objectPath != "/")
                 {
-                    const char* childPath = node->Attribute("name");
-                    if (childPath != nullptr)
-                    {
-                        std::string newpath;
-                        if (objectPath != "/")
-                        {
-                            newpath += objectPath;
-                        }
-                        newpath += std::string("/") + childPath;
-                        // introspect the subobjects as well
-                        introspectObjects(processName, newpath, transaction);
-                    }
-
-                    node = node->NextSiblingElement("node");
+                    newpath += objectPath;
                 }
+                newpath += std::string("/") + childPath;
+                // introspect the subobjects as well
+                introspectObjects(processName, newpath, transaction);
             }
-        },
-        processName, objectPath, "org.freedesktop.DBus.Introspectable",
-        "Introspect");
+        });
 }
 
 inline void getPropertiesForEnumerate(
@@ -1314,7 +1483,7 @@ inline void findActionOnInterface(
 {
     BMCWEB_LOG_DEBUG << "findActionOnInterface for connection "
                      << connectionName;
-    crow::connections::systemBus->async_method_call(
+    IntrospectionCache::getInstance().getIntrospectXml(
         [transaction, connectionName{std::string(connectionName)}](
             const boost::system::error_code ec,
             const std::string& introspectXml) {
@@ -1471,8 +1640,7 @@ inline void findActionOnInterface(
                 interfaceNode = interfaceNode->NextSiblingElement("interface");
             }
         },
-        connectionName, transaction->path,
-        "org.freedesktop.DBus.Introspectable", "Introspect");
+        connectionName, transaction->path);
 }
 
 inline void handleAction(const crow::Request& req,
@@ -1609,6 +1777,10 @@ inline void handleEnumerate(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
 {
     BMCWEB_LOG_DEBUG << "Doing enumerate on " << objectPath;
 
+    // Enumerates can return arbitrarily large trees; stream the serialized
+    // json instead of buffering one full dump() string.
+    asyncResp->res.enableJsonStreaming();
+
     asyncResp->res.jsonValue = {{"message", "200 OK"},
                                 {"status", "ok"},
                                 {"data", nlohmann::json::object()}};
@@ -1839,7 +2011,7 @@ inline void handlePut(const crow::Request& req,
             {
                 const std::string& connectionName = connection.first;
 
-                crow::connections::systemBus->async_method_call(
+                IntrospectionCache::getInstance().getIntrospectXml(
                     [connectionName{std::string(connectionName)},
                      transaction](const boost::system::error_code ec3,
                                   const std::string& introspectXml) {
@@ -1978,8 +2150,7 @@ inline void handlePut(const crow::Request& req,
                                 ifaceNode->NextSiblingElement("interface");
                         }
                     },
-                    connectionName, transaction->objectPath,
-                    "org.freedesktop.DBus.Introspectable", "Introspect");
+                    connectionName, transaction->objectPath);
             }
         },
         "xyz.openbmc_project.ObjectMapper",
@@ -2294,7 +2465,7 @@ inline void requestRoutes(App& app)
                 }
                 if (interfaceName.empty())
                 {
-                    crow::connections::systemBus->async_method_call(
+                    IntrospectionCache::getInstance().getIntrospectXml(
                         [asyncResp, processName,
                          objectPath](const boost::system::error_code ec,
                                      const std::string& introspectXml) {
@@ -2350,12 +2521,11 @@ inline void requestRoutes(App& app)
                                     interface->NextSiblingElement("interface");
                             }
                         },
-                        processName, objectPath,
-                        "org.freedesktop.DBus.Introspectable", "Introspect");
+                        processName, objectPath);
                 }
                 else if (methodName.empty())
                 {
-                    crow::connections::systemBus->async_method_call(
+                    IntrospectionCache::getInstance().getIntrospectXml(
                         [asyncResp, processName, objectPath,
                          interfaceName](const boost::system::error_code ec,
                                         const std::string& introspectXml) {
@@ -2547,8 +2717,7 @@ inline void requestRoutes(App& app)
                                     property->NextSiblingElement("property");
                             }
                         },
-                        processName, objectPath,
-                        "org.freedesktop.DBus.Introspectable", "Introspect");
+                        processName, objectPath);
                 }
                 else
                 {
@@ -1,11 +1,117 @@
 #pragma once
 
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
 #include <security/pam_appl.h>
 
 #include <boost/utility/string_view.hpp>
 
+#include <array>
+#include <chrono>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Caches successful PAM verifications so steady-state Basic auth costs one
+// salted-hash compare instead of a full PAM conversation through /etc/shadow
+// hashing.  Entries hold a salted SHA256 of the credentials, expire after a
+// short TTL, and are dropped eagerly when the account is modified or removed.
+class PamAuthenticationCache
+{
+  public:
+    static PamAuthenticationCache& getInstance()
+    {
+        static PamAuthenticationCache cache;
+        return cache;
+    }
+
+    bool isValid(const std::string_view username,
+                 const std::string_view password)
+    {
+        std::array<unsigned char, SHA256_DIGEST_LENGTH> digest{};
+        if (!hashCredentials(username, password, digest))
+        {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(std::string(username));
+        if (it == entries.end())
+        {
+            return false;
+        }
+        if (std::chrono::steady_clock::now() >= it->second.expires)
+        {
+            entries.erase(it);
+            return false;
+        }
+        return CRYPTO_memcmp(digest.data(), it->second.digest.data(),
+                             digest.size()) == 0;
+    }
+
+    void store(const std::string_view username,
+               const std::string_view password)
+    {
+        Entry entry;
+        if (!hashCredentials(username, password, entry.digest))
+        {
+            return;
+        }
+        entry.expires = std::chrono::steady_clock::now() + entryTtl;
+        std::lock_guard<std::mutex> lock(mutex);
+        entries[std::string(username)] = entry;
+    }
+
+    void invalidate(const std::string_view username)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.erase(std::string(username));
+    }
+
+  private:
+    PamAuthenticationCache()
+    {
+        saltValid =
+            RAND_bytes(salt.data(), static_cast<int>(salt.size())) == 1;
+    }
+
+    static constexpr std::chrono::seconds entryTtl{30};
+
+    struct Entry
+    {
+        std::array<unsigned char, SHA256_DIGEST_LENGTH> digest{};
+        std::chrono::time_point<std::chrono::steady_clock> expires;
+    };
+
+    bool hashCredentials(
+        const std::string_view username, const std::string_view password,
+        std::array<unsigned char, SHA256_DIGEST_LENGTH>& digest) const
+    {
+        if (!saltValid)
+        {
+            // Without a salt the cache would be a plain password-hash store;
+            // stay disabled and let every request go through PAM.
+            return false;
+        }
+        SHA256_CTX ctx;
+        SHA256_Init(&ctx);
+        SHA256_Update(&ctx, salt.data(), salt.size());
+        SHA256_Update(&ctx, username.data(), username.size());
+        constexpr char separator = '\0';
+        SHA256_Update(&ctx, &separator, sizeof(separator));
+        SHA256_Update(&ctx, password.data(), password.size());
+        SHA256_Final(digest.data(), &ctx);
+        return true;
+    }
+
+    std::array<unsigned char, 16> salt{};
+    bool saltValid = false;
+    std::unordered_map<std::string, Entry> entries;
+    std::mutex mutex;
+};
 
 // function used to get user input
 inline int pamFunctionConversation(int numMsg, const struct pam_message** msg,
@@ -73,6 +179,10 @@ inline int pamFunctionConversation(int numMsg, const struct pam_message** msg,
 inline int pamAuthenticateUser(const std::string_view username,
                                const std::string_view password)
 {
+    if (PamAuthenticationCache::getInstance().isValid(username, password))
+    {
+        return PAM_SUCCESS;
+    }
     std::string userStr(username);
     std::string passStr(password);
     const struct pam_conv localConversation = {
@@ -102,7 +212,12 @@ inline int pamAuthenticateUser(const std::string_view username,
         return retval;
     }
 
-    return pam_end(localAuthHandle, PAM_SUCCESS);
+    retval = pam_end(localAuthHandle, PAM_SUCCESS);
+    if (retval == PAM_SUCCESS)
+    {
+        PamAuthenticationCache::getInstance().store(username, password);
+    }
+    return retval;
 }
 
 inline int pamUpdatePassword(const std::string& username,
@@ -127,5 +242,6 @@ inline int pamUpdatePassword(const std::string& username,
         return retval;
     }
 
+    PamAuthenticationCache::getInstance().invalidate(username);
     return pam_end(localAuthHandle, PAM_SUCCESS);
 }
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <logging.hpp>
+#include <registries.hpp>
+#include <registries/base_message_registry.hpp>
+#include <routing.hpp>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace crow
+{
+namespace perf_canary
+{
+
+// On-target performance canary: shortly after startup, run a fixed
+// micro-workload and log one machine-readable line for fleet tooling to
+// scrape from the journal.  A firmware build that regresses route
+// dispatch, serialization, registry resolution or the TLS/HTTP stack
+// shows up on the first boot of the first machine, not in fleet
+// percentiles days later.  The loopback probe runs in its own thread with
+// its own io_context so its synchronous socket calls never block the
+// serving loop; an unauthenticated 401 is the expected answer and still
+// times the full TLS + parse + route + serialize path.
+
+inline uint64_t timeRouteDispatchBatch()
+{
+    crow::Trie trie;
+    trie.add("/redfish/v1/", 1);
+    trie.add("/redfish/v1/Systems/system/", 2);
+    trie.add("/redfish/v1/Chassis/<str>/Thermal/", 3);
+    trie.add("/redfish/v1/Managers/bmc/LogServices/Journal/Entries/", 4);
+    trie.add("/redfish/v1/TelemetryService/MetricReports/<str>/", 5);
+    trie.validate();
+    auto start = std::chrono::steady_clock::now();
+    size_t matched = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        matched += trie.find("/redfish/v1/").first;
+        matched += trie.find("/redfish/v1/Chassis/chassis1/Thermal/").first;
+        matched += trie.find("/redfish/v1/TelemetryService/MetricReports/r1/")
+                       .first;
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (matched == 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count());
+}
+
+inline uint64_t timeJsonSerialize()
+{
+    nlohmann::json doc;
+    nlohmann::json& members = doc["Temperatures"];
+    members = nlohmann::json::array();
+    for (int i = 0; i < 50; i++)
+    {
+        members.push_back(
+            {{"@odata.id",
+              "/redfish/v1/Chassis/chassis/Thermal#/Temperatures/" +
+                  std::to_string(i)},
+             {"ReadingCelsius", 25.5 + i},
+             {"MemberId", std::to_string(i)},
+             {"Status", {{"State", "Enabled"}, {"Health", "OK"}}}});
+    }
+    auto start = std::chrono::steady_clock::now();
+    size_t total = 0;
+    for (int i = 0; i < 50; i++)
+    {
+        total += doc.dump(2, ' ', true,
+                          nlohmann::json::error_handler_t::replace)
+                     .size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (total == 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count());
+}
+
+inline uint64_t timeRegistryLookup()
+{
+    boost::beast::span<const redfish::message_registries::MessageEntry>
+        registry(redfish::message_registries::base::registry.data(),
+                 redfish::message_registries::base::registry.size());
+    auto start = std::chrono::steady_clock::now();
+    size_t found = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        if (redfish::message_registries::findMessage(registry,
+                                                    "ResourceNotFound") !=
+            nullptr)
+        {
+            found++;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (found == 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+            .count());
+}
+
+// Full-stack probe: one HTTPS request to ourselves.  Expected answer for
+// an unauthenticated GET is 401, which still exercises TLS handshake,
+// parse, routing and serialization.
+inline uint64_t timeLoopbackHttps(uint16_t port)
+{
+    try
+    {
+        boost::asio::io_context probeIo;
+        boost::asio::ssl::context tlsCtx(
+            boost::asio::ssl::context::tls_client);
+        tlsCtx.set_verify_mode(boost::asio::ssl::verify_none);
+        boost::asio::ssl::stream<boost::asio::ip::tcp::socket> stream(
+            probeIo, tlsCtx);
+        boost::asio::ip::tcp::endpoint endpoint(
+            boost::asio::ip::make_address("127.0.0.1"), port);
+
+        auto start = std::chrono::steady_clock::now();
+        stream.next_layer().connect(endpoint);
+        stream.handshake(boost::asio::ssl::stream_base::client);
+        const std::string request = "GET /redfish/v1/ HTTP/1.1\r\n"
+                                    "Host: localhost\r\n"
+                                    "Connection: close\r\n\r\n";
+        boost::asio::write(stream, boost::asio::buffer(request));
+        std::string response;
+        boost::system::error_code ec;
+        std::array<char, 4096> chunk{};
+        while (true)
+        {
+            size_t bytesRead =
+                stream.read_some(boost::asio::buffer(chunk), ec);
+            if (ec)
+            {
+                break;
+            }
+            response.append(chunk.data(), bytesRead);
+        }
+        auto end = std::chrono::steady_clock::now();
+        if (response.find("HTTP/1.1") != 0)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                .count());
+    }
+    catch (const std::exception& e)
+    {
+        BMCWEB_LOG_ERROR << "perf canary loopback probe failed: " << e.what();
+        return 0;
+    }
+}
+
+// The port the probe should dial: under systemd socket activation the
+// listener was inherited, so ask the fd itself rather than assuming the
+// compile-time default.
+inline uint16_t resolveListeningPort(bool socketActivated, int inheritedFd,
+                                     uint16_t fallback)
+{
+    if (!socketActivated)
+    {
+        return fallback;
+    }
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    if (getsockname(inheritedFd, reinterpret_cast<sockaddr*>(&addr), &len) !=
+        0)
+    {
+        return fallback;
+    }
+    if (addr.ss_family == AF_INET)
+    {
+        return ntohs(reinterpret_cast<sockaddr_in*>(&addr)->sin_port);
+    }
+    if (addr.ss_family == AF_INET6)
+    {
+        return ntohs(reinterpret_cast<sockaddr_in6*>(&addr)->sin6_port);
+    }
+    return fallback;
+}
+
+// Schedules the canary a few seconds after startup.  The dispatch and
+// serialization legs run on the probe thread (their state is all local),
+// but the registry leg posts to the primary io_context and is awaited:
+// findMessage's lazily built index is deliberately unsynchronized and
+// relies on everything running there - boot-time event formatting races
+// it otherwise.  Logged at error level so the line survives the
+// production log level; zero values mean the leg failed.
+inline void schedule(boost::asio::io_context& io, uint16_t httpsPort)
+{
+    auto timer = std::make_shared<boost::asio::steady_timer>(io);
+    timer->expires_after(std::chrono::seconds(10));
+    timer->async_wait([timer, &io,
+                       httpsPort](const boost::system::error_code& ec) {
+        if (ec)
+        {
+            return;
+        }
+        std::thread([&io, httpsPort]() {
+            uint64_t routeUs = timeRouteDispatchBatch();
+            uint64_t jsonUs = timeJsonSerialize();
+            auto registryResult = std::make_shared<std::promise<uint64_t>>();
+            std::future<uint64_t> registryFuture =
+                registryResult->get_future();
+            boost::asio::post(io, [registryResult]() {
+                registryResult->set_value(timeRegistryLookup());
+            });
+            // Bounded wait so a stopped loop can't hang the probe thread
+            uint64_t registryUs = 0;
+            if (registryFuture.wait_for(std::chrono::seconds(30)) ==
+                std::future_status::ready)
+            {
+                registryUs = registryFuture.get();
+            }
+            uint64_t loopbackUs = timeLoopbackHttps(httpsPort);
+            BMCWEB_LOG_ERROR << "bmcweb-perf-canary:"
+                             << " route_dispatch_us=" << routeUs
+                             << " json_serialize_us=" << jsonUs
+                             << " registry_lookup_us=" << registryUs
+                             << " loopback_https_us=" << loopbackUs;
+        }).detach();
+    });
+}
+
+} // namespace perf_canary
+} // namespace crow
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <app.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/http/fields.hpp>
+#include <dbus_singleton.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <event_service_store.hpp>
+#include <runtime_config.hpp>
 #include <http_request.hpp>
 #include <http_response.hpp>
 #include <nlohmann/json.hpp>
@@ -31,6 +37,7 @@ class ConfigFile
     ConfigFile()
     {
         readData();
+        startFlushTimer();
     }
 
     ~ConfigFile()
@@ -79,6 +86,11 @@ class ConfigFile
                             fileRevision = *uintPtr;
                         }
                     }
+                    else if (item.key() == "runtime_tuning")
+                    {
+                        crow::runtime_config::RuntimeTuning::getInstance()
+                            .fromJson(item.value());
+                    }
                     else if (item.key() == "system_uuid")
                     {
                         const std::string* jSystemUuid =
@@ -112,8 +124,8 @@ class ConfigFile
                                 << "Restored session: " << newSession->csrfToken
                                 << " " << newSession->uniqueId << " "
                                 << newSession->sessionToken;
-                            SessionStore::getInstance().authTokens.emplace(
-                                newSession->sessionToken, newSession);
+                            SessionStore::getInstance().restoreSession(
+                                newSession);
                         }
                     }
                     else if (item.key() == "timeout")
@@ -193,14 +205,17 @@ class ConfigFile
 
     void writeData()
     {
-        std::ofstream persistentFile(filename);
+        // Written to a temp file, synced, then renamed over the old store so
+        // a crash mid-write never leaves a truncated file behind
+        const std::string tmpname = std::string(filename) + ".tmp";
+        std::ofstream persistentFile(tmpname);
 
         // set the permission of the file to 640
         std::filesystem::perms permission =
             std::filesystem::perms::owner_read |
             std::filesystem::perms::owner_write |
             std::filesystem::perms::group_read;
-        std::filesystem::permissions(filename, permission);
+        std::filesystem::permissions(tmpname, permission);
         const auto& c = SessionStore::getInstance().getAuthMethodsConfig();
         const auto& eventServiceConfig =
             EventServiceStore::getInstance().getEventServiceConfig();
@@ -222,23 +237,26 @@ class ConfigFile
             },
             {"system_uuid", systemUuid},
             {"revision", jsonRevision},
+            {"runtime_tuning",
+             crow::runtime_config::RuntimeTuning::getInstance().toJson()},
             {"timeout", SessionStore::getInstance().getTimeoutInSeconds()}};
 
         nlohmann::json& sessions = data["sessions"];
         sessions = nlohmann::json::array();
-        for (const auto& p : SessionStore::getInstance().authTokens)
+        for (const std::shared_ptr<UserSession>& p :
+             SessionStore::getInstance().getSessions())
         {
-            if (p.second->persistence !=
+            if (p->persistence !=
                 persistent_data::PersistenceType::SINGLE_REQUEST)
             {
                 sessions.push_back({
-                    {"unique_id", p.second->uniqueId},
-                    {"session_token", p.second->sessionToken},
-                    {"username", p.second->username},
-                    {"csrf_token", p.second->csrfToken},
-                    {"client_ip", p.second->clientIp},
+                    {"unique_id", p->uniqueId},
+                    {"session_token", p->sessionToken},
+                    {"username", p->username},
+                    {"csrf_token", p->csrfToken},
+                    {"client_ip", p->clientIp},
 #ifdef BMCWEB_ENABLE_IBM_MANAGEMENT_CONSOLE
-                    {"client_id", p.second->clientId},
+                    {"client_id", p->clientId},
 #endif
                 });
             }
@@ -280,12 +298,69 @@ class ConfigFile
                 {"ResourceTypes", subValue->resourceTypes},
                 {"SubscriptionType", subValue->subscriptionType},
                 {"MetricReportDefinitions", subValue->metricReportDefinitions},
+                {"IncludeDeltaPayload", subValue->includeDeltaPayload},
             });
         }
         persistentFile << data;
+        persistentFile.close();
+
+        int fd = open(tmpname.c_str(), O_RDONLY); // NOLINT
+        if (fd >= 0)
+        {
+            fdatasync(fd);
+            close(fd);
+        }
+        std::error_code renameEc;
+        std::filesystem::rename(tmpname, filename, renameEc);
+        if (renameEc)
+        {
+            BMCWEB_LOG_ERROR << "Failed to persist " << filename << ": "
+                             << renameEc.message();
+            return;
+        }
+
+        // Everything marked dirty is on disk now; the flush timer can idle
+        SessionStore::getInstance().needWrite = false;
+        EventServiceStore::getInstance().needWrite = false;
+
+        startFlushTimer();
+    }
+
+    // Group-commit batching: session churn only marks the stores dirty; this
+    // timer folds bursts of logins into at most one flash write per window
+    // instead of rewriting the store per change or only at shutdown.
+    void startFlushTimer()
+    {
+        if (flushTimer || crow::connections::systemBus == nullptr)
+        {
+            return;
+        }
+        flushTimer.emplace(crow::connections::systemBus->get_io_context());
+        scheduleFlush();
     }
 
     std::string systemUuid{""};
+
+  private:
+    void scheduleFlush()
+    {
+        flushTimer->expires_after(flushInterval);
+        flushTimer->async_wait([this](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                return;
+            }
+            if (SessionStore::getInstance().needsWrite() ||
+                EventServiceStore::getInstance().needsWrite())
+            {
+                writeData();
+            }
+            scheduleFlush();
+        });
+    }
+
+    static constexpr std::chrono::seconds flushInterval{10};
+    std::optional<boost::asio::steady_timer> flushTimer;
 };
 
 inline ConfigFile& getConfig()
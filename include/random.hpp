@@ -1,17 +1,101 @@
 #pragma once
 
 #include <openssl/rand.h>
+#include <pthread.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <limits>
 
 namespace bmcweb
 {
 
+// Bumped in the child after every fork(); pools filled before the fork
+// notice the mismatch and refill, so parent and child can never hand out
+// the same bytes.  A pid check per byte would cost a syscall; this is one
+// relaxed atomic load.
+inline std::atomic<uint64_t>& forkGeneration()
+{
+    static std::atomic<uint64_t> generation{0};
+    return generation;
+}
+
+inline void watchForkOnce()
+{
+    static int registered = pthread_atfork(nullptr, nullptr, []() {
+        forkGeneration().fetch_add(1, std::memory_order_relaxed);
+    });
+    (void)registered;
+}
+
+// Buffered CSPRNG pool: RAND_bytes refills a 4KB block and single bytes are
+// handed out from it, so token and unique-ID generation is a memory read
+// per character instead of a DRBG invocation per character.  The pool is
+// thread_local, which keeps it lock-free across reactors.  Handed-out
+// bytes are zeroed in place, and draining the block naturally re-enters
+// RAND_bytes, which is also the reseed hook - OpenSSL folds fresh entropy
+// in on its own schedule underneath.
+class RandomPool
+{
+  public:
+    static RandomPool& getInstance()
+    {
+        static thread_local RandomPool pool;
+        return pool;
+    }
+
+    bool get(uint8_t& out)
+    {
+        if (offset >= buffer.size() ||
+            filledAtGeneration !=
+                forkGeneration().load(std::memory_order_relaxed))
+        {
+            if (!refill())
+            {
+                return false;
+            }
+        }
+        out = buffer[offset];
+        buffer[offset] = 0;
+        offset++;
+        return true;
+    }
+
+    RandomPool(const RandomPool&) = delete;
+    RandomPool& operator=(const RandomPool&) = delete;
+
+  private:
+    RandomPool() = default;
+
+    bool refill()
+    {
+        watchForkOnce();
+        // RAND_bytes() returns 1 on success, 0 otherwise. -1 if bad function
+        int rc = RAND_bytes(buffer.data(), buffer.size());
+        if (rc != opensslSuccess)
+        {
+            return false;
+        }
+        filledAtGeneration = forkGeneration().load(std::memory_order_relaxed);
+        offset = 0;
+        return true;
+    }
+
+    static constexpr int opensslSuccess = 1;
+
+    std::array<uint8_t, 4096> buffer{};
+    size_t offset = buffer.size();
+    uint64_t filledAtGeneration = 0;
+};
+
 struct OpenSSLGenerator
 {
     uint8_t operator()()
     {
         uint8_t index = 0;
-        int rc = RAND_bytes(&index, sizeof(index));
-        if (rc != opensslSuccess)
+        if (!RandomPool::getInstance().get(index))
         {
             std::cerr << "Cannot get random number\n";
             err = true;
@@ -38,8 +122,6 @@ struct OpenSSLGenerator
     using result_type = uint8_t;
 
   private:
-    // RAND_bytes() returns 1 on success, 0 otherwise. -1 if bad function
-    static constexpr int opensslSuccess = 1;
     bool err = false;
 };
 
@@ -13,6 +13,7 @@ namespace redfish
 inline void requestRoutes(App& app)
 {
     BMCWEB_ROUTE(app, "/redfish/")
+        .immutable()
         .methods(boost::beast::http::verb::get)(
             [](const crow::Request&,
                const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace crow
+{
+namespace runtime_config
+{
+
+// Live-tunable performance knobs.  Compile-time options stay the defaults,
+// but sites tune per-workload without reflashing: values are plain atomics
+// read relaxed on the hot paths (independent scalars need no snapshot
+// indirection to be torn-free), PATCHed through the Manager's OEM
+// PerformanceTuning object with range validation, and persisted in the
+// bmcweb data file so a reboot keeps the profile.  Knobs that size
+// structures at startup (shard counts, reactor counts) are deliberately
+// absent - only parameters consulted per request belong here.
+class RuntimeTuning
+{
+  public:
+    static RuntimeTuning& getInstance()
+    {
+        static RuntimeTuning tuning;
+        return tuning;
+    }
+
+    // Dynamic bodies at or above this size gzip when the client accepts it
+    std::atomic<uint64_t> gzipSizeThreshold{1024};
+    // Token bucket per session/IP; 0 disables
+    std::atomic<uint64_t> rateLimitRequestsPerSecond{
+        bmcwebRateLimitRequestsPerSecond};
+    std::atomic<uint64_t> rateLimitBurst{bmcwebRateLimitBurst};
+    // Bulk-GET lane of the QoS scheduler
+    std::atomic<uint64_t> bulkConcurrencyLimit{8};
+    std::atomic<uint64_t> bulkQueueLimit{64};
+
+    nlohmann::json toJson() const
+    {
+        return {{"GzipSizeThresholdBytes", gzipSizeThreshold.load()},
+                {"RateLimitRequestsPerSecond",
+                 rateLimitRequestsPerSecond.load()},
+                {"RateLimitBurst", rateLimitBurst.load()},
+                {"BulkConcurrencyLimit", bulkConcurrencyLimit.load()},
+                {"BulkQueueLimit", bulkQueueLimit.load()}};
+    }
+
+    // Applies one knob if the name matches and the value is in range.
+    // Returns false for an out-of-range value; unknown names are left for
+    // the caller's readJson handling.
+    bool applyKnob(const std::string& name, uint64_t value)
+    {
+        if (name == "GzipSizeThresholdBytes")
+        {
+            if (value < 64 || value > (1U << 20))
+            {
+                return false;
+            }
+            gzipSizeThreshold = value;
+            return true;
+        }
+        if (name == "RateLimitRequestsPerSecond")
+        {
+            if (value > 1000)
+            {
+                return false;
+            }
+            rateLimitRequestsPerSecond = value;
+            return true;
+        }
+        if (name == "RateLimitBurst")
+        {
+            if (value < 1 || value > 10000)
+            {
+                return false;
+            }
+            rateLimitBurst = value;
+            return true;
+        }
+        if (name == "BulkConcurrencyLimit")
+        {
+            if (value < 1 || value > 64)
+            {
+                return false;
+            }
+            bulkConcurrencyLimit = value;
+            return true;
+        }
+        if (name == "BulkQueueLimit")
+        {
+            if (value < 1 || value > 1024)
+            {
+                return false;
+            }
+            bulkQueueLimit = value;
+            return true;
+        }
+        return false;
+    }
+
+    // Restores persisted values; out-of-range entries are ignored rather
+    // than trusted
+    void fromJson(const nlohmann::json& j)
+    {
+        for (const auto& item : j.items())
+        {
+            // Accept either integer representation; json that came through
+            // a generic parser may carry signed numbers
+            if (item.value().is_number_unsigned())
+            {
+                applyKnob(item.key(), item.value().get<uint64_t>());
+            }
+            else if (item.value().is_number_integer() &&
+                     item.value().get<int64_t>() >= 0)
+            {
+                applyKnob(item.key(),
+                          static_cast<uint64_t>(item.value().get<int64_t>()));
+            }
+        }
+    }
+
+  private:
+    RuntimeTuning() = default;
+};
+
+} // namespace runtime_config
+} // namespace crow
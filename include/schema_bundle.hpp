@@ -0,0 +1,121 @@
+#pragma once
+
+#include <gzip_helper.hpp>
+#include <http_response.hpp>
+#include <logging.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+namespace crow
+{
+namespace webassets
+{
+
+// Indexed in-memory bundle of the JSON schema tree.  Validators enumerate
+// every schema in one run, which used to cost one open and one file read
+// per request; the bundle gzips each schema once at startup into a single
+// blob (schemas compress roughly 10:1, so the whole tree resides in a few
+// hundred KB) and serves each as a slice - no opens, no per-request
+// filesystem traffic, one small copy of compressed bytes.  ETags derive
+// from the slice content, so they change exactly when a firmware update
+// ships different schemas.  Build-time packing was the ask, but schemas
+// land on the rootfs from other packages and aren't visible when bmcweb
+// itself builds; startup packing indexes whatever is actually installed.
+class SchemaBundle
+{
+  public:
+    static SchemaBundle& getInstance()
+    {
+        static SchemaBundle bundle;
+        return bundle;
+    }
+
+    // Adds one schema file during the startup scan; returns false when the
+    // file couldn't be read or compressed (the caller falls back to the
+    // regular file route)
+    bool add(const std::string& webpath,
+             const std::filesystem::path& absolutePath)
+    {
+        std::ifstream file(absolutePath, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        std::string contents((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+        std::string compressed;
+        if (!gzipDeflate(contents, compressed))
+        {
+            return false;
+        }
+        Entry entry;
+        entry.offset = blob.size();
+        entry.length = compressed.size();
+        entry.etag = crow::Response::computeEtag(compressed);
+        blob += compressed;
+        index.emplace(webpath, entry);
+        return true;
+    }
+
+    void finalize()
+    {
+        blob.shrink_to_fit();
+        BMCWEB_LOG_INFO << "Schema bundle: " << index.size()
+                        << " schemas packed into " << blob.size() << " bytes";
+    }
+
+    // Fills the response from the bundle; returns false when the path
+    // isn't bundled.  Clients that don't accept gzip (rare for schema
+    // validators) get the slice inflated on demand.
+    bool serve(const std::string& webpath, crow::Response& res,
+               std::string_view ifNoneMatch, bool acceptsGzip)
+    {
+        auto it = index.find(webpath);
+        if (it == index.end())
+        {
+            return false;
+        }
+        const Entry& entry = it->second;
+        res.addHeader("Content-Type", "application/json");
+        res.addHeader(boost::beast::http::field::etag, entry.etag);
+        if (!ifNoneMatch.empty() && ifNoneMatch == entry.etag)
+        {
+            res.result(boost::beast::http::status::not_modified);
+            return true;
+        }
+        std::string compressed(blob.data() + entry.offset, entry.length);
+        if (acceptsGzip)
+        {
+            res.addHeader("Content-Encoding", "gzip");
+            res.body() = std::move(compressed);
+            return true;
+        }
+        std::string inflated;
+        if (!gzipInflate(compressed, inflated))
+        {
+            res.result(boost::beast::http::status::internal_server_error);
+            return true;
+        }
+        res.body() = std::move(inflated);
+        return true;
+    }
+
+  private:
+    SchemaBundle() = default;
+
+    struct Entry
+    {
+        size_t offset = 0;
+        size_t length = 0;
+        std::string etag;
+    };
+
+    std::string blob;
+    std::unordered_map<std::string, Entry> index;
+};
+
+} // namespace webassets
+} // namespace crow
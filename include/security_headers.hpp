@@ -13,21 +13,29 @@ inline void addSecurityHeaders(const crow::Request& req [[maybe_unused]],
      javascript file.  It doesn't hurt anything, it's just ugly.
      */
     using bf = boost::beast::http::field;
-    res.addHeader(bf::strict_transport_security, "max-age=31536000; "
+
+    // This block is static for the life of the process and runs on every
+    // response.  The response was just cleared, so append the preparsed
+    // name/value literals with insert() instead of paying set()'s per-field
+    // lookup; nothing here can already be present.  Splicing one serialized
+    // blob into the output is not reachable from beast's serializer, which
+    // owns header rendering.
+    crow::Response::response_type& fields = *res.stringResponse;
+    fields.insert(bf::strict_transport_security, "max-age=31536000; "
                                                  "includeSubdomains; "
                                                  "preload");
-    res.addHeader(bf::x_frame_options, "DENY");
+    fields.insert(bf::x_frame_options, "DENY");
 
-    res.addHeader(bf::pragma, "no-cache");
-    res.addHeader(bf::cache_control, "no-Store,no-Cache");
+    fields.insert(bf::pragma, "no-cache");
+    fields.insert(bf::cache_control, "no-Store,no-Cache");
 
-    res.addHeader("X-XSS-Protection", "1; "
+    fields.insert("X-XSS-Protection", "1; "
                                       "mode=block");
-    res.addHeader("X-Content-Type-Options", "nosniff");
+    fields.insert("X-Content-Type-Options", "nosniff");
 
-    if (!bmcwebInsecureDisableXssPrevention)
+    if constexpr (!bmcwebInsecureDisableXssPrevention)
     {
-        res.addHeader("Content-Security-Policy", "default-src 'none'; "
+        fields.insert("Content-Security-Policy", "default-src 'none'; "
                                                  "img-src 'self' data:; "
                                                  "font-src 'self'; "
                                                  "style-src 'self'; "
@@ -46,7 +54,7 @@ inline void addSecurityHeaders(const crow::Request& req [[maybe_unused]],
     {
         // If XSS is disabled, we need to allow loading from addresses other
         // than self, as the BMC will be hosted elsewhere.
-        res.addHeader("Content-Security-Policy", "default-src 'none'; "
+        fields.insert("Content-Security-Policy", "default-src 'none'; "
                                                  "img-src *; "
                                                  "font-src *; "
                                                  "style-src *; "
@@ -58,14 +66,14 @@ inline void addSecurityHeaders(const crow::Request& req [[maybe_unused]],
                                                  "base-uri *");
 
         const std::string_view origin = req.getHeaderValue("Origin");
-        res.addHeader(bf::access_control_allow_origin, origin);
-        res.addHeader(bf::access_control_allow_methods, "GET, "
+        fields.insert(bf::access_control_allow_origin, origin);
+        fields.insert(bf::access_control_allow_methods, "GET, "
                                                         "POST, "
                                                         "PUT, "
                                                         "PATCH, "
                                                         "DELETE");
-        res.addHeader(bf::access_control_allow_credentials, "true");
-        res.addHeader(bf::access_control_allow_headers, "Origin, "
+        fields.insert(bf::access_control_allow_credentials, "true");
+        fields.insert(bf::access_control_allow_headers, "Origin, "
                                                         "Content-Type, "
                                                         "Accept, "
                                                         "Cookie, "
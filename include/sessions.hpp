@@ -16,8 +16,16 @@
 #include <random.hpp>
 #include <sdbusplus/bus/match.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <csignal>
+#include <mutex>
+#include <queue>
 #include <random>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
 #ifdef BMCWEB_ENABLE_IBM_MANAGEMENT_CONSOLE
 #include <ibm/locks.hpp>
 #endif
@@ -266,12 +274,30 @@ class SessionStore
                         csrfToken, std::string(clientId), std::string(clientIp),
                         std::chrono::steady_clock::now(), persistence, false,
                         isConfigureSelfOnly});
-        auto it = authTokens.emplace(std::make_pair(sessionToken, session));
-        // Only need to write to disk if session isn't about to be destroyed.
-        needWrite = persistence == PersistenceType::TIMEOUT;
+        scheduleExpiry(session);
+        SessionShard& shard = shardFor(sessionToken);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.tokens.emplace(std::make_pair(sessionToken, session));
+        addOrderedId(uniqueId, persistence);
+        // Only need to write to disk if session isn't about to be destroyed;
+        // never clear a dirty flag another change already set.
+        if (persistence == PersistenceType::TIMEOUT)
+        {
+            needWrite = true;
+        }
         return it.first->second;
     }
 
+    // Used by the persistent store to re-insert sessions read from disk.
+    void restoreSession(const std::shared_ptr<UserSession>& session)
+    {
+        scheduleExpiry(session);
+        SessionShard& shard = shardFor(session->sessionToken);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.tokens.emplace(session->sessionToken, session);
+        addOrderedId(session->uniqueId, session->persistence);
+    }
+
     std::shared_ptr<UserSession>
         loginSessionByToken(const std::string_view token)
     {
@@ -280,8 +306,12 @@ class SessionStore
         {
             return nullptr;
         }
-        auto sessionIt = authTokens.find(std::string(token));
-        if (sessionIt == authTokens.end())
+        SessionShard& shard = shardFor(token);
+        // Exclusive, not shared: the lookup refreshes lastUpdated, and two
+        // reactors landing on the same shard must not race on it.
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto sessionIt = shard.tokens.find(std::string(token));
+        if (sessionIt == shard.tokens.end())
         {
             return nullptr;
         }
@@ -294,14 +324,16 @@ class SessionStore
     {
         applySessionTimeouts();
         // TODO(Ed) this is inefficient
-        auto sessionIt = authTokens.begin();
-        while (sessionIt != authTokens.end())
+        for (SessionShard& shard : shards)
         {
-            if (sessionIt->second->uniqueId == uid)
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& session : shard.tokens)
             {
-                return sessionIt->second;
+                if (session.second->uniqueId == uid)
+                {
+                    return session.second;
+                }
             }
-            sessionIt++;
         }
         return nullptr;
     }
@@ -311,23 +343,47 @@ class SessionStore
 #ifdef BMCWEB_ENABLE_IBM_MANAGEMENT_CONSOLE
         crow::ibm_mc_lock::Lock::getInstance().releaseLock(session->uniqueId);
 #endif
-        authTokens.erase(session->sessionToken);
+        SessionShard& shard = shardFor(session->sessionToken);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.tokens.erase(session->sessionToken);
+        removeOrderedId(session->uniqueId);
         needWrite = true;
     }
 
-    std::vector<const std::string*> getUniqueIds(
+    // Reads the maintained insertion-ordered index instead of walking the
+    // shards, so collection GETs don't contend with authentication, get a
+    // stable order, and own their strings rather than pointers into
+    // sessions that a concurrent timeout sweep could destroy.
+    std::vector<std::string> getUniqueIds(
         bool getAll = true,
         const PersistenceType& type = PersistenceType::SINGLE_REQUEST)
     {
         applySessionTimeouts();
 
-        std::vector<const std::string*> ret;
-        ret.reserve(authTokens.size());
-        for (auto& session : authTokens)
+        std::vector<std::string> ret;
+        std::lock_guard<std::mutex> lock(orderedIdsMutex);
+        ret.reserve(orderedSessionIds.size());
+        for (const std::pair<std::string, PersistenceType>& entry :
+             orderedSessionIds)
         {
-            if (getAll || type == session.second->persistence)
+            if (getAll || type == entry.second)
             {
-                ret.push_back(&session.second->uniqueId);
+                ret.push_back(entry.first);
+            }
+        }
+        return ret;
+    }
+
+    // Snapshot of all live sessions, used when serializing to disk.
+    std::vector<std::shared_ptr<UserSession>> getSessions()
+    {
+        std::vector<std::shared_ptr<UserSession>> ret;
+        for (SessionShard& shard : shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& session : shard.tokens)
+            {
+                ret.push_back(session.second);
             }
         }
         return ret;
@@ -359,6 +415,28 @@ class SessionStore
         return std::chrono::seconds(timeoutInSeconds).count();
     }
 
+    // Resident bytes attributable to the session store; walked only when
+    // the memory diagnostics route is scraped
+    size_t memoryFootprint()
+    {
+        size_t bytes = sizeof(SessionStore);
+        for (SessionShard& shard : shards)
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (const auto& [token, session] : shard.tokens)
+            {
+                bytes += token.capacity() + sizeof(UserSession);
+                bytes += session->uniqueId.capacity() +
+                         session->sessionToken.capacity() +
+                         session->username.capacity() +
+                         session->csrfToken.capacity() +
+                         session->clientId.capacity() +
+                         session->clientIp.capacity();
+            }
+        }
+        return bytes;
+    }
+
     void updateSessionTimeout(std::chrono::seconds newTimeoutInSeconds)
     {
         timeoutInSeconds = newTimeoutInSeconds;
@@ -374,45 +452,165 @@ class SessionStore
     void applySessionTimeouts()
     {
         auto timeNow = std::chrono::steady_clock::now();
-        if (timeNow - lastTimeoutUpdate > std::chrono::seconds(1))
+        auto lastUpdate = lastTimeoutUpdate.load();
+        if (timeNow - lastUpdate <= std::chrono::seconds(1))
+        {
+            return;
+        }
+        // Only one thread gets to run the sweep per interval.
+        if (!lastTimeoutUpdate.compare_exchange_strong(lastUpdate, timeNow))
+        {
+            return;
+        }
+        // Pop only the heap entries whose scheduled deadline has passed -
+        // O(k log n) for k candidates, never a walk of the whole store.  A
+        // touch refreshes lastUpdated without updating the heap, so a
+        // popped entry whose session turns out to still be live is
+        // rescheduled at its corrected deadline.  The heap lock is never
+        // held while a shard lock is taken, so the shard-then-heap nesting
+        // below cannot deadlock.
+        std::vector<std::shared_ptr<UserSession>> expired;
         {
-            lastTimeoutUpdate = timeNow;
-            auto authTokensIt = authTokens.begin();
-            while (authTokensIt != authTokens.end())
+            std::lock_guard<std::mutex> lock(expiryHeapMutex);
+            std::vector<ExpiryEntry> rearm;
+            while (!expiryHeap.empty() && expiryHeap.top().deadline <= timeNow)
             {
-                if (timeNow - authTokensIt->second->lastUpdated >=
-                    timeoutInSeconds)
+                std::shared_ptr<UserSession> session =
+                    expiryHeap.top().session.lock();
+                expiryHeap.pop();
+                if (session == nullptr)
                 {
-#ifdef BMCWEB_ENABLE_IBM_MANAGEMENT_CONSOLE
-                    crow::ibm_mc_lock::Lock::getInstance().releaseLock(
-                        authTokensIt->second->uniqueId);
-#endif
-                    authTokensIt = authTokens.erase(authTokensIt);
-
-                    needWrite = true;
+                    // Removed through logout; nothing left to expire
+                    continue;
                 }
-                else
+                if (timeNow - session->lastUpdated >= timeoutInSeconds)
                 {
-                    authTokensIt++;
+                    expired.push_back(std::move(session));
+                    continue;
                 }
+                rearm.push_back(
+                    ExpiryEntry{session->lastUpdated + timeoutInSeconds,
+                                session});
+            }
+            for (ExpiryEntry& entry : rearm)
+            {
+                expiryHeap.push(std::move(entry));
             }
         }
+        for (const std::shared_ptr<UserSession>& session : expired)
+        {
+            SessionShard& shard = shardFor(session->sessionToken);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            auto sessionIt = shard.tokens.find(session->sessionToken);
+            if (sessionIt == shard.tokens.end() || sessionIt->second != session)
+            {
+                continue;
+            }
+            // Re-check under the shard lock: a login may have refreshed the
+            // session between the heap pop and here
+            if (timeNow - session->lastUpdated < timeoutInSeconds)
+            {
+                std::lock_guard<std::mutex> heapLock2(expiryHeapMutex);
+                expiryHeap.push(
+                    ExpiryEntry{session->lastUpdated + timeoutInSeconds,
+                                session});
+                continue;
+            }
+#ifdef BMCWEB_ENABLE_IBM_MANAGEMENT_CONSOLE
+            crow::ibm_mc_lock::Lock::getInstance().releaseLock(
+                session->uniqueId);
+#endif
+            removeOrderedId(session->uniqueId);
+            shard.tokens.erase(sessionIt);
+            needWrite = true;
+        }
     }
 
     SessionStore(const SessionStore&) = delete;
     SessionStore& operator=(const SessionStore&) = delete;
 
-    std::unordered_map<std::string, std::shared_ptr<UserSession>,
-                       std::hash<std::string>,
-                       crow::utility::ConstantTimeCompare>
-        authTokens;
-
-    std::chrono::time_point<std::chrono::steady_clock> lastTimeoutUpdate;
-    bool needWrite{false};
+    std::atomic<std::chrono::time_point<std::chrono::steady_clock>>
+        lastTimeoutUpdate;
+    std::atomic<bool> needWrite{false};
     std::chrono::seconds timeoutInSeconds;
     AuthConfigMethods authMethodsConfig;
 
   private:
+    // Token lookup happens on every authenticated request; shard the map so
+    // concurrent pollers on different reactors take a shared lock on their
+    // own shard instead of serializing on one store-wide structure.  The
+    // token comparator stays constant-time to keep the timing side channel
+    // closed.
+    static constexpr size_t sessionShardCount = 8;
+
+    // Lazily maintained expiry schedule: one entry per live session at the
+    // deadline known when it was pushed.  Touches don't update the heap;
+    // the sweep corrects stale entries as they surface.
+    struct ExpiryEntry
+    {
+        std::chrono::time_point<std::chrono::steady_clock> deadline;
+        std::weak_ptr<UserSession> session;
+
+        // priority_queue is a max-heap; invert so the earliest deadline
+        // surfaces first
+        bool operator<(const ExpiryEntry& other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
+
+    void scheduleExpiry(const std::shared_ptr<UserSession>& session)
+    {
+        std::lock_guard<std::mutex> lock(expiryHeapMutex);
+        expiryHeap.push(
+            ExpiryEntry{session->lastUpdated + timeoutInSeconds, session});
+    }
+
+    std::priority_queue<ExpiryEntry> expiryHeap;
+    std::mutex expiryHeapMutex;
+
+    struct SessionShard
+    {
+        std::shared_mutex mutex;
+        std::unordered_map<std::string, std::shared_ptr<UserSession>,
+                           std::hash<std::string>,
+                           crow::utility::ConstantTimeCompare>
+            tokens;
+    };
+
+    SessionShard& shardFor(const std::string_view token)
+    {
+        return shards[std::hash<std::string_view>{}(token) %
+                      sessionShardCount];
+    }
+
+    void addOrderedId(const std::string& uniqueId, PersistenceType type)
+    {
+        std::lock_guard<std::mutex> lock(orderedIdsMutex);
+        orderedSessionIds.emplace_back(uniqueId, type);
+    }
+
+    void removeOrderedId(const std::string& uniqueId)
+    {
+        std::lock_guard<std::mutex> lock(orderedIdsMutex);
+        auto it = std::find_if(
+            orderedSessionIds.begin(), orderedSessionIds.end(),
+            [&uniqueId](const std::pair<std::string, PersistenceType>& entry) {
+                return entry.first == uniqueId;
+            });
+        if (it != orderedSessionIds.end())
+        {
+            orderedSessionIds.erase(it);
+        }
+    }
+
+    std::array<SessionShard, sessionShardCount> shards;
+
+    // Insertion-ordered (id, persistence) index maintained on create,
+    // restore and destroy
+    std::vector<std::pair<std::string, PersistenceType>> orderedSessionIds;
+    std::mutex orderedIdsMutex;
+
     SessionStore() : timeoutInSeconds(1800)
     {}
 };
@@ -0,0 +1,254 @@
+#pragma once
+#include <sys/socket.h>
+
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/container/flat_set.hpp>
+#include <websocket.hpp>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace crow
+{
+namespace socket_relay
+{
+
+// Shared unix-socket <-> websocket relay engine.  The console and
+// hypervisor console each carried their own copy of the same read/write
+// loops, buffers and connect logic; this is that machinery once, with the
+// throughput behaviors unified: output coalescing (thousands of tiny boot
+// reads become one frame per flush window, with an immediate flush after
+// client input so echo stays snappy), bounded input backpressure (a
+// backend that stops draining can't grow the input buffer past its cap -
+// overflow is counted and dropped), and per-relay byte/drop counters.
+// Other single-stream relays (PTY shells, VM pipes) keep their
+// session-scoped handlers but can adopt this engine where their models
+// allow.
+class SocketRelay
+{
+  public:
+    // endpointIn may contain embedded NULs (abstract socket names)
+    SocketRelay(std::string endpointIn, bool coalesceIn) :
+        endpoint(std::move(endpointIn)), coalesce(coalesceIn)
+    {}
+
+    void attach(crow::websocket::Connection& conn)
+    {
+        sessions.insert(&conn);
+        if (hostSocket == nullptr)
+        {
+            boost::asio::local::stream_protocol::endpoint ep(endpoint);
+            hostSocket = std::make_unique<
+                boost::asio::local::stream_protocol::socket>(
+                conn.getIoContext());
+            flushTimer.emplace(conn.getIoContext());
+            hostSocket->async_connect(
+                ep, [this](const boost::system::error_code& ec) {
+                    if (ec)
+                    {
+                        BMCWEB_LOG_ERROR
+                            << "Couldn't connect to host socket: " << ec;
+                        closeAll("Error in connecting to host port");
+                        return;
+                    }
+                    doWrite();
+                    doRead();
+                });
+        }
+    }
+
+    // Returns true when the last session left and backend state was torn
+    // down
+    bool detach(crow::websocket::Connection& conn)
+    {
+        sessions.erase(&conn);
+        if (!sessions.empty())
+        {
+            return false;
+        }
+        hostSocket = nullptr;
+        flushTimer.reset();
+        flushScheduled = false;
+        echoExpected = false;
+        doingWrite = false;
+        pendingOutput.clear();
+        pendingOutput.shrink_to_fit();
+        inputBuffer.clear();
+        inputBuffer.shrink_to_fit();
+        return true;
+    }
+
+    void onInput(const std::string& data)
+    {
+        if (inputBuffer.size() + data.size() > inputBufferLimit)
+        {
+            // Backend stopped draining; cap memory and count the loss
+            droppedInputBytes += data.size();
+            BMCWEB_LOG_ERROR << "Relay input buffer full; dropping "
+                             << data.size() << " bytes ("
+                             << droppedInputBytes << " dropped total)";
+            return;
+        }
+        inputBuffer += data;
+        bytesToHost += data.size();
+        // The next read after input carries the echo; flush it straight
+        // through instead of coalescing
+        echoExpected = true;
+        doWrite();
+    }
+
+    uint64_t getBytesFromHost() const
+    {
+        return bytesFromHost;
+    }
+    uint64_t getBytesToHost() const
+    {
+        return bytesToHost;
+    }
+    uint64_t getDroppedInputBytes() const
+    {
+        return droppedInputBytes;
+    }
+
+  private:
+    void closeAll(const std::string_view reason)
+    {
+        boost::container::flat_set<crow::websocket::Connection*> toClose =
+            sessions;
+        for (crow::websocket::Connection* session : toClose)
+        {
+            session->close(reason);
+        }
+    }
+
+    void flushOutput()
+    {
+        if (pendingOutput.empty())
+        {
+            return;
+        }
+        for (crow::websocket::Connection* session : sessions)
+        {
+            session->sendBinary(pendingOutput);
+        }
+        pendingOutput.clear();
+    }
+
+    void doWrite()
+    {
+        if (doingWrite)
+        {
+            BMCWEB_LOG_DEBUG << "Already writing.  Bailing out";
+            return;
+        }
+        if (inputBuffer.empty())
+        {
+            BMCWEB_LOG_DEBUG << "Outbuffer empty.  Bailing out";
+            return;
+        }
+        if (!hostSocket)
+        {
+            BMCWEB_LOG_ERROR << "doWrite(): Socket closed.";
+            return;
+        }
+
+        doingWrite = true;
+        hostSocket->async_write_some(
+            boost::asio::buffer(inputBuffer.data(), inputBuffer.size()),
+            [this](boost::beast::error_code ec, std::size_t bytesWritten) {
+                doingWrite = false;
+                inputBuffer.erase(0, bytesWritten);
+
+                if (ec == boost::asio::error::eof)
+                {
+                    closeAll("Error in reading to host port");
+                    return;
+                }
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "Error in host socket write " << ec;
+                    return;
+                }
+                doWrite();
+            });
+    }
+
+    void doRead()
+    {
+        if (!hostSocket)
+        {
+            BMCWEB_LOG_ERROR << "doRead(): Socket closed.";
+            return;
+        }
+
+        BMCWEB_LOG_DEBUG << "Reading from socket";
+        hostSocket->async_read_some(
+            boost::asio::buffer(outputBuffer.data(), outputBuffer.size()),
+            [this](const boost::system::error_code& ec,
+                   std::size_t bytesRead) {
+                BMCWEB_LOG_DEBUG << "read done.  Read " << bytesRead
+                                 << " bytes";
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "Couldn't read from host socket: "
+                                     << ec;
+                    closeAll("Error in connecting to host port");
+                    return;
+                }
+                bytesFromHost += bytesRead;
+                pendingOutput.append(outputBuffer.data(), bytesRead);
+                if (!coalesce || pendingOutput.size() >= flushSizeThreshold ||
+                    echoExpected)
+                {
+                    echoExpected = false;
+                    if (flushScheduled && flushTimer)
+                    {
+                        flushTimer->cancel();
+                    }
+                    flushOutput();
+                }
+                else if (!flushScheduled && flushTimer)
+                {
+                    flushScheduled = true;
+                    flushTimer->expires_after(flushDelay);
+                    flushTimer->async_wait(
+                        [this](const boost::system::error_code& timerEc) {
+                            flushScheduled = false;
+                            if (timerEc)
+                            {
+                                // Canceled by a threshold or echo flush
+                                return;
+                            }
+                            flushOutput();
+                        });
+                }
+                doRead();
+            });
+    }
+
+    static constexpr size_t flushSizeThreshold = 4096;
+    static constexpr std::chrono::milliseconds flushDelay{5};
+    static constexpr size_t inputBufferLimit = 64 * 1024;
+
+    std::string endpoint;
+    bool coalesce;
+
+    std::unique_ptr<boost::asio::local::stream_protocol::socket> hostSocket;
+    std::optional<boost::asio::steady_timer> flushTimer;
+    boost::container::flat_set<crow::websocket::Connection*> sessions;
+    std::array<char, 4096> outputBuffer{};
+    std::string inputBuffer;
+    std::string pendingOutput;
+    bool doingWrite = false;
+    bool flushScheduled = false;
+    bool echoExpected = false;
+    uint64_t bytesFromHost = 0;
+    uint64_t bytesToHost = 0;
+    uint64_t droppedInputBytes = 0;
+};
+
+} // namespace socket_relay
+} // namespace crow
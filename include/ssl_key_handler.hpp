@@ -1,5 +1,7 @@
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include <openssl/bio.h>
 #include <openssl/dh.h>
 #include <openssl/dsa.h>
@@ -438,6 +440,28 @@ inline std::shared_ptr<boost::asio::ssl::context>
 
     SSL_CTX_set_options(mSslContext->native_handle(), SSL_OP_NO_RENEGOTIATION);
 
+    // Server-side session resumption: keep a bounded session-ID cache and
+    // hand out stateless tickets so reconnecting clients (fleet monitors
+    // poll every 30s) skip the asymmetric crypto on the next handshake.
+    if (bmcwebTlsSessionCacheSize > 0)
+    {
+        static constexpr const char sessionIdContext[] = "bmcweb";
+        SSL_CTX_set_session_cache_mode(mSslContext->native_handle(),
+                                       SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(mSslContext->native_handle(),
+                                    bmcwebTlsSessionCacheSize);
+        SSL_CTX_set_session_id_context(
+            mSslContext->native_handle(),
+            reinterpret_cast<const unsigned char*>(sessionIdContext),
+            sizeof(sessionIdContext) - 1);
+    }
+    else
+    {
+        SSL_CTX_set_session_cache_mode(mSslContext->native_handle(),
+                                       SSL_SESS_CACHE_OFF);
+        SSL_CTX_set_options(mSslContext->native_handle(), SSL_OP_NO_TICKET);
+    }
+
     BMCWEB_LOG_DEBUG << "Using default TrustStore location: " << trustStorePath;
     mSslContext->add_verify_path(trustStorePath);
 
@@ -471,6 +495,27 @@ inline std::shared_ptr<boost::asio::ssl::context>
     {
         BMCWEB_LOG_ERROR << "Error setting cipher list\n";
     }
+
+    // Settle protocol selection during the handshake via ALPN instead of
+    // leaving clients to probe after connect.  Only http/1.1 is offered;
+    // multiplexed h2 would need a full framing layer (nghttp2) that this
+    // tree doesn't carry.
+    SSL_CTX_set_alpn_select_cb(
+        mSslContext->native_handle(),
+        [](SSL*, const unsigned char** out, unsigned char* outlen,
+           const unsigned char* in, unsigned int inlen, void*) -> int {
+            static constexpr const unsigned char alpn[] = "\x08http/1.1";
+            unsigned char* selected = nullptr;
+            if (SSL_select_next_proto(&selected, outlen, alpn,
+                                      sizeof(alpn) - 1, in,
+                                      inlen) != OPENSSL_NPN_NEGOTIATED)
+            {
+                return SSL_TLSEXT_ERR_NOACK;
+            }
+            *out = selected;
+            return SSL_TLSEXT_ERR_OK;
+        },
+        nullptr);
     return mSslContext;
 }
 } // namespace ensuressl
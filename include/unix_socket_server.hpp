@@ -0,0 +1,161 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#include "buffer_pool.hpp"
+#include "http_connection.hpp"
+#include "timer_queue.hpp"
+
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace crow
+{
+
+// AF_UNIX Redfish listener for in-band host clients: the same App and
+// router, but no TCP and no TLS, which makes a localhost-equivalent
+// request several times cheaper and keeps the network listener's capacity
+// for remote users.  Authentication comes from the transport: SO_PEERCRED
+// identifies the connecting process, root maps to a transport session for
+// the root account (whose privileges resolve through the normal
+// GetUserInfo path in the router), and any other uid is refused at
+// accept.  The socket is created 0660 so filesystem permissions gate who
+// can even connect.
+template <typename Handler>
+class UnixSocketServer
+{
+  public:
+    UnixSocketServer(Handler* handlerIn, const std::string& socketPathIn,
+                     const std::shared_ptr<boost::asio::io_context>& io) :
+        ioService(io),
+        acceptor(*io), timer(*io), handler(handlerIn),
+        socketPath(socketPathIn)
+    {}
+
+    void run()
+    {
+        std::error_code removeEc;
+        std::filesystem::remove(socketPath, removeEc);
+        boost::asio::local::stream_protocol::endpoint endpoint(socketPath);
+        boost::system::error_code ec;
+        acceptor.open(endpoint.protocol(), ec);
+        if (!ec)
+        {
+            acceptor.bind(endpoint, ec);
+        }
+        if (!ec)
+        {
+            acceptor.listen(boost::asio::socket_base::max_listen_connections,
+                            ec);
+        }
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR << "Unable to listen on " << socketPath << ": "
+                             << ec.message();
+            return;
+        }
+        chmod(socketPath.c_str(), 0660);
+
+        getCachedDateStr = []() -> const std::string& {
+            static std::string dateStr;
+            time_t lastTimeT = time(nullptr);
+            tm myTm{};
+            gmtime_r(&lastTimeT, &myTm);
+            dateStr.resize(100);
+            size_t dateStrSz = strftime(&dateStr[0], 99,
+                                        "%a, %d %b %Y %H:%M:%S GMT", &myTm);
+            dateStr.resize(dateStrSz);
+            return dateStr;
+        };
+
+        timer.expires_after(std::chrono::seconds(1));
+        timerHandler = [this](const boost::system::error_code& timerEc) {
+            if (timerEc)
+            {
+                return;
+            }
+            timerQueue.process();
+            timer.expires_after(std::chrono::seconds(1));
+            timer.async_wait(timerHandler);
+        };
+        timer.async_wait(timerHandler);
+
+        BMCWEB_LOG_INFO << "AF_UNIX Redfish listener on " << socketPath;
+        doAccept();
+    }
+
+  private:
+    // Maps the connecting process to an account, or refuses.  Only root
+    // is admitted; its role still resolves through GetUserInfo like any
+    // other request.
+    static std::shared_ptr<persistent_data::UserSession>
+        sessionForPeer(boost::asio::local::stream_protocol::socket& peer)
+    {
+        struct ucred creds
+        {};
+        socklen_t len = sizeof(creds);
+        if (getsockopt(peer.native_handle(), SOL_SOCKET, SO_PEERCRED, &creds,
+                       &len) != 0)
+        {
+            return nullptr;
+        }
+        if (creds.uid != 0)
+        {
+            BMCWEB_LOG_WARNING << "Refusing AF_UNIX peer uid " << creds.uid;
+            return nullptr;
+        }
+        return persistent_data::SessionStore::getInstance()
+            .generateUserSession(
+                "root", "", "",
+                persistent_data::PersistenceType::SINGLE_REQUEST);
+    }
+
+    void doAccept()
+    {
+        auto socket = std::make_shared<
+            boost::asio::local::stream_protocol::socket>(*ioService);
+        acceptor.async_accept(
+            *socket, [this, socket](const boost::system::error_code& ec) {
+                if (ec)
+                {
+                    if (ec != boost::asio::error::operation_aborted)
+                    {
+                        doAccept();
+                    }
+                    return;
+                }
+                std::shared_ptr<persistent_data::UserSession> session =
+                    sessionForPeer(*socket);
+                if (session == nullptr)
+                {
+                    boost::system::error_code ignored;
+                    socket->close(ignored);
+                    doAccept();
+                    return;
+                }
+                auto connection = std::make_shared<Connection<
+                    boost::asio::local::stream_protocol::socket, Handler>>(
+                    handler, getCachedDateStr, timerQueue, bufferPool,
+                    std::move(*socket));
+                connection->setTransportSession(std::move(session));
+                connection->start();
+                doAccept();
+            });
+    }
+
+    std::shared_ptr<boost::asio::io_context> ioService;
+    boost::asio::local::stream_protocol::acceptor acceptor;
+    boost::asio::steady_timer timer;
+    std::function<void(const boost::system::error_code&)> timerHandler;
+    Handler* handler;
+    std::string socketPath;
+    std::function<const std::string&()> getCachedDateStr;
+    detail::TimerQueue timerQueue;
+    detail::BufferPool bufferPool;
+};
+
+} // namespace crow
@@ -195,8 +195,8 @@ inline void requestRoutes(App& app)
             handler->outputBuffer->clear();
             handler.reset();
         })
-        .onmessage([](crow::websocket::Connection& conn,
-                      const std::string& data, bool) {
+        .onmessagebinary([](crow::websocket::Connection& conn,
+                            std::string&& data) {
             if (data.length() > handler->inputBuffer->capacity())
             {
                 BMCWEB_LOG_ERROR << "Buffer overrun when writing "
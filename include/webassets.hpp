@@ -2,6 +2,9 @@
 
 #include "webroutes.hpp"
 
+#include <http_utility.hpp>
+#include <schema_bundle.hpp>
+
 #include <app.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/container/flat_set.hpp>
@@ -10,7 +13,6 @@
 #include <routing.hpp>
 
 #include <filesystem>
-#include <fstream>
 #include <string>
 
 namespace crow
@@ -147,7 +149,45 @@ inline void requestRoutes(App& app)
                 forward_unauthorized::hasWebuiRoute = true;
             }
 
-            app.routeDynamic(webpath)(
+            // Plain JSON schemas pack into the startup bundle and serve as
+            // pre-gzipped slices; everything else keeps the file route
+            if (contentEncoding == nullptr && extension == ".json" &&
+                boost::starts_with(webpath.string(), "/redfish/v1/") &&
+                SchemaBundle::getInstance().add(webpath.string(),
+                                                absolutePath))
+            {
+                // The bundle hands out pre-gzipped slices and negotiates
+                // its own encoding; the generic compression stage has
+                // nothing to add
+                app.routeDynamic(webpath)
+                    .noCompression()(
+                    [webpathStr{webpath.string()}](
+                        const crow::Request& req,
+                        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                        if (!SchemaBundle::getInstance().serve(
+                                webpathStr, asyncResp->res,
+                                req.getHeaderValue(
+                                    boost::beast::http::field::if_none_match),
+                                http_helpers::isGzipAccepted(
+                                    req.getHeaderValue(
+                                        boost::beast::http::field::
+                                            accept_encoding))))
+                        {
+                            asyncResp->res.result(boost::beast::http::status::
+                                                      internal_server_error);
+                        }
+                    });
+                continue;
+            }
+
+            crow::DynamicRule& assetRule = app.routeDynamic(webpath);
+            if (contentEncoding != nullptr)
+            {
+                // Shipped pre-compressed on disk (.gz assets); a second
+                // encoding pass would only double-wrap
+                assetRule.noCompression();
+            }
+            assetRule(
                 [absolutePath, contentType, contentEncoding](
                     const crow::Request&,
                     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
@@ -163,21 +203,17 @@ inline void requestRoutes(App& app)
                     }
 
                     // res.set_header("Cache-Control", "public, max-age=86400");
-                    std::ifstream inf(absolutePath);
-                    if (!inf)
+                    if (!asyncResp->res.openFile(absolutePath))
                     {
                         BMCWEB_LOG_DEBUG << "failed to read file";
                         asyncResp->res.result(
                             boost::beast::http::status::internal_server_error);
                         return;
                     }
-
-                    asyncResp->res.body() = {
-                        std::istreambuf_iterator<char>(inf),
-                        std::istreambuf_iterator<char>()};
                 });
         }
     }
+    SchemaBundle::getInstance().finalize();
 }
 } // namespace webassets
 } // namespace crow
@@ -16,6 +16,7 @@
 #pragma once
 #include "http_response.hpp"
 
+#include <json_extern.hpp>
 #include <nlohmann/json.hpp>
 #include <source_location.hpp>
 
@@ -973,9 +974,8 @@ nlohmann::json mutualExclusiveProperties(const std::string& arg1,
 void mutualExclusiveProperties(crow::Response& res, const std::string& arg1,
                                const std::string& arg2);
 
-void addMessageToErrorJson(nlohmann::json& target,
-                           const nlohmann::json& message);
-void addMessageToJson(nlohmann::json& target, const nlohmann::json& message,
+void addMessageToErrorJson(nlohmann::json& target, nlohmann::json message);
+void addMessageToJson(nlohmann::json& target, nlohmann::json message,
                       const std::string& fieldPath);
 
 /**
@@ -24,8 +24,11 @@
 
 #include <boost/asio/io_context.hpp>
 #include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
 #include <error_messages.hpp>
 #include <event_service_store.hpp>
+#include <event_spool.hpp>
+#include <inotify_hub.hpp>
 #include <http_client.hpp>
 #include <persistent_data.hpp>
 #include <random.hpp>
@@ -34,6 +37,8 @@
 
 #include <cstdlib>
 #include <ctime>
+#include <deque>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <variant>
@@ -72,11 +77,8 @@ inline boost::beast::span<const MessageEntry>
 } // namespace message_registries
 
 #ifndef BMCWEB_ENABLE_REDFISH_DBUS_LOG_ENTRIES
-static std::optional<boost::asio::posix::stream_descriptor> inotifyConn;
 static constexpr const char* redfishEventLogDir = "/var/log";
 static constexpr const char* redfishEventLogFile = "/var/log/redfish";
-static constexpr const size_t iEventSize = sizeof(inotify_event);
-static int inotifyFd = -1;
 static int dirWatchDesc = -1;
 static int fileWatchDesc = -1;
 
@@ -91,17 +93,7 @@ static const Message*
     getMsgFromRegistry(const std::string& messageKey,
                        const boost::beast::span<const MessageEntry>& registry)
 {
-    boost::beast::span<const MessageEntry>::const_iterator messageIt =
-        std::find_if(registry.cbegin(), registry.cend(),
-                     [&messageKey](const MessageEntry& messageEntry) {
-                         return !messageKey.compare(messageEntry.first);
-                     });
-    if (messageIt != registry.cend())
-    {
-        return &messageIt->second;
-    }
-
-    return nullptr;
+    return findMessage(registry, messageKey);
 }
 
 static const Message* formatMessage(const std::string_view& messageID)
@@ -244,17 +236,8 @@ inline int formatEventLogEntry(const std::string& logEntryID,
         severity = message->severity;
     }
 
-    // Fill the MessageArgs into the Message
-    int i = 0;
-    for (const std::string& messageArg : messageArgs)
-    {
-        std::string argStr = "%" + std::to_string(++i);
-        size_t argPos = msg.find(argStr);
-        if (argPos != std::string::npos)
-        {
-            msg.replace(argPos, argStr.length(), messageArg);
-        }
-    }
+    // Fill the MessageArgs into the Message in a single template pass
+    msg = message_registries::fillMessageArgs(messageArgs, msg);
 
     // Get the Created time from the timestamp. The log timestamp is in
     // RFC3339 format which matches the Redfish format except for the
@@ -371,6 +354,16 @@ inline bool
     return true;
 }
 
+// One event-log record formatted once and shared across subscribers; each
+// subscriber filters on the preparsed registry metadata and stamps its own
+// Context onto a copy instead of re-running message formatting.
+struct FormattedEventLogEntry
+{
+    std::string registryName;
+    std::string messageKey;
+    nlohmann::json entry;
+};
+
 class Subscription : public persistent_data::UserSubscription
 {
   public:
@@ -395,12 +388,89 @@ class Subscription : public persistent_data::UserSubscription
 
     ~Subscription() = default;
 
-    void sendEvent(const std::string& msg)
+    // Rolling delivery health fed by the client's per-send outcomes; when
+    // the recent window is failure-heavy the circuit opens and events go
+    // straight to the flash spool until the cooldown passes, so one
+    // misconfigured slow collector stops costing queue growth and retry
+    // churn that delays everyone else's events.
+    void recordDeliveryOutcome(bool ok, uint64_t latencyUs)
+    {
+        windowSends++;
+        totalSends++;
+        if (!ok)
+        {
+            windowFailures++;
+            totalFailures++;
+        }
+        else
+        {
+            lastLatencyUs = latencyUs;
+        }
+        if (windowSends >= healthWindow)
+        {
+            if (windowFailures * 2 >= windowSends)
+            {
+                BMCWEB_LOG_WARNING
+                    << "Subscriber " << subId << " circuit opened ("
+                    << windowFailures << '/' << windowSends
+                    << " recent deliveries failed)";
+                circuitOpenUntil = std::chrono::steady_clock::now() +
+                                   std::chrono::seconds(circuitCooldownSeconds);
+            }
+            windowSends = 0;
+            windowFailures = 0;
+        }
+    }
+
+    bool circuitOpen() const
+    {
+        return std::chrono::steady_clock::now() < circuitOpenUntil;
+    }
+
+    // One line of health for the Redfish OEM property
+    void fillDeliveryHealth(nlohmann::json& health) const
     {
-        if ((conn != nullptr) &&
-            (conn->getConnState() != crow::ConnState::terminated))
+        health["State"] = circuitOpen()       ? "CircuitOpen"
+                          : totalFailures > 0 ? "Degraded"
+                                              : "OK";
+        health["TotalSends"] = totalSends;
+        health["TotalFailures"] = totalFailures;
+        health["LastDeliveryLatencyUs"] = lastLatencyUs;
+        if (spool != nullptr)
         {
-            conn->sendData(msg);
+            health["SpooledDrops"] = spool->droppedRecords();
+        }
+    }
+
+    // Takes the payload by value so single-transport subscriptions (the
+    // only kind in practice) move the serialized string all the way into
+    // the outbound queue instead of copying it at each hop
+    void sendEvent(std::string msg)
+    {
+        if ((conn != nullptr) && (sseConn == nullptr) &&
+            (!conn->isAvailable() || circuitOpen()))
+        {
+            // Subscriber down and retries exhausted or suspended: buffer on
+            // flash instead of dropping, so the outage suffix streams back
+            // on reconnect rather than forcing a full log re-scrape
+            ensureSpool();
+            if (spool != nullptr && spool->isOpen())
+            {
+                spool->append(msg);
+                return;
+            }
+        }
+        if ((conn != nullptr) && !conn->isTerminated())
+        {
+            drainSpool();
+            if (sseConn != nullptr)
+            {
+                conn->sendData(msg);
+            }
+            else
+            {
+                conn->sendData(std::move(msg));
+            }
             this->eventSeqNum++;
         }
         if (conn == nullptr)
@@ -409,16 +479,41 @@ class Subscription : public persistent_data::UserSubscription
             BMCWEB_LOG_ERROR
                 << "HttpClient connection is null. Create a conn for id:"
                 << subId << " destination: " << host << ":" << port;
-            conn = std::make_shared<crow::HttpClient>(
+            conn = std::make_shared<crow::HttpClientPool>(
                 crow::connections::systemBus->get_io_context(), subId, host,
                 port, path, uriProto, httpHeaders);
-            conn->sendData(msg);
+            installDeliveryObserver();
+            if (sseConn != nullptr)
+            {
+                conn->sendData(msg);
+            }
+            else
+            {
+                conn->sendData(std::move(msg));
+            }
             this->eventSeqNum++;
         }
         if (sseConn != nullptr)
         {
-            sseConn->sendData(eventSeqNum, msg);
+            sseConn->sendData(eventSeqNum, std::move(msg));
+        }
+    }
+
+    // Streams any spooled outage backlog ahead of live traffic, keeping
+    // delivery ordered
+    void drainSpool()
+    {
+        if (spool == nullptr || spool->empty())
+        {
+            return;
         }
+        BMCWEB_LOG_INFO << "Draining event spool for subscriber " << subId
+                        << " (" << spool->droppedRecords()
+                        << " records dropped during outage)";
+        spool->drain([this](std::string&& payload) {
+            conn->sendData(std::move(payload));
+            this->eventSeqNum++;
+        });
     }
 
     void sendTestEventLog()
@@ -448,51 +543,35 @@ class Subscription : public persistent_data::UserSubscription
 
 #ifndef BMCWEB_ENABLE_REDFISH_DBUS_LOG_ENTRIES
     void filterAndSendEventLogs(
-        const std::vector<EventLogObjectsType>& eventRecords)
+        const std::vector<FormattedEventLogEntry>& formattedRecords)
     {
+        // Compile the subscription filters once per batch; each event then
+        // pays two sorted-set membership tests instead of linear scans
+        const boost::container::flat_set<std::string> prefixSet(
+            registryPrefixes.begin(), registryPrefixes.end());
+        const boost::container::flat_set<std::string> msgIdSet(
+            registryMsgIds.begin(), registryMsgIds.end());
+
         nlohmann::json logEntryArray;
-        for (const EventLogObjectsType& logEntry : eventRecords)
+        for (const FormattedEventLogEntry& logEntry : formattedRecords)
         {
-            const std::string& idStr = std::get<0>(logEntry);
-            const std::string& timestamp = std::get<1>(logEntry);
-            const std::string& messageID = std::get<2>(logEntry);
-            const std::string& registryName = std::get<3>(logEntry);
-            const std::string& messageKey = std::get<4>(logEntry);
-            const std::vector<std::string>& messageArgs = std::get<5>(logEntry);
-
             // If registryPrefixes list is empty, don't filter events
             // send everything.
-            if (registryPrefixes.size())
+            if (!prefixSet.empty() &&
+                prefixSet.count(logEntry.registryName) == 0)
             {
-                auto obj = std::find(registryPrefixes.begin(),
-                                     registryPrefixes.end(), registryName);
-                if (obj == registryPrefixes.end())
-                {
-                    continue;
-                }
+                continue;
             }
 
             // If registryMsgIds list is empty, don't filter events
             // send everything.
-            if (registryMsgIds.size())
+            if (!msgIdSet.empty() && msgIdSet.count(logEntry.messageKey) == 0)
             {
-                auto obj = std::find(registryMsgIds.begin(),
-                                     registryMsgIds.end(), messageKey);
-                if (obj == registryMsgIds.end())
-                {
-                    continue;
-                }
-            }
-
-            logEntryArray.push_back({});
-            nlohmann::json& bmcLogEntry = logEntryArray.back();
-            if (event_log::formatEventLogEntry(idStr, messageID, messageArgs,
-                                               timestamp, customText,
-                                               bmcLogEntry) != 0)
-            {
-                BMCWEB_LOG_DEBUG << "Read eventLog entry failed";
                 continue;
             }
+
+            logEntryArray.push_back(logEntry.entry);
+            logEntryArray.back()["Context"] = customText;
         }
 
         if (logEntryArray.size() < 1)
@@ -511,9 +590,14 @@ class Subscription : public persistent_data::UserSubscription
     }
 #endif
 
+    // formattedMsg is shared across the update's fan-out: the first
+    // matching subscriber fills and serializes the report, everyone after
+    // reuses the bytes.  N pollers of M reports become one render and one
+    // push per report update.
     void filterAndSendReports(
         const std::string& id,
-        const std::variant<telemetry::TimestampReadings>& var)
+        const std::variant<telemetry::TimestampReadings>& var,
+        std::string& formattedMsg)
     {
         std::string mrdUri = telemetry::metricReportDefinitionUri + id;
 
@@ -528,17 +612,30 @@ class Subscription : public persistent_data::UserSubscription
             }
         }
 
-        nlohmann::json msg;
-        if (!telemetry::fillReport(msg, id, var))
+        if (formattedMsg.empty())
         {
-            BMCWEB_LOG_ERROR << "Failed to fill the MetricReport for DBus "
-                                "Report with id "
-                             << id;
-            return;
+            nlohmann::json msg;
+            if (!telemetry::fillReport(msg, id, var))
+            {
+                BMCWEB_LOG_ERROR << "Failed to fill the MetricReport for DBus "
+                                    "Report with id "
+                                 << id;
+                return;
+            }
+            formattedMsg = msg.dump(2, ' ', true,
+                                    nlohmann::json::error_handler_t::replace);
         }
 
-        this->sendEvent(
-            msg.dump(2, ' ', true, nlohmann::json::error_handler_t::replace));
+        this->sendEvent(formattedMsg);
+    }
+
+    size_t queuedBytes() const
+    {
+        if (conn == nullptr)
+        {
+            return 0;
+        }
+        return conn->queuedBytes();
     }
 
     void updateRetryConfig(const uint32_t retryAttempts,
@@ -575,8 +672,95 @@ class Subscription : public persistent_data::UserSubscription
     std::string port;
     std::string path;
     std::string uriProto;
-    std::shared_ptr<crow::HttpClient> conn = nullptr;
+    std::shared_ptr<crow::HttpClientPool> conn = nullptr;
     std::shared_ptr<crow::ServerSentEvents> sseConn = nullptr;
+    std::unique_ptr<crow::event_spool::EventSpool> spool;
+
+    // Defined after EventServiceManager: the observer resolves the
+    // subscription by id through the manager on every callback, so a
+    // client completion racing subscription deletion can never touch a
+    // dead Subscription
+    void installDeliveryObserver();
+
+    static constexpr uint32_t healthWindow = 10;
+    static constexpr uint32_t circuitCooldownSeconds = 30;
+    uint32_t windowSends = 0;
+    uint32_t windowFailures = 0;
+    uint64_t totalSends = 0;
+    uint64_t totalFailures = 0;
+    uint64_t lastLatencyUs = 0;
+    std::chrono::time_point<std::chrono::steady_clock> circuitOpenUntil{};
+
+    void ensureSpool()
+    {
+        if (spool == nullptr)
+        {
+            spool = std::make_unique<crow::event_spool::EventSpool>(
+                "/var/lib/bmcweb/event_spool_" + subId + ".bin");
+        }
+    }
+};
+
+// Bounded in-memory ring of formatted event payloads indexed by event id.
+// Ids are contiguous, so locating a resume point is arithmetic off the
+// front, never a scan: a client reconnecting with the last id it saw gets
+// exactly the missed suffix replayed from memory instead of forcing a
+// re-read of /var/log/redfish.  When the suffix has aged out of the ring
+// the caller is told to fall back to a full resync.
+class EventRing
+{
+  public:
+    static constexpr size_t capacity = 256;
+
+    void append(uint64_t id, const std::string& payload)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.size() >= capacity)
+        {
+            entries.pop_front();
+        }
+        entries.emplace_back(id, payload);
+    }
+
+    // Copies every payload newer than lastSeenId into out.  Returns false
+    // when events between lastSeenId and the ring's oldest entry have been
+    // evicted, in which case a replay would silently skip them.
+    bool collectSince(uint64_t lastSeenId,
+                      std::vector<std::string>& out) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.empty())
+        {
+            return true;
+        }
+        if (entries.front().first > lastSeenId + 1)
+        {
+            return false;
+        }
+        for (const std::pair<uint64_t, std::string>& entry : entries)
+        {
+            if (entry.first > lastSeenId)
+            {
+                out.push_back(entry.second);
+            }
+        }
+        return true;
+    }
+
+    size_t footprint() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t bytes = 0;
+        for (const std::pair<uint64_t, std::string>& entry : entries)
+        {
+            bytes += sizeof(entry) + entry.second.capacity();
+        }
+        return bytes;
+    }
+
+  private:
+    std::deque<std::pair<uint64_t, std::string>> entries;
+    mutable std::mutex mutex;
 };
 
 class EventServiceManager
@@ -594,6 +778,9 @@ class EventServiceManager
 
     std::string snmpDbusId;
     std::string lastEventTStr;
+    // Byte offset of the last fully parsed line in the redfish event log;
+    // lets a modify notification parse only the appended region.
+    size_t eventLogFileCursor{0};
     size_t noOfEventLogSubscribers{0};
     size_t noOfMetricReportSubscribers{0};
     std::shared_ptr<sdbusplus::bus::match::match> matchTelemetryMonitor;
@@ -601,6 +788,7 @@ class EventServiceManager
         subscriptionsMap;
 
     uint64_t eventId{1};
+    EventRing eventRing;
 
   public:
     EventServiceManager(const EventServiceManager&) = delete;
@@ -660,6 +848,7 @@ class EventServiceManager
             subValue->resourceTypes = newSub->resourceTypes;
             subValue->httpHeaders = newSub->httpHeaders;
             subValue->metricReportDefinitions = newSub->metricReportDefinitions;
+            subValue->includeDeltaPayload = newSub->includeDeltaPayload;
 
             if (subValue->id.empty())
             {
@@ -923,6 +1112,7 @@ class EventServiceManager
         newSub->resourceTypes = subValue->resourceTypes;
         newSub->httpHeaders = subValue->httpHeaders;
         newSub->metricReportDefinitions = subValue->metricReportDefinitions;
+        newSub->includeDeltaPayload = subValue->includeDeltaPayload;
         persistent_data::EventServiceStore::getInstance()
             .subscriptionsConfigMap.emplace(newSub->id, newSub);
 
@@ -962,6 +1152,11 @@ class EventServiceManager
         if (obj != subscriptionsMap.end())
         {
             subscriptionsMap.erase(obj);
+            // A deleted subscription's outage backlog goes with it
+            std::error_code ec;
+            std::filesystem::remove("/var/lib/bmcweb/event_spool_" + id +
+                                        ".bin",
+                                    ec);
             auto obj2 = persistent_data::EventServiceStore::getInstance()
                             .subscriptionsConfigMap.find(id);
             persistent_data::EventServiceStore::getInstance()
@@ -971,6 +1166,18 @@ class EventServiceManager
         }
     }
 
+    // Resident bytes across subscriber queues and the resume ring;
+    // scrape-time only
+    size_t memoryFootprint()
+    {
+        size_t bytes = eventRing.footprint();
+        for (const auto& it : subscriptionsMap)
+        {
+            bytes += sizeof(Subscription) + it.second->queuedBytes();
+        }
+        return bytes;
+    }
+
     size_t getNumberOfSubscriptions()
     {
         return subscriptionsMap.size();
@@ -1011,6 +1218,19 @@ class EventServiceManager
 
     void sendEvent(const nlohmann::json& eventMessageIn,
                    const std::string& origin, const std::string& resType)
+    {
+        sendEvent(eventMessageIn, origin, resType, nlohmann::json());
+    }
+
+    // delta, when non-null, is a JSON merge-patch of exactly the changed
+    // Redfish properties.  Subscriptions that opted in with
+    // IncludeDeltaPayload receive it under Oem.OpenBMC.DeltaPayload and can
+    // update a mirror without re-GETting the resource; everyone else gets
+    // the classic resource-changed notification.  Each variant serializes
+    // at most once per event, however many subscribers share it.
+    void sendEvent(const nlohmann::json& eventMessageIn,
+                   const std::string& origin, const std::string& resType,
+                   const nlohmann::json& delta)
     {
         if (!serviceEnabled || !noOfEventLogSubscribers)
         {
@@ -1034,6 +1254,16 @@ class EventServiceManager
         }
         eventRecord.push_back(eventMessage);
 
+        nlohmann::json deltaRecord;
+        if (!delta.is_null())
+        {
+            deltaRecord = eventRecord;
+            deltaRecord[0]["Oem"]["OpenBMC"]["DeltaPayload"] = delta;
+        }
+
+        std::string formattedMsg;
+        std::string formattedDeltaMsg;
+        bool eventSent = false;
         for (const auto& it : this->subscriptionsMap)
         {
             std::shared_ptr<Subscription> entry = it.second;
@@ -1060,33 +1290,73 @@ class EventServiceManager
             }
             if (isSubscribed)
             {
-                nlohmann::json msgJson = {
-                    {"@odata.type", "#Event.v1_4_0.Event"},
-                    {"Name", "Event Log"},
-                    {"Id", eventId},
-                    {"Events", eventRecord}};
-                entry->sendEvent(msgJson.dump(
-                    2, ' ', true, nlohmann::json::error_handler_t::replace));
-                eventId++; // increament the eventId
+                bool wantsDelta =
+                    entry->includeDeltaPayload && !delta.is_null();
+                std::string& variant =
+                    wantsDelta ? formattedDeltaMsg : formattedMsg;
+                if (variant.empty())
+                {
+                    // Format and serialize once per variant; subscribers
+                    // get the same payload with the same Id
+                    nlohmann::json msgJson = {
+                        {"@odata.type", "#Event.v1_4_0.Event"},
+                        {"Name", "Event Log"},
+                        {"Id", eventId},
+                        {"Events",
+                         wantsDelta ? deltaRecord : eventRecord}};
+                    variant = msgJson.dump(
+                        2, ' ', true,
+                        nlohmann::json::error_handler_t::replace);
+                }
+                entry->sendEvent(variant);
+                eventSent = true;
             }
             else
             {
                 BMCWEB_LOG_INFO << "Not subscribed to this resource";
             }
         }
+        if (eventSent)
+        {
+            // Remember the payload for Last-Event-ID style resume; prefer
+            // the classic form, which any subscriber can digest on replay
+            eventRing.append(eventId, formattedMsg.empty() ? formattedDeltaMsg
+                                                           : formattedMsg);
+            eventId++; // increament the eventId
+        }
+    }
+
+    // Replays the events a reconnecting subscriber missed, straight from
+    // the ring.  Returns false when the suffix has aged out and the client
+    // must resynchronize in full.
+    bool resumeSubscription(uint64_t lastSeenEventId, Subscription& entry)
+    {
+        std::vector<std::string> missed;
+        if (!eventRing.collectSince(lastSeenEventId, missed))
+        {
+            return false;
+        }
+        for (std::string& payload : missed)
+        {
+            entry.sendEvent(std::move(payload));
+        }
+        return true;
     }
+
     void sendBroadcastMsg(const std::string& broadcastMsg)
     {
+        // Format and serialize once; the payload is identical per subscriber
+        nlohmann::json msgJson = {
+            {"Timestamp", crow::utility::getDateTimeOffsetNow().first},
+            {"OriginOfCondition", "/ibm/v1/HMC/BroadcastService"},
+            {"Name", "Broadcast Message"},
+            {"Message", broadcastMsg}};
+        std::string formattedMsg = msgJson.dump(
+            2, ' ', true, nlohmann::json::error_handler_t::replace);
         for (const auto& it : this->subscriptionsMap)
         {
             std::shared_ptr<Subscription> entry = it.second;
-            nlohmann::json msgJson = {
-                {"Timestamp", crow::utility::getDateTimeOffsetNow().first},
-                {"OriginOfCondition", "/ibm/v1/HMC/BroadcastService"},
-                {"Name", "Broadcast Message"},
-                {"Message", broadcastMsg}};
-            entry->sendEvent(msgJson.dump(
-                2, ' ', true, nlohmann::json::error_handler_t::replace));
+            entry->sendEvent(formattedMsg);
         }
     }
 
@@ -1094,6 +1364,9 @@ class EventServiceManager
     void cacheLastEventTimestamp()
     {
         lastEventTStr.clear();
+        // Resync point (startup or log rotation): drop the byte cursor so
+        // the next pass rescans from the start with the timestamp match.
+        eventLogFileCursor = 0;
         std::ifstream logStream(redfishEventLogFile);
         if (!logStream.good())
         {
@@ -1129,15 +1402,36 @@ class EventServiceManager
             return;
         }
 
+        // Incremental tail: parse only the region appended since the last
+        // pass.  A file smaller than the cursor means rotation; restart from
+        // the beginning and fall back to the timestamp match.
+        logStream.seekg(0, std::ios::end);
+        size_t fileSize = static_cast<size_t>(logStream.tellg());
+        bool fullScan = false;
+        if (eventLogFileCursor == 0 || fileSize < eventLogFileCursor)
+        {
+            fullScan = true;
+            eventLogFileCursor = 0;
+        }
+        logStream.seekg(static_cast<std::streamoff>(eventLogFileCursor));
+
         std::vector<EventLogObjectsType> eventRecords;
 
         bool startLogCollection = false;
         bool firstEntry = true;
+        size_t parsedUpTo = eventLogFileCursor;
 
         std::string logEntry;
         while (std::getline(logStream, logEntry))
         {
-            if (!startLogCollection && !lastEventTStr.empty())
+            if (logStream.eof())
+            {
+                // Final line had no newline yet; the writer is mid-append.
+                // Leave it for the next modify notification.
+                break;
+            }
+            parsedUpTo = static_cast<size_t>(logStream.tellg());
+            if (!startLogCollection && fullScan && !lastEventTStr.empty())
             {
                 if (boost::starts_with(logEntry, lastEventTStr))
                 {
@@ -1177,126 +1471,108 @@ class EventServiceManager
                                       messageKey, messageArgs);
         }
 
+        eventLogFileCursor = parsedUpTo;
+
+        // Format each record once; subscribers filter on the preparsed
+        // registry metadata instead of re-running message substitution.
+        std::vector<FormattedEventLogEntry> formattedRecords;
+        formattedRecords.reserve(eventRecords.size());
+        for (const EventLogObjectsType& logEntry : eventRecords)
+        {
+            FormattedEventLogEntry& formatted =
+                formattedRecords.emplace_back();
+            formatted.registryName = std::get<3>(logEntry);
+            formatted.messageKey = std::get<4>(logEntry);
+            if (event_log::formatEventLogEntry(
+                    std::get<0>(logEntry), std::get<2>(logEntry),
+                    std::get<5>(logEntry), std::get<1>(logEntry), "",
+                    formatted.entry) != 0)
+            {
+                BMCWEB_LOG_DEBUG << "Read eventLog entry failed";
+                formattedRecords.pop_back();
+            }
+        }
+
         for (const auto& it : this->subscriptionsMap)
         {
             std::shared_ptr<Subscription> entry = it.second;
             if (entry->eventFormatType == "Event")
             {
-                entry->filterAndSendEventLogs(eventRecords);
+                entry->filterAndSendEventLogs(formattedRecords);
             }
         }
     }
 
-    static void watchRedfishEventLogFile()
+    // Dispatched by the shared inotify hub for events on /var/log; manages
+    // the per-file watch as the redfish log is rotated
+    static void onEventLogDirEvent(const inotify_event& event,
+                                   const std::string& name)
     {
-        if (!inotifyConn)
+        if (name != "redfish")
         {
             return;
         }
+        BMCWEB_LOG_DEBUG << "Redfish log file created/deleted. event.name: "
+                         << name;
+        crow::inotify_hub::InotifyHub& hub =
+            crow::inotify_hub::InotifyHub::getInstance();
+        if (event.mask == IN_CREATE)
+        {
+            if (fileWatchDesc != -1)
+            {
+                BMCWEB_LOG_DEBUG << "Remove and Add inotify watcher on "
+                                    "redfish event log file";
+                // Remove existing inotify watcher and add with new redfish
+                // event log file.
+                hub.removeWatch(fileWatchDesc);
+                fileWatchDesc = -1;
+            }
 
-        static std::array<char, 1024> readBuffer;
-
-        inotifyConn->async_read_some(
-            boost::asio::buffer(readBuffer),
-            [&](const boost::system::error_code& ec,
-                const std::size_t& bytesTransferred) {
-                if (ec)
-                {
-                    BMCWEB_LOG_ERROR << "Callback Error: " << ec.message();
-                    return;
-                }
-                std::size_t index = 0;
-                while ((index + iEventSize) <= bytesTransferred)
-                {
-                    struct inotify_event event;
-                    std::memcpy(&event, &readBuffer[index], iEventSize);
-                    if (event.wd == dirWatchDesc)
-                    {
-                        if ((event.len == 0) ||
-                            (index + iEventSize + event.len > bytesTransferred))
-                        {
-                            index += (iEventSize + event.len);
-                            continue;
-                        }
-
-                        std::string fileName(&readBuffer[index + iEventSize],
-                                             event.len);
-                        if (std::strcmp(fileName.c_str(), "redfish") != 0)
-                        {
-                            index += (iEventSize + event.len);
-                            continue;
-                        }
+            fileWatchDesc = hub.addWatch(redfishEventLogFile, IN_MODIFY,
+                                         &onEventLogFileEvent);
+            if (fileWatchDesc == -1)
+            {
+                BMCWEB_LOG_ERROR
+                    << "inotify_add_watch failed for redfish log file.";
+                return;
+            }
 
-                        BMCWEB_LOG_DEBUG
-                            << "Redfish log file created/deleted. event.name: "
-                            << fileName;
-                        if (event.mask == IN_CREATE)
-                        {
-                            if (fileWatchDesc != -1)
-                            {
-                                BMCWEB_LOG_DEBUG
-                                    << "Remove and Add inotify watcher on "
-                                       "redfish event log file";
-                                // Remove existing inotify watcher and add
-                                // with new redfish event log file.
-                                inotify_rm_watch(inotifyFd, fileWatchDesc);
-                                fileWatchDesc = -1;
-                            }
-
-                            fileWatchDesc = inotify_add_watch(
-                                inotifyFd, redfishEventLogFile, IN_MODIFY);
-                            if (fileWatchDesc == -1)
-                            {
-                                BMCWEB_LOG_ERROR
-                                    << "inotify_add_watch failed for "
-                                       "redfish log file.";
-                                return;
-                            }
-
-                            EventServiceManager::getInstance()
-                                .cacheLastEventTimestamp();
-                            EventServiceManager::getInstance()
-                                .readEventLogsFromFile();
-                        }
-                        else if ((event.mask == IN_DELETE) ||
-                                 (event.mask == IN_MOVED_TO))
-                        {
-                            if (fileWatchDesc != -1)
-                            {
-                                inotify_rm_watch(inotifyFd, fileWatchDesc);
-                                fileWatchDesc = -1;
-                            }
-                        }
-                    }
-                    else if (event.wd == fileWatchDesc)
-                    {
-                        if (event.mask == IN_MODIFY)
-                        {
-                            EventServiceManager::getInstance()
-                                .readEventLogsFromFile();
-                        }
-                    }
-                    index += (iEventSize + event.len);
-                }
+            EventServiceManager::getInstance().cacheLastEventTimestamp();
+            EventServiceManager::getInstance().readEventLogsFromFile();
+        }
+        else if ((event.mask == IN_DELETE) || (event.mask == IN_MOVED_TO))
+        {
+            if (fileWatchDesc != -1)
+            {
+                hub.removeWatch(fileWatchDesc);
+                fileWatchDesc = -1;
+            }
+        }
+    }
 
-                watchRedfishEventLogFile();
-            });
+    static void onEventLogFileEvent(const inotify_event& event,
+                                    const std::string&)
+    {
+        if (event.mask == IN_MODIFY)
+        {
+            EventServiceManager::getInstance().readEventLogsFromFile();
+        }
     }
 
     static int startEventLogMonitor(boost::asio::io_context& ioc)
     {
-        inotifyConn.emplace(ioc);
-        inotifyFd = inotify_init1(IN_NONBLOCK);
-        if (inotifyFd == -1)
+        crow::inotify_hub::InotifyHub& hub =
+            crow::inotify_hub::InotifyHub::getInstance();
+        if (!hub.start(ioc))
         {
-            BMCWEB_LOG_ERROR << "inotify_init1 failed.";
             return -1;
         }
 
         // Add watch on directory to handle redfish event log file
         // create/delete.
-        dirWatchDesc = inotify_add_watch(inotifyFd, redfishEventLogDir,
-                                         IN_CREATE | IN_MOVED_TO | IN_DELETE);
+        dirWatchDesc = hub.addWatch(redfishEventLogDir,
+                                    IN_CREATE | IN_MOVED_TO | IN_DELETE,
+                                    &onEventLogDirEvent);
         if (dirWatchDesc == -1)
         {
             BMCWEB_LOG_ERROR
@@ -1306,7 +1582,7 @@ class EventServiceManager
 
         // Watch redfish event log file for modifications.
         fileWatchDesc =
-            inotify_add_watch(inotifyFd, redfishEventLogFile, IN_MODIFY);
+            hub.addWatch(redfishEventLogFile, IN_MODIFY, &onEventLogFileEvent);
         if (fileWatchDesc == -1)
         {
             BMCWEB_LOG_ERROR
@@ -1315,10 +1591,6 @@ class EventServiceManager
             // Watch on directory will handle create/delete of file.
         }
 
-        // monitor redfish event log file
-        inotifyConn->assign(inotifyFd);
-        watchRedfishEventLogFile();
-
         return 0;
     }
 
@@ -1351,13 +1623,15 @@ class EventServiceManager
 
         const std::variant<telemetry::TimestampReadings>& readings =
             found->second;
+        // Serialized at most once per update, shared by every subscriber
+        std::string formattedMsg;
         for (const auto& it :
              EventServiceManager::getInstance().subscriptionsMap)
         {
             Subscription& entry = *it.second.get();
             if (entry.eventFormatType == metricReportFormatType)
             {
-                entry.filterAndSendReports(id, readings);
+                entry.filterAndSendReports(id, readings, formattedMsg);
             }
         }
     }
@@ -1442,4 +1716,17 @@ class EventServiceManager
     }
 };
 
+inline void Subscription::installDeliveryObserver()
+{
+    std::string id = subId;
+    conn->setDeliveryObserver([id](bool ok, uint64_t latencyUs) {
+        std::shared_ptr<Subscription> subscription =
+            EventServiceManager::getInstance().getSubscription(id);
+        if (subscription != nullptr)
+        {
+            subscription->recordDeliveryOutcome(ok, latencyUs);
+        }
+    });
+}
+
 } // namespace redfish
@@ -184,6 +184,17 @@ class Privileges
         return (privilegeBitset & p.privilegeBitset) == p.privilegeBitset;
     }
 
+    /**
+     * @brief Returns the raw privilege bits, for precomputed mask checks
+     *
+     * @return               The bitset as an integer mask.
+     *
+     */
+    uint64_t mask() const
+    {
+        return privilegeBitset.to_ullong();
+    }
+
     /**
      * @brief Returns the intersection of two Privilege sets.
      *
@@ -56,6 +56,7 @@
 #include "../lib/thermal_subsystem.hpp"
 #include "../lib/update_service.hpp"
 #include "../lib/virtual_media.hpp"
+#include "redfish_aggregator.hpp"
 
 namespace redfish
 {
@@ -252,6 +253,10 @@ class RedfishService
         requestRoutesLicenseEntryCollection(app);
         requestRoutesLicenseEntry(app);
 #endif
+
+#ifdef BMCWEB_ENABLE_REDFISH_AGGREGATION
+        requestRoutesAggregation(app);
+#endif
     }
 };
 
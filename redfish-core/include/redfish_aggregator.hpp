@@ -0,0 +1,304 @@
+#pragma once
+
+#include <app.hpp>
+#include <dbus_utility.hpp>
+#include <error_messages.hpp>
+#include <http_client.hpp>
+#include <registries/privilege_registry.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace redfish
+{
+
+// Aggregation proxy: one management IP fronts the subordinate BMCs in a
+// multi-node chassis.  Satellites are discovered from entity-manager
+// SatelliteController configuration objects (Hostname + Port + AuthType,
+// which must be None - the satellite's chassis-internal interface runs
+// unauthenticated and the proxy performs the authentication and
+// authorization of the external client); each gets a
+// persistent ProxyClient connection, and requests under
+// /redfish/v1/Aggregated/<satellite>/<path> pass through with the upstream
+// status, content type and body returned verbatim.  The satellite
+// namespace keeps resource ids disjoint, which is also why aggregated
+// collections don't need a merge fan-out: the Aggregated collection lists
+// the satellites and each one's tree is browsed under its own prefix.
+class RedfishAggregator
+{
+  public:
+    static RedfishAggregator& getInstance()
+    {
+        static RedfishAggregator aggregator;
+        return aggregator;
+    }
+
+    // Discovers satellite configurations once; later calls are no-ops.
+    // Runs lazily on the first aggregation request so deployments without
+    // satellites never query for them.
+    void ensureDiscovered()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (discoveryStarted)
+            {
+                return;
+            }
+            discoveryStarted = true;
+        }
+        crow::connections::systemBus->async_method_call(
+            [this](const boost::system::error_code ec,
+                   const dbus::utility::MapperGetSubTreeResponse& subtree) {
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "Satellite discovery failed: " << ec;
+                    return;
+                }
+                for (const auto& [path, services] : subtree)
+                {
+                    if (services.empty())
+                    {
+                        continue;
+                    }
+                    loadSatelliteConfig(path, services[0].first);
+                }
+            },
+            "xyz.openbmc_project.ObjectMapper",
+            "/xyz/openbmc_project/object_mapper",
+            "xyz.openbmc_project.ObjectMapper", "GetSubTree",
+            "/xyz/openbmc_project/inventory", 0,
+            std::array<const char*, 1>{
+                "xyz.openbmc_project.Configuration.SatelliteController"});
+    }
+
+    // Copies the satellite names into a Members array
+    void listSatellites(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+    {
+        asyncResp->res.jsonValue["@odata.type"] =
+            "#Collection.Collection";
+        asyncResp->res.jsonValue["@odata.id"] = "/redfish/v1/Aggregated";
+        asyncResp->res.jsonValue["Name"] = "Aggregated BMC Collection";
+        nlohmann::json& members = asyncResp->res.jsonValue["Members"];
+        members = nlohmann::json::array();
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& [name, client] : satellites)
+        {
+            members.push_back(
+                {{"@odata.id",
+                  crow::utility::joinUrl("/redfish/v1/Aggregated/", name)}});
+        }
+        asyncResp->res.jsonValue["Members@odata.count"] = members.size();
+    }
+
+    // Forwards one request to the named satellite and mirrors the response
+    void forward(const crow::Request& req,
+                 const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+                 const std::string& satellite, const std::string& target)
+    {
+        std::shared_ptr<crow::ProxyClient> client;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = satellites.find(satellite);
+            if (it != satellites.end())
+            {
+                client = it->second;
+            }
+        }
+        if (client == nullptr)
+        {
+            messages::resourceNotFound(asyncResp->res, "AggregatedBmc",
+                                       satellite);
+            return;
+        }
+        boost::beast::http::request<boost::beast::http::string_body>
+            proxyReq{req.method(), target, 11};
+        proxyReq.body() = req.body;
+        // Forward content negotiation only.  The client's token is never
+        // forwarded (it means nothing on the satellite), and no proxy
+        // credential exists: discovery only admits satellites whose config
+        // declares AuthType None, i.e. an unauthenticated chassis-internal
+        // interface.
+        std::string_view accept = req.getHeaderValue("Accept");
+        if (!accept.empty())
+        {
+            proxyReq.set(boost::beast::http::field::accept, accept);
+        }
+        std::string_view contentType = req.getHeaderValue("Content-Type");
+        if (!contentType.empty())
+        {
+            proxyReq.set(boost::beast::http::field::content_type, contentType);
+        }
+        client->sendRequest(
+            std::move(proxyReq),
+            [asyncResp](const boost::system::error_code ec,
+                        crow::ProxyClient::ProxyResponse& resp) {
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "Satellite request failed: "
+                                     << ec.message();
+                    messages::internalError(asyncResp->res);
+                    return;
+                }
+                asyncResp->res.result(resp.result());
+                std::string_view respType =
+                    resp[boost::beast::http::field::content_type];
+                if (!respType.empty())
+                {
+                    asyncResp->res.addHeader(
+                        boost::beast::http::field::content_type, respType);
+                }
+                asyncResp->res.body() = std::move(resp.body());
+            });
+    }
+
+  private:
+    RedfishAggregator() = default;
+
+    void loadSatelliteConfig(const std::string& path,
+                             const std::string& service)
+    {
+        crow::connections::systemBus->async_method_call(
+            [this, path](
+                const boost::system::error_code ec,
+                const std::vector<
+                    std::pair<std::string, dbus::utility::DbusVariantType>>&
+                    properties) {
+                if (ec)
+                {
+                    BMCWEB_LOG_ERROR << "Satellite config read failed for "
+                                     << path << ": " << ec;
+                    return;
+                }
+                std::string name;
+                std::string hostname;
+                std::string authType;
+                uint64_t port = 0;
+                for (const auto& [key, value] : properties)
+                {
+                    if (key == "Name")
+                    {
+                        const std::string* str =
+                            std::get_if<std::string>(&value);
+                        if (str != nullptr)
+                        {
+                            name = *str;
+                        }
+                    }
+                    else if (key == "Hostname")
+                    {
+                        const std::string* str =
+                            std::get_if<std::string>(&value);
+                        if (str != nullptr)
+                        {
+                            hostname = *str;
+                        }
+                    }
+                    else if (key == "Port")
+                    {
+                        const uint64_t* value64 =
+                            std::get_if<uint64_t>(&value);
+                        if (value64 != nullptr)
+                        {
+                            port = *value64;
+                        }
+                    }
+                    else if (key == "AuthType")
+                    {
+                        const std::string* str =
+                            std::get_if<std::string>(&value);
+                        if (str != nullptr)
+                        {
+                            authType = *str;
+                        }
+                    }
+                }
+                if (name.empty() || hostname.empty() || port == 0 ||
+                    port > 65535)
+                {
+                    BMCWEB_LOG_ERROR << "Incomplete satellite config at "
+                                     << path;
+                    return;
+                }
+                // The proxy sends no credentials of its own and never
+                // forwards the client's token, so the only supported trust
+                // model is an explicit no-auth satellite: the satellite's
+                // chassis-internal interface must be configured with
+                // authentication disabled, and its config must say so.
+                // Anything else would 401 on every proxied request, so
+                // refuse it at discovery instead of failing silently later.
+                if (authType != "None")
+                {
+                    BMCWEB_LOG_ERROR
+                        << "Satellite " << name << " at " << path
+                        << " requires AuthType None (got '" << authType
+                        << "'); not aggregating";
+                    return;
+                }
+                BMCWEB_LOG_INFO << "Aggregating satellite " << name << " at "
+                                << hostname << ":" << port;
+                auto client = std::make_shared<crow::ProxyClient>(
+                    crow::connections::systemBus->get_io_context(), hostname,
+                    std::to_string(port));
+                std::lock_guard<std::mutex> lock(mutex);
+                satellites[name] = std::move(client);
+            },
+            service, path, "org.freedesktop.DBus.Properties", "GetAll",
+            "xyz.openbmc_project.Configuration.SatelliteController");
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<crow::ProxyClient>>
+        satellites;
+    bool discoveryStarted = false;
+    std::mutex mutex;
+};
+
+inline void requestRoutesAggregation(App& app)
+{
+    BMCWEB_ROUTE(app, "/redfish/v1/Aggregated/")
+        .privileges({{"Login"}})
+        .methods(boost::beast::http::verb::get)(
+            [](const crow::Request&,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                RedfishAggregator::getInstance().ensureDiscovered();
+                RedfishAggregator::getInstance().listSatellites(asyncResp);
+            });
+
+    // Reads need Login; anything that can change satellite state needs
+    // ConfigureManager
+    BMCWEB_ROUTE(app, "/redfish/v1/Aggregated/<str>/<path>")
+        .privileges({{"Login"}})
+        .methods(boost::beast::http::verb::get)(
+            [](const crow::Request& req,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+               const std::string& satellite, const std::string& path) {
+                RedfishAggregator::getInstance().ensureDiscovered();
+                std::string target = "/redfish/v1/" + path;
+                // Query parameters ride along to the satellite
+                std::string_view original = req.target();
+                std::size_t queryPos = original.find('?');
+                if (queryPos != std::string_view::npos)
+                {
+                    target.append(original.substr(queryPos));
+                }
+                RedfishAggregator::getInstance().forward(req, asyncResp,
+                                                         satellite, target);
+            });
+
+    BMCWEB_ROUTE(app, "/redfish/v1/Aggregated/<str>/<path>")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::post,
+                 boost::beast::http::verb::patch,
+                 boost::beast::http::verb::put,
+                 boost::beast::http::verb::delete_)(
+            [](const crow::Request& req,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+               const std::string& satellite, const std::string& path) {
+                RedfishAggregator::getInstance().ensureDiscovered();
+                RedfishAggregator::getInstance().forward(
+                    req, asyncResp, satellite, "/redfish/v1/" + path);
+            });
+}
+
+} // namespace redfish
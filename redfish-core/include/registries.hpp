@@ -14,6 +14,17 @@
 // limitations under the License.
 */
 #pragma once
+
+#include <boost/beast/core/span.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace redfish::message_registries
 {
 struct Header
@@ -40,4 +51,80 @@ struct Message
     const char* resolution;
 };
 using MessageEntry = std::pair<const char*, const Message>;
+
+// Hashed index over a registry array, built once per registry on first
+// lookup, so MessageKey resolution during event formatting is O(1) instead
+// of a linear scan over the entry arrays.  The registries are immutable
+// constexpr data, so the index never invalidates; lookups all happen on the
+// primary io thread - route handlers are pinned there even when transport
+// reactors are sharded - so no locking is needed.
+inline const Message*
+    findMessage(const boost::beast::span<const MessageEntry>& registry,
+                const std::string_view messageKey)
+{
+    static std::unordered_map<
+        const MessageEntry*,
+        std::unordered_map<std::string_view, const Message*>>
+        indexes;
+    std::unordered_map<std::string_view, const Message*>& index =
+        indexes[registry.data()];
+    if (index.empty())
+    {
+        index.reserve(registry.size());
+        for (const MessageEntry& entry : registry)
+        {
+            index.emplace(entry.first, &entry.second);
+        }
+    }
+    auto it = index.find(messageKey);
+    if (it == index.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+// Substitutes %1..%9 placeholders in one pass over the message template,
+// instead of a find/replace rescan per argument.  Argument values are
+// copied verbatim; placeholders inside them are never re-expanded.  Takes
+// any random-access container of std::string (vector or span).
+template <typename Args>
+inline std::string fillMessageArgs(const Args& messageArgs,
+                                   const std::string_view msg)
+{
+    std::string ret;
+    ret.reserve(msg.size());
+    size_t pos = 0;
+    while (pos < msg.size())
+    {
+        size_t percent = msg.find('%', pos);
+        if (percent == std::string_view::npos)
+        {
+            ret.append(msg.substr(pos));
+            break;
+        }
+        ret.append(msg.substr(pos, percent - pos));
+        if (percent + 1 < msg.size() && msg[percent + 1] >= '1' &&
+            msg[percent + 1] <= '9')
+        {
+            size_t argIndex = static_cast<size_t>(msg[percent + 1] - '1');
+            if (argIndex < messageArgs.size())
+            {
+                ret += messageArgs[argIndex];
+            }
+            else
+            {
+                // No argument provided; keep the placeholder literal
+                ret.append(msg.substr(percent, 2));
+            }
+            pos = percent + 2;
+        }
+        else
+        {
+            ret += '%';
+            pos = percent + 1;
+        }
+    }
+    return ret;
+}
 } // namespace redfish::message_registries
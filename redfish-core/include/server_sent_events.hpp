@@ -23,10 +23,10 @@
 #include <boost/beast/version.hpp>
 
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <iostream>
 #include <memory>
-#include <queue>
 #include <string>
 
 namespace crow
@@ -51,11 +51,13 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
 {
   private:
     std::shared_ptr<boost::beast::tcp_stream> sseConn;
-    std::queue<std::pair<uint64_t, std::string>> requestDataQueue;
+    std::deque<std::pair<uint64_t, std::string>> requestDataQueue;
     std::string outBuffer;
     SseConnState state;
     int retryCount;
     int maxRetryAttempts;
+    uint64_t droppedEvents = 0;
+    bool pendingResync = false;
 
     void sendEvent(const std::string& id, const std::string& msg)
     {
@@ -69,8 +71,26 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
         {
             return;
         }
+        if (state == SseConnState::sendFailed && !outBuffer.empty())
+        {
+            // Retry path: outBuffer still holds the unsent remainder of the
+            // front entry; resume the write instead of framing it again.
+            state = SseConnState::sendInProgress;
+            doWrite();
+            return;
+        }
         state = SseConnState::sendInProgress;
 
+        if (pendingResync)
+        {
+            // SSE comment frame telling the consumer that events were
+            // dropped under backpressure and it should resync its view
+            outBuffer += ": resync - ";
+            outBuffer += std::to_string(droppedEvents);
+            outBuffer += " events dropped\n\n";
+            pendingResync = false;
+        }
+
         if (!id.empty())
         {
             outBuffer += "id: ";
@@ -99,7 +119,7 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
             BMCWEB_LOG_DEBUG << "All data sent successfully.";
             // Send is successful, Lets remove data from queue
             // check for next request data in queue.
-            requestDataQueue.pop();
+            requestDataQueue.pop_front();
             state = SseConnState::idle;
             checkQueue();
             return;
@@ -116,7 +136,7 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
                 {
                     // Send is successful, Lets remove data from queue
                     // check for next request data in queue.
-                    self->requestDataQueue.pop();
+                    self->requestDataQueue.pop_front();
                     self->state = SseConnState::idle;
                     self->checkQueue();
                     return;
@@ -194,10 +214,7 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
             BMCWEB_LOG_ERROR << "Maximum number of retries is reached.";
 
             // Clear queue.
-            while (!requestDataQueue.empty())
-            {
-                requestDataQueue.pop();
-            }
+            requestDataQueue.clear();
 
             // TODO: Take 'DeliveryRetryPolicy' action.
             // For now, doing 'SuspendRetries' action.
@@ -268,22 +285,36 @@ class ServerSentEvents : public std::enable_shared_from_this<ServerSentEvents>
 
     ~ServerSentEvents() = default;
 
-    void sendData(const uint64_t& id, const std::string& data)
+    void sendData(const uint64_t& id, std::string data)
     {
         if (state == SseConnState::suspended)
         {
             return;
         }
 
-        if (requestDataQueue.size() <= maxReqQueueSize)
+        if (requestDataQueue.size() >= maxReqQueueSize)
         {
-            requestDataQueue.push(std::pair(id, data));
-            checkQueue(true);
-        }
-        else
-        {
-            BMCWEB_LOG_ERROR << "Request queue is full. So ignoring data.";
+            // High-water mark reached: drop the oldest unsent event and
+            // mark the stream for a resync comment instead of growing
+            // per-connection memory without bound.  The front entry may be
+            // mid-write, in which case the next oldest goes instead.
+            droppedEvents++;
+            pendingResync = true;
+            if (state == SseConnState::sendInProgress &&
+                requestDataQueue.size() > 1)
+            {
+                requestDataQueue.erase(requestDataQueue.begin() + 1);
+            }
+            else
+            {
+                requestDataQueue.pop_front();
+            }
+            BMCWEB_LOG_ERROR << "SSE request queue is full. Dropped oldest "
+                                "event ("
+                             << droppedEvents << " dropped total)";
         }
+        requestDataQueue.push_back(std::pair(id, std::move(data)));
+        checkQueue(true);
     }
 };
 
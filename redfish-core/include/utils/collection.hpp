@@ -1,8 +1,14 @@
 #pragma once
 
 #include <boost/container/flat_map.hpp>
+#include <dbus_utility.hpp>
+#include <human_sort.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace redfish
@@ -10,10 +16,94 @@ namespace redfish
 namespace collection_util
 {
 
+// Collection-member cache: one rendered, human-sorted Members array per
+// (collection path, subtree, interface list), maintained against mapper
+// signals.  Every collection GET across chassis, memory, processors and
+// storage funnels through getCollectionMembers, so a warm entry turns the
+// whole fan-out into a JSON copy.  Invalidation drops entries when objects
+// appear or disappear under the subtree; the matches register before the
+// first query leaves, so no inventory event can slip between query and
+// subscription.
+class CollectionCache
+{
+  public:
+    static CollectionCache& getInstance()
+    {
+        static CollectionCache cache;
+        return cache;
+    }
+
+    // Returns the rendered array, or nullptr when cold.  Also ensures the
+    // invalidation matches for this subtree exist before the caller's
+    // fallback query leaves.
+    std::shared_ptr<const nlohmann::json> tryGet(const std::string& key,
+                                                 const std::string& subtree)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ensureSubscribed(subtree);
+        auto it = rendered.find(key);
+        if (it == rendered.end())
+        {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    void store(const std::string& key, nlohmann::json&& members)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rendered[key] =
+            std::make_shared<const nlohmann::json>(std::move(members));
+    }
+
+  private:
+    CollectionCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed(const std::string& subtree)
+    {
+        if (matches.count(subtree) != 0)
+        {
+            return;
+        }
+        // Object churn anywhere under the subtree invalidates every entry;
+        // collections are cheap to rebuild and churn is rare
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            rendered.clear();
+        };
+        std::vector<sdbusplus::bus::match::match>& subtreeMatches =
+            matches[subtree];
+        subtreeMatches.reserve(2);
+        subtreeMatches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',path_namespace='" +
+                subtree + "'",
+            invalidate);
+        subtreeMatches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',path_namespace='" +
+                subtree + "'",
+            invalidate);
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<const nlohmann::json>>
+        rendered;
+    std::unordered_map<std::string, std::vector<sdbusplus::bus::match::match>>
+        matches;
+    std::mutex mutex;
+};
+
 /**
  * @brief Populate the collection "Members" from a GetSubTreePaths search of
  *        inventory
  *
+ * Served from CollectionCache once warm; members are sorted with the
+ * human-friendly collation used elsewhere in the tree so paging and
+ * clients see a stable order.
+ *
  * @param[i,o] aResp  Async response object
  * @param[i]   collectionPath  Redfish collection path which is used for the
  *             Members Redfish Path
@@ -29,8 +119,24 @@ inline void
                          const char* subtree = "/xyz/openbmc_project/inventory")
 {
     BMCWEB_LOG_DEBUG << "Get collection members for: " << collectionPath;
+    std::string key = collectionPath;
+    key += '\x01';
+    key += subtree;
+    for (const char* interface : interfaces)
+    {
+        key += '\x01';
+        key += interface;
+    }
+    std::shared_ptr<const nlohmann::json> cached =
+        CollectionCache::getInstance().tryGet(key, subtree);
+    if (cached != nullptr)
+    {
+        aResp->res.jsonValue["Members"] = *cached;
+        aResp->res.jsonValue["Members@odata.count"] = cached->size();
+        return;
+    }
     crow::connections::systemBus->async_method_call(
-        [collectionPath,
+        [collectionPath, key{std::move(key)},
          aResp{std::move(aResp)}](const boost::system::error_code ec,
                                   const std::vector<std::string>& objects) {
             if (ec)
@@ -39,9 +145,8 @@ inline void
                 messages::internalError(aResp->res);
                 return;
             }
-            nlohmann::json& members = aResp->res.jsonValue["Members"];
-            members = nlohmann::json::array();
-
+            std::vector<std::string> leaves;
+            leaves.reserve(objects.size());
             for (const auto& object : objects)
             {
                 sdbusplus::message::object_path path(object);
@@ -50,12 +155,21 @@ inline void
                 {
                     continue;
                 }
+                leaves.push_back(std::move(leaf));
+            }
+            std::sort(leaves.begin(), leaves.end(), AlphanumLess<std::string>());
+
+            nlohmann::json members = nlohmann::json::array();
+            for (std::string& leaf : leaves)
+            {
                 std::string newPath = collectionPath;
                 newPath += '/';
                 newPath += leaf;
                 members.push_back({{"@odata.id", std::move(newPath)}});
             }
+            aResp->res.jsonValue["Members"] = members;
             aResp->res.jsonValue["Members@odata.count"] = members.size();
+            CollectionCache::getInstance().store(key, std::move(members));
         },
         "xyz.openbmc_project.ObjectMapper",
         "/xyz/openbmc_project/object_mapper",
@@ -1,8 +1,14 @@
 #pragma once
+#include <openssl/sha.h>
+
 #include <async_resp.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -10,6 +16,41 @@ namespace redfish
 {
 namespace fw_util
 {
+// Writes an uploaded image to its staging path in bounded blocks, hashing
+// inline so the digest is ready the instant the last block lands instead of
+// requiring a second pass over a 128MB bundle.  The body stays owned by the
+// connection, so no second copy of the image exists; moving the write off
+// the io thread would need that ownership transferred, which the const
+// Request surface doesn't allow today.
+inline void writeImageFile(const std::string& filepath,
+                           const std::string_view body)
+{
+    std::ofstream out(filepath, std::ofstream::out | std::ofstream::binary |
+                                    std::ofstream::trunc);
+    SHA256_CTX shaCtx;
+    SHA256_Init(&shaCtx);
+    constexpr size_t blockSize = 1024 * 1024;
+    for (size_t offset = 0; offset < body.size(); offset += blockSize)
+    {
+        size_t chunk = std::min(blockSize, body.size() - offset);
+        out.write(body.data() + offset, static_cast<std::streamsize>(chunk));
+        SHA256_Update(&shaCtx, body.data() + offset, chunk);
+    }
+    out.close();
+
+    std::array<unsigned char, SHA256_DIGEST_LENGTH> digest{};
+    SHA256_Final(digest.data(), &shaCtx);
+    std::string digestHex;
+    digestHex.reserve(digest.size() * 2);
+    for (unsigned char byte : digest)
+    {
+        std::array<char, 3> hex{};
+        snprintf(hex.data(), hex.size(), "%02x", byte);
+        digestHex += hex.data();
+    }
+    BMCWEB_LOG_INFO << "Staged image " << filepath << " sha256 " << digestHex;
+}
+
 /* @brief String that indicates a bios firmware instance */
 constexpr const char* biosPurpose =
     "xyz.openbmc_project.Software.Version.VersionPurpose.Host";
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <dbus_utility.hpp>
 #include <utils/error_log_utils.hpp>
 
 #include <string>
@@ -278,8 +279,10 @@ inline void
                 return;
             }
 
-            // Get the HardwareIsolation DBus name
-            crow::connections::systemBus->async_method_call(
+            // Get the HardwareIsolation DBus name (cached in MapperCache)
+            dbus::utility::MapperCache::getInstance().getObject(
+                "/xyz/openbmc_project/hardware_isolation",
+                {"xyz.openbmc_project.HardwareIsolation.Create"},
                 [aResp, resourceObjPath, enabled, resourceName,
                  resourceId](const boost::system::error_code ec,
                              const GetObjectType& objType) {
@@ -323,13 +326,7 @@ inline void
                         deisolateResource(aResp, resourceObjPath,
                                           objType[0].first);
                     }
-                },
-                "xyz.openbmc_project.ObjectMapper",
-                "/xyz/openbmc_project/object_mapper",
-                "xyz.openbmc_project.ObjectMapper", "GetObject",
-                "/xyz/openbmc_project/hardware_isolation",
-                std::array<const char*, 1>{
-                    "xyz.openbmc_project.HardwareIsolation.Create"});
+                });
         },
         "xyz.openbmc_project.ObjectMapper",
         "/xyz/openbmc_project/object_mapper",
@@ -449,8 +446,11 @@ inline void
                 return;
             }
 
-            // Get the dbus service name of the hardware status event object
-            crow::connections::systemBus->async_method_call(
+            // Get the dbus service name of the hardware status event
+            // object (cached in MapperCache)
+            dbus::utility::MapperCache::getInstance().getObject(
+                hwStatusEventObj,
+                {"xyz.openbmc_project.Logging.Event"},
                 [aResp, hwStatusEventObj](const boost::system::error_code ec,
                                           const GetObjectType& objType) {
                     if (ec)
@@ -604,22 +604,11 @@ inline void
                                     std::vector<std::string> messageArgs{
                                         *msgPropVal};
 
-                                    // Fill the "msgPropVal" as reason
-                                    std::string message = msgReg->message;
-                                    int i = 0;
-                                    for (const std::string& messageArg :
-                                         messageArgs)
-                                    {
-                                        std::string argIndex =
-                                            "%" + std::to_string(++i);
-                                        size_t argPos = message.find(argIndex);
-                                        if (argPos != std::string::npos)
-                                        {
-                                            message.replace(argPos,
-                                                            argIndex.length(),
-                                                            messageArg);
-                                        }
-                                    }
+                                    // Fill the "msgPropVal" as reason in a
+                                    // single template pass
+                                    std::string message =
+                                        message_registries::fillMessageArgs(
+                                            messageArgs, msgReg->message);
                                     // Severity will be added based on the event
                                     // object property
                                     condition["Message"] = message;
@@ -657,13 +646,7 @@ inline void
                         },
                         objType[0].first, hwStatusEventObj,
                         "org.freedesktop.DBus.Properties", "GetAll", "");
-                },
-                "xyz.openbmc_project.ObjectMapper",
-                "/xyz/openbmc_project/object_mapper",
-                "xyz.openbmc_project.ObjectMapper", "GetObject",
-                hwStatusEventObj,
-                std::array<const char*, 1>{
-                    "xyz.openbmc_project.Logging.Event"});
+                });
         },
         "xyz.openbmc_project.ObjectMapper", resourceObjPath.str + "/event_log",
         "org.freedesktop.DBus.Properties", "Get",
@@ -21,6 +21,8 @@
 #include <nlohmann/json.hpp>
 
 #include <bitset>
+#include <string_view>
+#include <vector>
 
 namespace redfish
 {
@@ -383,6 +385,116 @@ bool handleMissing(std::bitset<Count>& handled, crow::Response& res,
     }
     return details::handleMissing<Index + 1, Count>(handled, res, in...) && ret;
 }
+inline void collectKeys(std::vector<std::string_view>&)
+{}
+
+template <typename ValueType, typename... UnpackTypes>
+void collectKeys(std::vector<std::string_view>& keys, const char* key,
+                 ValueType&, UnpackTypes&... in)
+{
+    keys.emplace_back(key);
+    collectKeys(keys, in...);
+}
+
+// SAX handler that validates a request body in one streaming pass: every
+// top-level key is checked against the unpack list and the parse aborts at
+// the first unknown one, so a 30MB body full of fields no handler asked for
+// rejects at parse speed without a DOM ever being built.  Values are never
+// materialized; the matching DOM parse only runs for bodies that pass.
+class UnpackKeyScanner
+{
+  public:
+    explicit UnpackKeyScanner(const std::vector<std::string_view>& keysIn) :
+        keys(keysIn)
+    {}
+
+    bool null()
+    {
+        return true;
+    }
+    bool boolean(bool)
+    {
+        return true;
+    }
+    bool number_integer(nlohmann::json::number_integer_t)
+    {
+        return true;
+    }
+    bool number_unsigned(nlohmann::json::number_unsigned_t)
+    {
+        return true;
+    }
+    bool number_float(nlohmann::json::number_float_t, const std::string&)
+    {
+        return true;
+    }
+    bool string(std::string&)
+    {
+        return true;
+    }
+    bool binary(nlohmann::json::binary_t&)
+    {
+        return true;
+    }
+    bool start_object(std::size_t)
+    {
+        depth++;
+        return true;
+    }
+    bool key(std::string& val)
+    {
+        if (depth != 1)
+        {
+            return true;
+        }
+        for (const std::string_view known : keys)
+        {
+            if (known == val)
+            {
+                return true;
+            }
+        }
+        unknownKey = val;
+        return false;
+    }
+    bool end_object()
+    {
+        depth--;
+        return true;
+    }
+    bool start_array(std::size_t)
+    {
+        depth++;
+        return true;
+    }
+    bool end_array()
+    {
+        depth--;
+        return true;
+    }
+    bool parse_error(std::size_t, const std::string&,
+                     const nlohmann::detail::exception&)
+    {
+        malformed = true;
+        return false;
+    }
+
+    const std::string& getUnknownKey() const
+    {
+        return unknownKey;
+    }
+    bool isMalformed() const
+    {
+        return malformed;
+    }
+
+  private:
+    const std::vector<std::string_view>& keys;
+    size_t depth = 0;
+    std::string unknownKey;
+    bool malformed = false;
+};
+
 } // namespace details
 
 template <typename... UnpackTypes>
@@ -422,6 +534,28 @@ template <typename... UnpackTypes>
 bool readJson(const crow::Request& req, crow::Response& res, const char* key,
               UnpackTypes&... in)
 {
+    // Streaming pre-check before any DOM exists: unknown-field-heavy or
+    // malformed bodies reject in one SAX pass with nothing materialized.
+    // Only bodies whose every top-level key is in the unpack list reach the
+    // DOM parse below, so its size is bounded by the fields actually used.
+    std::vector<std::string_view> keys;
+    keys.reserve((sizeof...(in) + 1) / 2);
+    details::collectKeys(keys, key, in...);
+    details::UnpackKeyScanner scanner(keys);
+    if (!nlohmann::json::sax_parse(req.body, &scanner))
+    {
+        if (scanner.isMalformed())
+        {
+            messages::malformedJSON(res);
+            res.end();
+            return false;
+        }
+        BMCWEB_LOG_DEBUG << "Request has unknown key "
+                         << scanner.getUnknownKey();
+        messages::propertyUnknown(res, scanner.getUnknownKey());
+        return false;
+    }
+
     nlohmann::json jsonRequest;
     if (!json_util::processJsonFromRequest(res, req, jsonRequest))
     {
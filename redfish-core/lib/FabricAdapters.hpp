@@ -1,5 +1,6 @@
 #pragma once
 
+#include <dbus_utility.hpp>
 #include <utils/collection.hpp>
 #include <utils/json_utils.hpp>
 #include <utils/name_utils.hpp>
@@ -182,7 +183,10 @@ inline void getAdapter(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
     aResp->res.jsonValue["@odata.id"] =
         "/redfish/v1/Systems/system/FabricAdapters/" + adapter;
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Item.FabricAdapter"},
         [adapter, aResp](const boost::system::error_code ec,
                          const MapperGetSubTreeResponse& subtree) {
             if (ec)
@@ -236,13 +240,7 @@ inline void getAdapter(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
             BMCWEB_LOG_ERROR << "Adapter not found";
             messages::resourceNotFound(aResp->res, "FabricAdapter", adapter);
             return;
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", 0,
-        std::array<const char*, 1>{
-            "xyz.openbmc_project.Inventory.Item.FabricAdapter"});
+        });
 }
 
 inline void requestRoutesFabricAdapterCollection(App& app)
@@ -81,6 +81,106 @@ using ManagedObjectType =
 using GetObjectType =
     std::vector<std::pair<std::string, std::vector<std::string>>>;
 
+// Mirror of the user manager's managed objects.  Auditing hits the account
+// collection every few minutes and each GET re-ran GetManagedObjects; keep
+// one snapshot and drop it whenever users are added, removed, renamed or
+// their properties change.
+class UserListCache
+{
+  public:
+    static UserListCache& getInstance()
+    {
+        static UserListCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void getManagedObjects(Callback&& callback)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            if (snapshot)
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     users{snapshot}]() mutable {
+                        callback(boost::system::error_code(), *users);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                ManagedObjectType& resp) mutable {
+                if (!ec)
+                {
+                    auto users = std::make_shared<ManagedObjectType>(resp);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshot = std::move(users);
+                }
+                callback(ec, resp);
+            },
+            "xyz.openbmc_project.User.Manager", "/xyz/openbmc_project/user",
+            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+    }
+
+    // Drops the snapshot immediately; the signal-driven invalidation also
+    // covers this, but an explicit call after a PATCH closes the window
+    // where a follow-up GET could read pre-update state
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        snapshot.reset();
+    }
+
+  private:
+    UserListCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed()
+    {
+        if (propertiesChangedMatch)
+        {
+            return;
+        }
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshot.reset();
+        };
+        propertiesChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',"
+            "path_namespace='/xyz/openbmc_project/user'",
+            invalidate);
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',path='/xyz/openbmc_project/user'",
+            invalidate);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',path='/xyz/openbmc_project/user'",
+            invalidate);
+        userRenamedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='xyz.openbmc_project.User.Manager',"
+            "member='UserRenamed'",
+            invalidate);
+    }
+
+    std::shared_ptr<const ManagedObjectType> snapshot;
+    std::optional<sdbusplus::bus::match::match> propertiesChangedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::optional<sdbusplus::bus::match::match> userRenamedMatch;
+    std::mutex mutex;
+};
+
 inline std::string getRoleIdFromPrivilege(std::string_view role)
 {
     if (role == "priv-admin")
@@ -1250,6 +1350,62 @@ inline void handleLDAPPatch(nlohmann::json& input,
     });
 }
 
+// Aggregates the concurrent property Sets of one account PATCH: the last
+// reference emits a single success (or the per-property failures already
+// recorded) and invalidates the account caches once, instead of each Set
+// racing to write messages and thrash the cache.
+class UserUpdateAggregator
+{
+  public:
+    UserUpdateAggregator(std::shared_ptr<bmcweb::AsyncResp> asyncRespIn,
+                         std::string usernameIn) :
+        asyncResp(std::move(asyncRespIn)),
+        username(std::move(usernameIn))
+    {}
+
+    ~UserUpdateAggregator()
+    {
+        if (!failed)
+        {
+            messages::success(asyncResp->res);
+        }
+        UserListCache::getInstance().invalidate();
+        PamAuthenticationCache::getInstance().invalidate(username);
+    }
+
+    UserUpdateAggregator(const UserUpdateAggregator&) = delete;
+    UserUpdateAggregator& operator=(const UserUpdateAggregator&) = delete;
+
+    // For errors whose message the caller already wrote (validation,
+    // PAM); suppresses the success record without another message
+    void validationFailed()
+    {
+        failed = true;
+    }
+
+    void propertyFailed(const std::string& property,
+                        const boost::system::error_code& ec)
+    {
+        BMCWEB_LOG_ERROR << "D-Bus error setting " << property << " for "
+                         << username << ": " << ec;
+        if (!failed)
+        {
+            failed = true;
+            messages::internalError(asyncResp->res);
+        }
+    }
+
+    const std::shared_ptr<bmcweb::AsyncResp>& response() const
+    {
+        return asyncResp;
+    }
+
+  private:
+    std::shared_ptr<bmcweb::AsyncResp> asyncResp;
+    std::string username;
+    bool failed = false;
+};
+
 inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                                  const std::string& username,
                                  std::optional<std::string> password,
@@ -1257,6 +1413,11 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                                  std::optional<std::string> roleId,
                                  std::optional<bool> locked)
 {
+    // Dropped up front so a cached credential can not satisfy a login
+    // while the update is in flight; the aggregator drops it again at the
+    // end in case a concurrent login re-primed it mid-update.
+    PamAuthenticationCache::getInstance().invalidate(username);
+
     std::string dbusObjectPath = "/xyz/openbmc_project/user/" + username;
     dbus::utility::escapePathForDbus(dbusObjectPath);
 
@@ -1273,12 +1434,20 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                 return;
             }
 
+            // The operations below run concurrently and share one
+            // aggregator: a single success record (or the failures already
+            // written) and one cache invalidation when the last completion
+            // drops its reference
+            auto aggregator = std::make_shared<UserUpdateAggregator>(
+                asyncResp, username);
+
             if (password)
             {
                 int retval = pamUpdatePassword(username, *password);
 
                 if (retval == PAM_USER_UNKNOWN)
                 {
+                    aggregator->validationFailed();
                     messages::resourceNotFound(
                         asyncResp->res, "#ManagerAccount.v1_4_0.ManagerAccount",
                         username);
@@ -1286,12 +1455,14 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                 else if (retval == PAM_AUTHTOK_ERR)
                 {
                     // If password is invalid
+                    aggregator->validationFailed();
                     messages::propertyValueFormatError(asyncResp->res,
                                                        *password, "Password");
                     BMCWEB_LOG_ERROR << "pamUpdatePassword Failed";
                 }
                 else if (retval != PAM_SUCCESS)
                 {
+                    aggregator->validationFailed();
                     messages::internalError(asyncResp->res);
                     return;
                 }
@@ -1300,15 +1471,11 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
             if (enabled)
             {
                 crow::connections::systemBus->async_method_call(
-                    [asyncResp](const boost::system::error_code ec) {
+                    [aggregator](const boost::system::error_code ec) {
                         if (ec)
                         {
-                            BMCWEB_LOG_ERROR << "D-Bus responses error: " << ec;
-                            messages::internalError(asyncResp->res);
-                            return;
+                            aggregator->propertyFailed("UserEnabled", ec);
                         }
-                        messages::success(asyncResp->res);
-                        return;
                     },
                     "xyz.openbmc_project.User.Manager", dbusObjectPath.c_str(),
                     "org.freedesktop.DBus.Properties", "Set",
@@ -1321,6 +1488,7 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                 std::string priv = getPrivilegeFromRoleId(*roleId);
                 if (priv.empty())
                 {
+                    aggregator->validationFailed();
                     messages::propertyValueNotInList(asyncResp->res, *roleId,
                                                      "RoleId");
                     return;
@@ -1331,14 +1499,11 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                 }
 
                 crow::connections::systemBus->async_method_call(
-                    [asyncResp](const boost::system::error_code ec) {
+                    [aggregator](const boost::system::error_code ec) {
                         if (ec)
                         {
-                            BMCWEB_LOG_ERROR << "D-Bus responses error: " << ec;
-                            messages::internalError(asyncResp->res);
-                            return;
+                            aggregator->propertyFailed("UserPrivilege", ec);
                         }
-                        messages::success(asyncResp->res);
                     },
                     "xyz.openbmc_project.User.Manager", dbusObjectPath.c_str(),
                     "org.freedesktop.DBus.Properties", "Set",
@@ -1353,21 +1518,19 @@ inline void updateUserProperties(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                 // not be allowed to lock an account.
                 if (*locked)
                 {
+                    aggregator->validationFailed();
                     messages::propertyValueNotInList(asyncResp->res, "true",
                                                      "Locked");
                     return;
                 }
 
                 crow::connections::systemBus->async_method_call(
-                    [asyncResp](const boost::system::error_code ec) {
+                    [aggregator](const boost::system::error_code ec) {
                         if (ec)
                         {
-                            BMCWEB_LOG_ERROR << "D-Bus responses error: " << ec;
-                            messages::internalError(asyncResp->res);
-                            return;
+                            aggregator->propertyFailed(
+                                "UserLockedForFailedAttempt", ec);
                         }
-                        messages::success(asyncResp->res);
-                        return;
                     },
                     "xyz.openbmc_project.User.Manager", dbusObjectPath.c_str(),
                     "org.freedesktop.DBus.Properties", "Set",
@@ -1753,7 +1916,7 @@ inline void requestAccountServiceRoutes(App& app)
 
                 std::string thisUser = req.session->username;
 
-                crow::connections::systemBus->async_method_call(
+                UserListCache::getInstance().getManagedObjects(
                     [asyncResp, thisUser, effectiveUserPrivileges](
                         const boost::system::error_code ec,
                         const ManagedObjectType& users) {
@@ -1802,10 +1965,7 @@ inline void requestAccountServiceRoutes(App& app)
                         }
                         asyncResp->res.jsonValue["Members@odata.count"] =
                             memberArray.size();
-                    },
-                    "xyz.openbmc_project.User.Manager",
-                    "/xyz/openbmc_project/user",
-                    "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+                    });
             });
 
     BMCWEB_ROUTE(app, "/redfish/v1/AccountService/Accounts/")
@@ -1960,7 +2120,7 @@ inline void requestAccountServiceRoutes(App& app)
                 }
             }
 
-            crow::connections::systemBus->async_method_call(
+            UserListCache::getInstance().getManagedObjects(
                 [asyncResp, accountName](const boost::system::error_code ec,
                                          const ManagedObjectType& users) {
                     if (ec)
@@ -2108,9 +2268,7 @@ inline void requestAccountServiceRoutes(App& app)
                             "/xyz/openbmc_project/certs/ACF",
                             "xyz.openbmc_project.Certs.ACF", "GetACFInfo");
                     }
-                },
-                "xyz.openbmc_project.User.Manager", "/xyz/openbmc_project/user",
-                "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+                });
         });
 
     BMCWEB_ROUTE(app, "/redfish/v1/AccountService/Accounts/<str>/")
@@ -2348,6 +2506,8 @@ inline void requestAccountServiceRoutes(App& app)
                             return;
                         }
 
+                        PamAuthenticationCache::getInstance().invalidate(
+                            username);
                         messages::accountRemoved(asyncResp->res);
                     },
                     "xyz.openbmc_project.User.Manager", userPath,
@@ -50,7 +50,20 @@ inline void
         // Set the default Status
         tempyArray.at(assemblyIndex)["Status"]["Health"] = "OK";
 
-        crow::connections::systemBus->async_method_call(
+        // Memoized in the mapper cache, so repeat Assembly GETs and the
+        // per-element walk both stop re-asking the mapper
+        dbus::utility::MapperCache::getInstance().getObject(
+            assembly,
+            std::vector<std::string>{
+                "xyz.openbmc_project.Inventory.Item.Vrm",
+                "xyz.openbmc_project.Inventory.Item.Tpm",
+                "xyz.openbmc_project.Inventory.Item.Panel",
+                "xyz.openbmc_project.Inventory.Item.Battery",
+                "xyz.openbmc_project.Inventory.Item.DiskBackplane",
+                "xyz.openbmc_project.Inventory.Item.Board",
+                "xyz.openbmc_project.Inventory.Item.Connector",
+                "xyz.openbmc_project.Inventory.Item.Drive",
+                "xyz.openbmc_project.Inventory.Item.Board.Motherboard"},
             [aResp, assemblyIndex, assembly](
                 const boost::system::error_code ec,
                 const std::vector<
@@ -291,20 +304,7 @@ inline void
                     aResp->res.jsonValue["Assemblies"];
                 nlohmann::json& assemblyData = assemblyArray.at(assemblyIndex);
                 getLocationIndicatorActive(aResp, assembly, assemblyData);
-            },
-            "xyz.openbmc_project.ObjectMapper",
-            "/xyz/openbmc_project/object_mapper",
-            "xyz.openbmc_project.ObjectMapper", "GetObject", assembly,
-            std::array<const char*, 9>{
-                "xyz.openbmc_project.Inventory.Item.Vrm",
-                "xyz.openbmc_project.Inventory.Item.Tpm",
-                "xyz.openbmc_project.Inventory.Item.Panel",
-                "xyz.openbmc_project.Inventory.Item.Battery",
-                "xyz.openbmc_project.Inventory.Item.DiskBackplane",
-                "xyz.openbmc_project.Inventory.Item.Board",
-                "xyz.openbmc_project.Inventory.Item.Connector",
-                "xyz.openbmc_project.Inventory.Item.Drive",
-                "xyz.openbmc_project.Inventory.Item.Board.Motherboard"});
+            });
 
         assemblyIndex++;
     }
@@ -388,7 +388,18 @@ inline void checkAssemblyInterface(
     const std::string& chassisPath, std::vector<std::string>& assemblies,
     const bool& setLocationIndicatorActiveFlag, const crow::Request& req)
 {
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Item.Vrm",
+            "xyz.openbmc_project.Inventory.Item.Tpm",
+            "xyz.openbmc_project.Inventory.Item.Panel",
+            "xyz.openbmc_project.Inventory.Item.Battery",
+            "xyz.openbmc_project.Inventory.Item.DiskBackplane",
+            "xyz.openbmc_project.Inventory.Item.Board",
+            "xyz.openbmc_project.Inventory.Item.Connector",
+            "xyz.openbmc_project.Inventory.Item.Drive",
+            "xyz.openbmc_project.Inventory.Item.Board.Motherboard"},
         [aResp, chassisPath, assemblies, setLocationIndicatorActiveFlag, req](
             const boost::system::error_code ec,
             const std::vector<std::pair<
@@ -442,21 +453,7 @@ inline void checkAssemblyInterface(
                                           updatedAssemblyList);
                 }
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", int32_t(0),
-        std::array<const char*, 9>{
-            "xyz.openbmc_project.Inventory.Item.Vrm",
-            "xyz.openbmc_project.Inventory.Item.Tpm",
-            "xyz.openbmc_project.Inventory.Item.Panel",
-            "xyz.openbmc_project.Inventory.Item.Battery",
-            "xyz.openbmc_project.Inventory.Item.DiskBackplane",
-            "xyz.openbmc_project.Inventory.Item.Board",
-            "xyz.openbmc_project.Inventory.Item.Connector",
-            "xyz.openbmc_project.Inventory.Item.Drive",
-            "xyz.openbmc_project.Inventory.Item.Board.Motherboard"});
+        });
 }
 
 /**
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <app.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <utils/fw_utils.hpp>
 
@@ -61,6 +62,129 @@ enum PendingAttributesIndex
     pendingAttrType = 0,
     pendingAttrValue
 };
+
+// Mirror of the BIOS config manager's BaseBIOSTable.  The table is a
+// megabyte-scale variant map that every Bios GET and Settings PATCH used to
+// round-trip; keep one copy behind a shared_ptr together with a prebuilt
+// name -> (readonly, type) index for O(1) PATCH validation, dropped when the
+// manager signals PropertiesChanged.  Reads can arrive from reactor
+// threads, so the shared pointers swap under a lock.
+class BiosTableCache
+{
+  public:
+    static BiosTableCache& getInstance()
+    {
+        static BiosTableCache cache;
+        return cache;
+    }
+
+    using Table = std::shared_ptr<const BiosBaseTableType>;
+    using TypeIndex = std::shared_ptr<const boost::container::flat_map<
+        std::string, std::pair<bool, std::string>>>;
+
+    // callback(table, index); both null when the table can't be fetched
+    template <typename Callback>
+    void get(Callback&& callback)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            if (table != nullptr)
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     cachedTable{table}, cachedIndex{typeIndex}]() mutable {
+                        callback(cachedTable, cachedIndex);
+                    });
+                return;
+            }
+        }
+        dbus::utility::MapperCache::getInstance().getObject(
+            biosConfigPath, {},
+            [this, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const dbus::utility::MapperGetObjectResponse& objType) mutable {
+                if (ec || objType.empty())
+                {
+                    BMCWEB_LOG_ERROR << "ObjectMapper::GetObject call failed: "
+                                     << ec;
+                    callback(nullptr, nullptr);
+                    return;
+                }
+                crow::connections::systemBus->async_method_call(
+                    [this, callback{std::move(callback)}](
+                        const boost::system::error_code ec2,
+                        const std::variant<BiosBaseTableType>&
+                            retBiosTable) mutable {
+                        const BiosBaseTableType* baseBiosTable =
+                            std::get_if<BiosBaseTableType>(&retBiosTable);
+                        if (ec2 || baseBiosTable == nullptr)
+                        {
+                            BMCWEB_LOG_ERROR << "getBiosAttributes DBUS error: "
+                                             << ec2;
+                            callback(nullptr, nullptr);
+                            return;
+                        }
+                        auto newTable = std::make_shared<BiosBaseTableType>(
+                            *baseBiosTable);
+                        auto newIndex = std::make_shared<
+                            boost::container::flat_map<
+                                std::string, std::pair<bool, std::string>>>();
+                        newIndex->reserve(newTable->size());
+                        for (const BiosBaseTableItemType& item : *newTable)
+                        {
+                            newIndex->try_emplace(
+                                item.first,
+                                std::make_pair(std::get<biosBaseReadonlyStatus>(
+                                                   item.second),
+                                               std::get<biosBaseAttrType>(
+                                                   item.second)));
+                        }
+                        Table localTable = std::move(newTable);
+                        TypeIndex localIndex = std::move(newIndex);
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            table = localTable;
+                            typeIndex = localIndex;
+                        }
+                        callback(localTable, localIndex);
+                    },
+                    objType.begin()->first, biosConfigPath,
+                    "org.freedesktop.DBus.Properties", "Get",
+                    "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable");
+            });
+    }
+
+  private:
+    BiosTableCache() = default;
+
+    static constexpr const char* biosConfigPath =
+        "/xyz/openbmc_project/bios_config/manager";
+
+    void ensureSubscribed()
+    {
+        if (propertiesChangedMatch)
+        {
+            return;
+        }
+        propertiesChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',"
+            "path='/xyz/openbmc_project/bios_config/manager'",
+            [this](sdbusplus::message::message&) {
+                std::lock_guard<std::mutex> lock(mutex);
+                table.reset();
+                typeIndex.reset();
+            });
+    }
+
+    Table table;
+    TypeIndex typeIndex;
+    std::optional<sdbusplus::bus::match::match> propertiesChangedMatch;
+    std::mutex mutex;
+};
 static std::string mapAttrTypeToRedfish(const std::string_view typeDbus)
 {
     std::string ret;
@@ -162,77 +286,45 @@ inline void
     asyncResp->res.jsonValue["AttributeRegistry"] = "BiosAttributeRegistry";
     asyncResp->res.jsonValue["Attributes"] = {};
 
-    crow::connections::systemBus->async_method_call(
-        [asyncResp](const boost::system::error_code ec,
-                    const GetObjectType& getObjectType) {
-            if (ec)
+    BiosTableCache::getInstance().get(
+        [asyncResp](const BiosTableCache::Table& baseBiosTable,
+                    const BiosTableCache::TypeIndex&) {
+            nlohmann::json& attributesJson =
+                asyncResp->res.jsonValue["Attributes"];
+            if (baseBiosTable == nullptr)
             {
-                BMCWEB_LOG_ERROR << "ObjectMapper::GetObject call failed: "
-                                 << ec;
+                BMCWEB_LOG_ERROR << "baseBiosTable == nullptr ";
                 messages::internalError(asyncResp->res);
-
                 return;
             }
-            const std::string& service = getObjectType.begin()->first;
-
-            crow::connections::systemBus->async_method_call(
-                [asyncResp](
-                    const boost::system::error_code ec,
-                    const std::variant<BiosBaseTableType>& retBiosTable) {
-                    if (ec)
-                    {
-                        BMCWEB_LOG_ERROR << "getBiosAttributes DBUS error: "
-                                         << ec;
-                        messages::internalError(asyncResp->res);
-                        return;
-                    }
-                    const BiosBaseTableType* baseBiosTable =
-                        std::get_if<BiosBaseTableType>(&retBiosTable);
-                    nlohmann::json& attributesJson =
-                        asyncResp->res.jsonValue["Attributes"];
-                    if (baseBiosTable == nullptr)
-                    {
-                        BMCWEB_LOG_ERROR << "baseBiosTable == nullptr ";
-                        messages::internalError(asyncResp->res);
-                        return;
-                    }
-                    for (const BiosBaseTableItemType& item : *baseBiosTable)
-                    {
-                        const std::string& key = item.first;
-                        const std::string& itemType =
-                            std::get<biosBaseAttrType>(item.second);
-                        std::string attrType = mapAttrTypeToRedfish(itemType);
-                        if (attrType == "String" || attrType == "Enumeration")
-                        {
-                            const std::string* currValue =
-                                std::get_if<std::string>(
-                                    &std::get<biosBaseCurrValue>(item.second));
-                            attributesJson.emplace(
-                                key, currValue != nullptr ? *currValue : "");
-                        }
-                        else if (attrType == "Integer")
-                        {
-                            const int64_t* currValue = std::get_if<int64_t>(
-                                &std::get<biosBaseCurrValue>(item.second));
-                            attributesJson.emplace(
-                                key, currValue != nullptr ? *currValue : 0);
-                        }
-                        else
-                        {
-                            BMCWEB_LOG_ERROR << "Unsupported attribute type.";
-                            messages::internalError(asyncResp->res);
-                        }
-                    }
-                },
-                service, "/xyz/openbmc_project/bios_config/manager",
-                "org.freedesktop.DBus.Properties", "Get",
-                "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable");
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetObject",
-        "/xyz/openbmc_project/bios_config/manager",
-        std::array<const char*, 0>());
+            for (const BiosBaseTableItemType& item : *baseBiosTable)
+            {
+                const std::string& key = item.first;
+                const std::string& itemType =
+                    std::get<biosBaseAttrType>(item.second);
+                std::string attrType = mapAttrTypeToRedfish(itemType);
+                if (attrType == "String" || attrType == "Enumeration")
+                {
+                    const std::string* currValue =
+                        std::get_if<std::string>(
+                            &std::get<biosBaseCurrValue>(item.second));
+                    attributesJson.emplace(
+                        key, currValue != nullptr ? *currValue : "");
+                }
+                else if (attrType == "Integer")
+                {
+                    const int64_t* currValue = std::get_if<int64_t>(
+                        &std::get<biosBaseCurrValue>(item.second));
+                    attributesJson.emplace(
+                        key, currValue != nullptr ? *currValue : 0);
+                }
+                else
+                {
+                    BMCWEB_LOG_ERROR << "Unsupported attribute type.";
+                    messages::internalError(asyncResp->res);
+                }
+            }
+        });
 }
 inline void requestRoutesBiosService(App& app)
 {
@@ -376,39 +468,19 @@ inline void requestRoutesBiosSettings(App& app)
                 return;
             }
 
-            crow::connections::systemBus->async_method_call(
+            BiosTableCache::getInstance().get(
                 [asyncResp, attrsJson](
-                    const boost::system::error_code ec,
-                    const std::variant<BiosBaseTableType>& retBiosTable) {
-                    if (ec)
-                    {
-                        BMCWEB_LOG_ERROR << "getBiosAttributes DBUS error: "
-                                         << ec;
-                        messages::internalError(asyncResp->res);
-                        return;
-                    }
-
-                    boost::container::flat_map<std::string,
-                                               std::pair<bool, std::string>>
-                        biosAttrsType;
-                    const BiosBaseTableType* baseBiosTable =
-                        std::get_if<BiosBaseTableType>(&retBiosTable);
-
-                    if (baseBiosTable == nullptr)
+                    const BiosTableCache::Table& baseBiosTable,
+                    const BiosTableCache::TypeIndex& typeIndex) {
+                    if (baseBiosTable == nullptr || typeIndex == nullptr)
                     {
                         BMCWEB_LOG_ERROR << "baseBiosTable == nullptr ";
                         messages::internalError(asyncResp->res);
                         return;
                     }
 
-                    for (const BiosBaseTableItemType& item : *baseBiosTable)
-                    {
-                        biosAttrsType.try_emplace(
-                            item.first,
-                            std::make_pair(
-                                std::get<biosBaseReadonlyStatus>(item.second),
-                                std::get<biosBaseAttrType>(item.second)));
-                    }
+                    // Prebuilt by the cache; O(1) per attribute
+                    const auto& biosAttrsType = *typeIndex;
 
                     PendingAttributesType pendingAttributes;
                     for (auto& attrItr : attrsJson.items())
@@ -534,11 +606,7 @@ inline void requestRoutesBiosSettings(App& app)
                         "xyz.openbmc_project.BIOSConfig.Manager",
                         "PendingAttributes",
                         std::variant<PendingAttributesType>(pendingAttributes));
-                },
-                "xyz.openbmc_project.BIOSConfigManager",
-                "/xyz/openbmc_project/bios_config/manager",
-                "org.freedesktop.DBus.Properties", "Get",
-                "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable");
+                });
         });
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <boost/container/flat_map.hpp>
+#include <dbus_utility.hpp>
 #include <utils/json_utils.hpp>
 
 namespace redfish
@@ -148,13 +149,11 @@ inline void requestRoutesCable(App& app)
                                                    cableId);
                     };
 
-                crow::connections::systemBus->async_method_call(
-                    respHandler, "xyz.openbmc_project.ObjectMapper",
-                    "/xyz/openbmc_project/object_mapper",
-                    "xyz.openbmc_project.ObjectMapper", "GetSubTree",
+                dbus::utility::MapperCache::getInstance().getSubTree(
                     "/xyz/openbmc_project/inventory", 0,
-                    std::array<const char*, 1>{
-                        "xyz.openbmc_project.Inventory.Item.Cable"});
+                    std::vector<std::string>{
+                        "xyz.openbmc_project.Inventory.Item.Cable"},
+                    std::move(respHandler));
             });
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <app.hpp>
+#include <dbus_utility.hpp>
 #include <utils/chassis_utils.hpp>
 #include <utils/json_utils.hpp>
 
@@ -12,9 +13,10 @@ inline void
 {
     BMCWEB_LOG_DEBUG << "Get properties for getFan associated to chassis = "
                      << chassisID;
-    const std::array<std::string, 1> sensorInterfaces = {
-        "xyz.openbmc_project.Sensor.Value"};
-    crow::connections::systemBus->async_method_call(
+    // Served from the mapper cache like the rest of the sensor walks
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/sensors", 0,
+        std::vector<std::string>{"xyz.openbmc_project.Sensor.Value"},
         [asyncResp, chassisID](
             const boost::system::error_code ec,
             const std::vector<std::pair<
@@ -105,20 +107,15 @@ inline void
                     continue;
                 }
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/sensors", 0, sensorInterfaces);
+        });
 }
 
 inline void getPowerWatts(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                           const std::string& chassisID)
 {
-    const std::string sensorPath = "/xyz/openbmc_project/sensors";
-    const std::array<std::string, 1> sensorInterfaces = {
-        "xyz.openbmc_project.Sensor.Value"};
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTreePaths(
+        "/xyz/openbmc_project/sensors", 0,
+        std::vector<std::string>{"xyz.openbmc_project.Sensor.Value"},
         [asyncResp, chassisID](const boost::system::error_code ec,
                                const std::vector<std::string>& paths) {
             if (ec)
@@ -204,11 +201,7 @@ inline void getPowerWatts(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                 BMCWEB_LOG_DEBUG << "There is not total_power";
                 return;
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths", sensorPath, 0,
-        sensorInterfaces);
+        });
 }
 
 inline void
@@ -21,10 +21,13 @@
 #include <dbus_singleton.hpp>
 #include <error_messages.hpp>
 #include <registries/privilege_registry.hpp>
+#include <dbus_utility.hpp>
 #include <utils/json_utils.hpp>
 
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <unordered_map>
 #include <variant>
 
 namespace redfish
@@ -201,15 +204,21 @@ inline std::string
 }
 
 inline bool extractEthernetInterfaceData(const std::string& ethifaceId,
-                                         GetManagedObjects& dbusData,
+                                         const GetManagedObjects& dbusData,
                                          EthernetInterfaceData& ethData)
 {
     bool idFound = false;
-    for (auto& objpath : dbusData)
+    // Resolve the path comparisons once per object instead of rebuilding
+    // and re-comparing strings for every interface of every object
+    const std::string ethPath = "/xyz/openbmc_project/network/" + ethifaceId;
+    for (const auto& objpath : dbusData)
     {
-        for (auto& ifacePair : objpath.second)
+        const bool isEthPath = (objpath.first == ethPath);
+        const bool isDhcpConfigPath =
+            (objpath.first == "/xyz/openbmc_project/network/config/dhcp");
+        for (const auto& ifacePair : objpath.second)
         {
-            if (objpath.first == "/xyz/openbmc_project/network/" + ethifaceId)
+            if (isEthPath)
             {
                 idFound = true;
                 if (ifacePair.first == "xyz.openbmc_project.Network.MACAddress")
@@ -348,7 +357,7 @@ inline bool extractEthernetInterfaceData(const std::string& ethifaceId,
                 }
             }
 
-            if (objpath.first == "/xyz/openbmc_project/network/config/dhcp")
+            if (isDhcpConfigPath)
             {
                 if (ifacePair.first ==
                     "xyz.openbmc_project.Network.DHCPConfiguration")
@@ -881,6 +890,101 @@ inline void createIPv6(const std::string& ifaceId, uint8_t prefixLength,
         "");
 }
 
+// One ManagedObjects snapshot per network service, shared by the interface
+// list, every member GET, and the hypervisor tree.  Topology or property
+// signals under the network namespace drop the snapshots, so a polling
+// cycle costs one round trip per service per change instead of per request.
+class NetworkSnapshotCache
+{
+  public:
+    static NetworkSnapshotCache& getInstance()
+    {
+        static NetworkSnapshotCache cache;
+        return cache;
+    }
+
+    using Snapshot = std::shared_ptr<const GetManagedObjects>;
+
+    // forceRefresh skips the snapshot; read-modify-write flows use it so
+    // their deltas are always computed against fresh data
+    template <typename Callback>
+    void get(const std::string& service, const std::string& path,
+             Callback&& callback, bool forceRefresh = false)
+    {
+        std::string key = service + '\x01' + path;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            auto it = snapshots.find(key);
+            if (!forceRefresh && it != snapshots.end())
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     snapshot{it->second}]() mutable {
+                        callback(boost::system::error_code(), *snapshot);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, key{std::move(key)},
+             callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                GetManagedObjects& resp) mutable {
+                if (!ec)
+                {
+                    auto snapshot = std::make_shared<GetManagedObjects>(resp);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshots[key] = std::move(snapshot);
+                }
+                callback(ec, resp);
+            },
+            service, path, "org.freedesktop.DBus.ObjectManager",
+            "GetManagedObjects");
+    }
+
+  private:
+    NetworkSnapshotCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed()
+    {
+        if (propertiesChangedMatch)
+        {
+            return;
+        }
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshots.clear();
+        };
+        propertiesChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',"
+            "path_namespace='/xyz/openbmc_project/network'",
+            invalidate);
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',"
+            "path_namespace='/xyz/openbmc_project/network'",
+            invalidate);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',"
+            "path_namespace='/xyz/openbmc_project/network'",
+            invalidate);
+    }
+
+    std::unordered_map<std::string, Snapshot> snapshots;
+    std::optional<sdbusplus::bus::match::match> propertiesChangedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::mutex mutex;
+};
+
 /**
  * Function that retrieves all properties for given Ethernet Interface
  * Object
@@ -891,12 +995,13 @@ inline void createIPv6(const std::string& ifaceId, uint8_t prefixLength,
  */
 template <typename CallbackFunc>
 void getEthernetIfaceData(const std::string& ethifaceId,
-                          CallbackFunc&& callback)
+                          CallbackFunc&& callback, bool forceRefresh = false)
 {
-    crow::connections::systemBus->async_method_call(
+    NetworkSnapshotCache::getInstance().get(
+        "xyz.openbmc_project.Network", "/xyz/openbmc_project/network",
         [ethifaceId{std::string{ethifaceId}}, callback{std::move(callback)}](
             const boost::system::error_code errorCode,
-            GetManagedObjects& resp) {
+            const GetManagedObjects& resp) {
             EthernetInterfaceData ethData{};
             boost::container::flat_set<IPv4AddressData> ipv4Data;
             boost::container::flat_set<IPv6AddressData> ipv6Data;
@@ -931,8 +1036,7 @@ void getEthernetIfaceData(const std::string& ethifaceId,
             // Finally make a callback with useful data
             callback(true, ethData, ipv4Data, ipv6Data);
         },
-        "xyz.openbmc_project.Network", "/xyz/openbmc_project/network",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        forceRefresh);
 }
 
 /**
@@ -944,10 +1048,11 @@ void getEthernetIfaceData(const std::string& ethifaceId,
 template <typename CallbackFunc>
 void getEthernetIfaceList(CallbackFunc&& callback)
 {
-    crow::connections::systemBus->async_method_call(
+    NetworkSnapshotCache::getInstance().get(
+        "xyz.openbmc_project.Network", "/xyz/openbmc_project/network",
         [callback{std::move(callback)}](
             const boost::system::error_code errorCode,
-            GetManagedObjects& resp) {
+            const GetManagedObjects& resp) {
             // Callback requires vector<string> to retrieve all available
             // ethernet interfaces
             boost::container::flat_set<std::string> ifaceList;
@@ -982,9 +1087,7 @@ void getEthernetIfaceList(CallbackFunc&& callback)
             }
             // Finally make a callback with useful data
             callback(true, ifaceList);
-        },
-        "xyz.openbmc_project.Network", "/xyz/openbmc_project/network",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        });
 }
 
 inline void
@@ -1897,8 +2000,9 @@ inline void requestEthernetInterfacesRoutes(App& app)
                     }
                 }
 
-                // Get single eth interface data, and call the below callback
-                // for JSON preparation
+                // Get single eth interface data, and call the below
+                // callback for JSON preparation.  This is a read-modify-write
+                // flow, so bypass the snapshot cache for a fresh read.
                 getEthernetIfaceData(
                     ifaceId,
                     [asyncResp, ifaceId, hostname = std::move(hostname),
@@ -1987,7 +2091,8 @@ inline void requestEthernetInterfacesRoutes(App& app)
                                 ifaceId, "NICEnabled", *interfaceEnabled,
                                 asyncResp);
                         }
-                    });
+                    },
+                    true);
             });
 }
 
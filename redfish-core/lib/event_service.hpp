@@ -541,6 +541,7 @@ inline void requestRoutesEventDestinationCollection(App& app)
                 std::optional<std::vector<std::string>> resTypes;
                 std::optional<std::vector<nlohmann::json>> headers;
                 std::optional<std::vector<nlohmann::json>> mrdJsonArray;
+                std::optional<bool> includeDeltaPayload;
 
                 if (!json_util::readJson(
                         req, asyncResp->res, "Destination", destUrl, "Context",
@@ -549,7 +550,8 @@ inline void requestRoutesEventDestinationCollection(App& app)
                         "HttpHeaders", headers, "RegistryPrefixes", regPrefixes,
                         "MessageIds", msgIds, "DeliveryRetryPolicy",
                         retryPolicy, "MetricReportDefinitions", mrdJsonArray,
-                        "ResourceTypes", resTypes))
+                        "ResourceTypes", resTypes, "IncludeDeltaPayload",
+                        includeDeltaPayload))
                 {
                     return;
                 }
@@ -613,6 +615,11 @@ inline void requestRoutesEventDestinationCollection(App& app)
 
                 subValue->destinationUrl = destUrl;
 
+                if (includeDeltaPayload)
+                {
+                    subValue->includeDeltaPayload = *includeDeltaPayload;
+                }
+
                 if (subscriptionType)
                 {
                     if ((*subscriptionType != "RedfishEvent") &&
@@ -898,6 +905,12 @@ inline void requestRoutesEventDestination(App& app)
                 }
                 asyncResp->res.jsonValue["MetricReportDefinitions"] =
                     mrdJsonArray;
+
+                // Delivery health so tooling can flag a broken endpoint
+                // without spelunking logs
+                subValue->fillDeliveryHealth(
+                    asyncResp->res
+                        .jsonValue["Oem"]["OpenBMC"]["DeliveryHealth"]);
             });
     BMCWEB_ROUTE(app, "/redfish/v1/EventService/Subscriptions/<str>/")
         // The below privilege is wrong, it should be ConfigureManager OR
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <app.hpp>
+#include <dbus_utility.hpp>
 #include <utils/chassis_utils.hpp>
 #include <utils/json_utils.hpp>
 
@@ -504,15 +505,17 @@ inline void getValidFan(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         const std::string& chassisId)
 {
     BMCWEB_LOG_DEBUG << "Get fan list associated to chassis = " << chassisId;
-    const std::array<const char*, 1> fanInterfaces = {
-        "xyz.openbmc_project.Inventory.Item.Fan"};
     asyncResp->res.jsonValue["@odata.type"] = "#FanCollection.FanCollection";
     asyncResp->res.jsonValue["@odata.id"] =
         "/redfish/v1/Chassis/" + chassisId + "/ThermalSubsystem/Fans/";
     asyncResp->res.jsonValue["Name"] = "Fan Collection";
     asyncResp->res.jsonValue["Description"] =
         "The collection of Fan resource instances " + chassisId;
-    crow::connections::systemBus->async_method_call(
+    // Served from the mapper cache when warm, so a ThermalSubsystem +
+    // PowerSubsystem dashboard view shares one inventory walk per change
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{"xyz.openbmc_project.Inventory.Item.Fan"},
         [asyncResp, chassisId](
             const boost::system::error_code ec,
             const std::vector<std::pair<
@@ -693,11 +696,7 @@ inline void getValidFan(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
                         "xyz.openbmc_project.Association", "endpoints");
                 }
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", 0, fanInterfaces);
+        });
 }
 
 template <typename Callback>
@@ -21,12 +21,143 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/container/flat_set.hpp>
 #include <dbus_singleton.hpp>
+#include <dbus_utility.hpp>
+#include <sdbusplus/bus/match.hpp>
 
+#include <chrono>
+#include <mutex>
+#include <optional>
 #include <variant>
 
 namespace redfish
 {
 
+// Shared snapshot of the mapper's critical/warning status associations.
+// Every resource that rolls up health used to run its own full
+// GetManagedObjects scan, so a dashboard load or $expand multiplied the most
+// expensive mapper call by N.  One filtered snapshot is shared for a short
+// window, concurrent requests ride along on the in-flight fetch, and
+// topology signals drop it early.
+class HealthStatusCache
+{
+  public:
+    static HealthStatusCache& getInstance()
+    {
+        static HealthStatusCache cache;
+        return cache;
+    }
+
+    using Snapshot = std::shared_ptr<const dbus::utility::ManagedObjectType>;
+    using Handler = std::function<void(const Snapshot&)>;
+
+    void get(Handler&& handler)
+    {
+        Snapshot local;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            auto now = std::chrono::steady_clock::now();
+            if (snapshot && now - fetchTime < validityWindow)
+            {
+                local = snapshot;
+            }
+        }
+        if (local)
+        {
+            handler(local);
+            return;
+        }
+        fetchOrRideAlong(std::move(handler));
+    }
+
+  private:
+    HealthStatusCache() = default;
+
+    static constexpr std::chrono::seconds validityWindow{2};
+
+    void fetchOrRideAlong(Handler&& handler)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            waiters.emplace_back(std::move(handler));
+            if (waiters.size() > 1)
+            {
+                // A scan is already in flight; its completion serves us too
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this](const boost::system::error_code ec,
+                   dbus::utility::ManagedObjectType& resp) {
+                auto snap =
+                    std::make_shared<dbus::utility::ManagedObjectType>();
+                if (!ec)
+                {
+                    // Only the critical/warning association endpoints matter
+                    // for rollup; drop the rest before sharing
+                    for (auto it = resp.begin(); it != resp.end();)
+                    {
+                        if (boost::ends_with(it->first.str, "critical") ||
+                            boost::ends_with(it->first.str, "warning"))
+                        {
+                            it++;
+                            continue;
+                        }
+                        it = resp.erase(it);
+                    }
+                    *snap = std::move(resp);
+                }
+                std::vector<Handler> localWaiters;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!ec)
+                    {
+                        snapshot = snap;
+                        fetchTime = std::chrono::steady_clock::now();
+                    }
+                    localWaiters = std::move(waiters);
+                    waiters.clear();
+                }
+                for (Handler& waiter : localWaiters)
+                {
+                    waiter(snap);
+                }
+            },
+            "xyz.openbmc_project.ObjectMapper", "/",
+            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+    }
+
+    // Callers must hold the mutex
+    void ensureSubscribed()
+    {
+        if (interfacesAddedMatch)
+        {
+            return;
+        }
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshot.reset();
+        };
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded'",
+            invalidate);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved'",
+            invalidate);
+    }
+
+    Snapshot snapshot;
+    std::chrono::time_point<std::chrono::steady_clock> fetchTime;
+    std::vector<Handler> waiters;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::mutex mutex;
+};
+
 struct HealthPopulate : std::enable_shared_from_this<HealthPopulate>
 {
     HealthPopulate(const std::shared_ptr<bmcweb::AsyncResp>& asyncRespIn) :
@@ -50,10 +181,14 @@ struct HealthPopulate : std::enable_shared_from_this<HealthPopulate>
         for (const std::shared_ptr<HealthPopulate>& healthChild : children)
         {
             healthChild->globalInventoryPath = globalInventoryPath;
-            healthChild->statuses = statuses;
+            healthChild->statuses = statuses;  // shared snapshot; cheap copy
         }
 
-        for (const auto& [path, interfaces] : statuses)
+        if (statuses == nullptr)
+        {
+            return;
+        }
+        for (const auto& [path, interfaces] : *statuses)
         {
             bool isChild = false;
             bool isSelf = false;
@@ -198,27 +333,10 @@ struct HealthPopulate : std::enable_shared_from_this<HealthPopulate>
     void getAllStatusAssociations()
     {
         std::shared_ptr<HealthPopulate> self = shared_from_this();
-        crow::connections::systemBus->async_method_call(
-            [self](const boost::system::error_code ec,
-                   dbus::utility::ManagedObjectType& resp) {
-                if (ec)
-                {
-                    return;
-                }
-                for (auto it = resp.begin(); it != resp.end();)
-                {
-                    if (boost::ends_with(it->first.str, "critical") ||
-                        boost::ends_with(it->first.str, "warning"))
-                    {
-                        it++;
-                        continue;
-                    }
-                    it = resp.erase(it);
-                }
-                self->statuses = std::move(resp);
-            },
-            "xyz.openbmc_project.ObjectMapper", "/",
-            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        HealthStatusCache::getInstance().get(
+            [self](const HealthStatusCache::Snapshot& snapshot) {
+                self->statuses = snapshot;
+            });
     }
 
     std::shared_ptr<bmcweb::AsyncResp> asyncResp;
@@ -235,7 +353,7 @@ struct HealthPopulate : std::enable_shared_from_this<HealthPopulate>
 
     std::vector<std::string> inventory;
     bool isManagersHealth = false;
-    dbus::utility::ManagedObjectType statuses;
+    HealthStatusCache::Snapshot statuses;
     std::string globalInventoryPath = "-"; // default to illegal dbus path
     bool populated = false;
 };
@@ -295,9 +295,15 @@ inline bool extractHypervisorInterfaceData(
  */
 template <typename CallbackFunc>
 void getHypervisorIfaceData(const std::string& ethIfaceId,
-                            CallbackFunc&& callback)
+                            CallbackFunc&& callback, bool forceRefresh = false)
 {
-    crow::connections::systemBus->async_method_call(
+    // Shares the network snapshot cache with the host interfaces; the
+    // hypervisor tree lives under the same namespace, so the same
+    // invalidation signals cover it and a combined system+hypervisor poll
+    // costs one round trip per service per change.
+    NetworkSnapshotCache::getInstance().get(
+        "xyz.openbmc_project.Network.Hypervisor",
+        "/xyz/openbmc_project/network/hypervisor",
         [ethIfaceId{std::string{ethIfaceId}},
          callback{std::move(callback)}](const boost::system::error_code error,
                                         const GetManagedObjects& resp) {
@@ -318,9 +324,7 @@ void getHypervisorIfaceData(const std::string& ethIfaceId,
             }
             callback(found, ethData, ipv4Data);
         },
-        "xyz.openbmc_project.Network.Hypervisor",
-        "/xyz/openbmc_project/network/hypervisor",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        forceRefresh);
 }
 
 inline void
@@ -802,6 +806,7 @@ inline void requestRoutesHypervisorSystems(App& app)
                 }
             }
 
+            // Read-modify-write flow; bypass the snapshot for a fresh read
             getHypervisorIfaceData(
                 ifaceId,
                 [asyncResp, ifaceId, hostName = std::move(hostName),
@@ -871,7 +876,8 @@ inline void requestRoutesHypervisorSystems(App& app)
                     {
                         setDHCPEnabled(ifaceId, *ipv4DHCPEnabled, asyncResp);
                     }
-                });
+                },
+                true);
             asyncResp->res.result(boost::beast::http::status::accepted);
         });
 
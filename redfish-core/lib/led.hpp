@@ -25,6 +25,112 @@
 
 namespace redfish
 {
+/**
+ * Cached Asserted state of the LED groups.  Chassis, system, fan, power
+ * supply and memory handlers all ask for the same two group states on every
+ * GET - hundreds of identical tiny calls under a dashboard load - so the
+ * values are kept fresh by PropertiesChanged and answered from memory.
+ * Callbacks keep the variant<bool> shape of a Properties.Get reply so the
+ * consuming code reads the same either way.
+ */
+class LedGroupStateCache
+{
+  public:
+    static LedGroupStateCache& getInstance()
+    {
+        static LedGroupStateCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void getAsserted(const std::string& path, Callback&& callback)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ensureSubscribed();
+        auto it = states.find(path);
+        if (it != states.end())
+        {
+            boost::asio::post(crow::connections::systemBus->get_io_context(),
+                              [callback{std::forward<Callback>(callback)},
+                               value{it->second}]() mutable {
+                                  callback(boost::system::error_code(),
+                                           std::variant<bool>(value));
+                              });
+            return;
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, path, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const std::variant<bool>& asserted) mutable {
+                if (!ec)
+                {
+                    const bool* value = std::get_if<bool>(&asserted);
+                    if (value != nullptr)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        states[path] = *value;
+                    }
+                }
+                callback(ec, asserted);
+            },
+            "xyz.openbmc_project.LED.GroupManager", path,
+            "org.freedesktop.DBus.Properties", "Get",
+            "xyz.openbmc_project.Led.Group", "Asserted");
+    }
+
+  private:
+    LedGroupStateCache() = default;
+
+    void ensureSubscribed()
+    {
+        if (propertiesChangedMatch)
+        {
+            return;
+        }
+        propertiesChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',"
+            "path_namespace='/xyz/openbmc_project/led/groups'",
+            [this](sdbusplus::message::message& msg) {
+                std::string interface;
+                boost::container::flat_map<std::string, std::variant<bool>>
+                    changed;
+                try
+                {
+                    msg.read(interface, changed);
+                }
+                catch (const std::exception&)
+                {
+                    return;
+                }
+                if (interface != "xyz.openbmc_project.Led.Group")
+                {
+                    return;
+                }
+                auto assertedIt = changed.find("Asserted");
+                if (assertedIt == changed.end())
+                {
+                    return;
+                }
+                const bool* value = std::get_if<bool>(&assertedIt->second);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (value != nullptr)
+                {
+                    states[msg.get_path()] = *value;
+                }
+                else
+                {
+                    states.erase(msg.get_path());
+                }
+            });
+    }
+
+    std::unordered_map<std::string, bool> states;
+    std::optional<sdbusplus::bus::match::match> propertiesChangedMatch;
+    std::mutex mutex;
+};
+
 /**
  * @brief Get the service name of the LED manager
  *
@@ -46,7 +152,9 @@ inline void getLEDService(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
     using MapperGetSubTreeResponse =
         std::vector<std::pair<std::string, MapperServiceMap>>;
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project", 0,
+        std::vector<std::string>{"xyz.openbmc_project.Led.Group"},
         [aResp, path,
          handler{std::move(handler)}](const boost::system::error_code ec,
                                       const MapperGetSubTreeResponse& subtree) {
@@ -68,12 +176,7 @@ inline void getLEDService(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
                     handler(serviceName);
                 }
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project", 0,
-        std::array<const char*, 1>{"xyz.openbmc_project.Led.Group"});
+        });
 }
 
 /**
@@ -88,7 +191,8 @@ inline void
     getIndicatorLedState(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
 {
     BMCWEB_LOG_DEBUG << "Get led groups";
-    crow::connections::systemBus->async_method_call(
+    LedGroupStateCache::getInstance().getAsserted(
+        "/xyz/openbmc_project/led/groups/enclosure_identify_blink",
         [aResp](const boost::system::error_code ec,
                 const std::variant<bool> asserted) {
             // Some systems may not have enclosure_identify_blink object so
@@ -109,7 +213,8 @@ inline void
                     return;
                 }
             }
-            crow::connections::systemBus->async_method_call(
+            LedGroupStateCache::getInstance().getAsserted(
+                "/xyz/openbmc_project/led/groups/enclosure_identify",
                 [aResp](const boost::system::error_code ec2,
                         const std::variant<bool> asserted2) {
                     if (!ec2)
@@ -133,16 +238,8 @@ inline void
                         }
                     }
                     return;
-                },
-                "xyz.openbmc_project.LED.GroupManager",
-                "/xyz/openbmc_project/led/groups/enclosure_identify",
-                "org.freedesktop.DBus.Properties", "Get",
-                "xyz.openbmc_project.Led.Group", "Asserted");
-        },
-        "xyz.openbmc_project.LED.GroupManager",
-        "/xyz/openbmc_project/led/groups/enclosure_identify_blink",
-        "org.freedesktop.DBus.Properties", "Get",
-        "xyz.openbmc_project.Led.Group", "Asserted");
+                });
+        });
 }
 
 /**
@@ -222,7 +319,8 @@ inline void
     getLocationIndicatorActive(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
 {
     BMCWEB_LOG_DEBUG << "Get LocationIndicatorActive";
-    crow::connections::systemBus->async_method_call(
+    LedGroupStateCache::getInstance().getAsserted(
+        "/xyz/openbmc_project/led/groups/enclosure_identify_blink",
         [aResp](const boost::system::error_code ec,
                 const std::variant<bool> asserted) {
             // Some systems may not have enclosure_identify_blink object so
@@ -243,7 +341,8 @@ inline void
                     return;
                 }
             }
-            crow::connections::systemBus->async_method_call(
+            LedGroupStateCache::getInstance().getAsserted(
+                "/xyz/openbmc_project/led/groups/enclosure_identify",
                 [aResp](const boost::system::error_code ec2,
                         const std::variant<bool> asserted2) {
                     if (!ec2)
@@ -269,16 +368,8 @@ inline void
                         }
                     }
                     return;
-                },
-                "xyz.openbmc_project.LED.GroupManager",
-                "/xyz/openbmc_project/led/groups/enclosure_identify",
-                "org.freedesktop.DBus.Properties", "Get",
-                "xyz.openbmc_project.Led.Group", "Asserted");
-        },
-        "xyz.openbmc_project.LED.GroupManager",
-        "/xyz/openbmc_project/led/groups/enclosure_identify_blink",
-        "org.freedesktop.DBus.Properties", "Get",
-        "xyz.openbmc_project.Led.Group", "Asserted");
+                });
+        });
 }
 
 /**
@@ -169,6 +169,7 @@ inline void requestRoutesLicenseEntryCollection(App& app)
             if (licenseString.empty())
             {
                 messages::propertyMissing(asyncResp->res, "LicenseString");
+                return;
             }
 
             // Only allow one License install at a time
@@ -182,9 +183,13 @@ inline void requestRoutesLicenseEntryCollection(App& app)
                 std::make_shared<boost::asio::steady_timer>(
                     crow::connections::systemBus->get_io_context());
             timeout->expires_after(std::chrono::seconds(10));
+            // Entitlement blobs run large; share one copy through the
+            // capture chain instead of copying it per closure
+            auto licenseBlob = std::make_shared<const std::string>(
+                std::move(licenseString));
             crow::connections::systemBus->async_method_call(
                 [timeout, asyncResp,
-                 licenseString](const boost::system::error_code ec) {
+                 licenseBlob](const boost::system::error_code ec) {
                     if (ec)
                     {
                         BMCWEB_LOG_ERROR
@@ -220,7 +225,7 @@ inline void requestRoutesLicenseEntryCollection(App& app)
 
                     timeout->async_wait(timeoutHandler);
 
-                    auto callback = [asyncResp, timeout, licenseString](
+                    auto callback = [asyncResp, timeout, licenseBlob](
                                         sdbusplus::message::message& m) {
                         BMCWEB_LOG_DEBUG << "Response Matched " << m.get();
                         boost::container::flat_map<std::string,
@@ -244,7 +249,7 @@ inline void requestRoutesLicenseEntryCollection(App& app)
                                     return;
                                 }
                                 getLicenseActivationAck(asyncResp, *status,
-                                                        licenseString);
+                                                        *licenseBlob);
                                 timeout->cancel();
                             }
                         }
@@ -261,7 +266,7 @@ inline void requestRoutesLicenseEntryCollection(App& app)
                 "com.ibm.License.Manager", "/com/ibm/license",
                 "org.freedesktop.DBus.Properties", "Set",
                 "com.ibm.License.LicenseManager", "LicenseString",
-                std::variant<std::string>(licenseString));
+                std::variant<std::string>(*licenseBlob));
         });
 }
 
@@ -26,6 +26,7 @@
 #include <boost/date_time.hpp>
 #include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
+#include <runtime_config.hpp>
 #include <utils/fw_utils.hpp>
 #include <utils/systemd_utils.hpp>
 
@@ -312,6 +313,104 @@ static constexpr const char* stepwiseConfigurationIface =
 static constexpr const char* thermalModeIface =
     "xyz.openbmc_project.Control.ThermalMode";
 
+// Snapshot of the fan/PID configuration tree per (service, root), so the
+// Manager GET stops re-copying the whole managed-object set when nothing
+// changed.  Each entry registers its own invalidation matches under its
+// root path; a PATCH lands as PropertiesChanged/InterfacesAdded/Removed
+// from the config daemon and drops the snapshot.
+class PidConfigCache
+{
+  public:
+    static PidConfigCache& getInstance()
+    {
+        static PidConfigCache cache;
+        return cache;
+    }
+
+    using Snapshot = std::shared_ptr<const dbus::utility::ManagedObjectType>;
+
+    template <typename Callback>
+    void get(const std::string& connection, const std::string& path,
+             Callback&& callback)
+    {
+        std::string key = connection + '\x01' + path;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // Subscribe before the first query goes out so no config change
+            // can slip between reply and match registration
+            ensureSubscribed(key, path);
+            auto it = snapshots.find(key);
+            if (it != snapshots.end())
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     snapshot{it->second}]() mutable {
+                        callback(boost::system::error_code(), *snapshot);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, key{std::move(key)},
+             callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                dbus::utility::ManagedObjectType& resp) mutable {
+                if (!ec)
+                {
+                    auto snapshot =
+                        std::make_shared<dbus::utility::ManagedObjectType>(
+                            resp);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshots[key] = std::move(snapshot);
+                }
+                callback(ec, resp);
+            },
+            connection, path, objectManagerIface, "GetManagedObjects");
+    }
+
+  private:
+    PidConfigCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed(const std::string& key, const std::string& path)
+    {
+        if (matches.count(key) != 0)
+        {
+            return;
+        }
+        auto invalidate = [this, key](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            snapshots.erase(key);
+        };
+        std::vector<sdbusplus::bus::match::match>& keyMatches = matches[key];
+        keyMatches.reserve(3);
+        keyMatches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',path_namespace='" +
+                path + "'",
+            invalidate);
+        keyMatches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',path_namespace='" +
+                path + "'",
+            invalidate);
+        keyMatches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',path_namespace='" +
+                path + "'",
+            invalidate);
+    }
+
+    std::unordered_map<std::string, Snapshot> snapshots;
+    std::unordered_map<std::string, std::vector<sdbusplus::bus::match::match>>
+        matches;
+    std::mutex mutex;
+};
+
 inline void
     asyncPopulatePid(const std::string& connection, const std::string& path,
                      const std::string& currentProfile,
@@ -319,7 +418,8 @@ inline void
                      const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
 
-    crow::connections::systemBus->async_method_call(
+    PidConfigCache::getInstance().get(
+        connection, path,
         [asyncResp, currentProfile, supportedProfiles](
             const boost::system::error_code ec,
             const dbus::utility::ManagedObjectType& managedObj) {
@@ -718,8 +818,7 @@ inline void
                     }
                 }
             }
-        },
-        connection, path, objectManagerIface, "GetManagedObjects");
+        });
 }
 
 enum class CreatePIDRet
@@ -2045,6 +2144,75 @@ inline void requestRoutesManager(App& app)
 {
     std::string uuid = persistent_data::getConfig().systemUuid;
 
+    // Runtime performance knobs: readable by any logged-in user, tuned
+    // with ConfigureManager.  Values apply immediately through the atomic
+    // tuning object and persist across restarts, so per-site workload
+    // profiles never need a reflash.
+    BMCWEB_ROUTE(app, "/redfish/v1/Managers/bmc/Oem/OpenBmc/PerformanceTuning/")
+        .privileges({{"Login"}})
+        .methods(boost::beast::http::verb::get)(
+            [](const crow::Request&,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                asyncResp->res.jsonValue =
+                    crow::runtime_config::RuntimeTuning::getInstance()
+                        .toJson();
+                asyncResp->res.jsonValue["@odata.type"] =
+                    "#OemManager.PerformanceTuning";
+                asyncResp->res.jsonValue["@odata.id"] =
+                    "/redfish/v1/Managers/bmc/Oem/OpenBmc/PerformanceTuning";
+            });
+
+    BMCWEB_ROUTE(app, "/redfish/v1/Managers/bmc/Oem/OpenBmc/PerformanceTuning/")
+        .privileges({{"ConfigureManager"}})
+        .methods(boost::beast::http::verb::patch)(
+            [](const crow::Request& req,
+               const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) {
+                std::optional<uint64_t> gzipThreshold;
+                std::optional<uint64_t> rateLimitRps;
+                std::optional<uint64_t> rateLimitBurst;
+                std::optional<uint64_t> bulkConcurrency;
+                std::optional<uint64_t> bulkQueue;
+                if (!json_util::readJson(
+                        req, asyncResp->res, "GzipSizeThresholdBytes",
+                        gzipThreshold, "RateLimitRequestsPerSecond",
+                        rateLimitRps, "RateLimitBurst", rateLimitBurst,
+                        "BulkConcurrencyLimit", bulkConcurrency,
+                        "BulkQueueLimit", bulkQueue))
+                {
+                    return;
+                }
+                crow::runtime_config::RuntimeTuning& tuning =
+                    crow::runtime_config::RuntimeTuning::getInstance();
+                auto apply = [&asyncResp, &tuning](
+                                 const char* name,
+                                 const std::optional<uint64_t>& value) {
+                    if (!value)
+                    {
+                        return true;
+                    }
+                    if (!tuning.applyKnob(name, *value))
+                    {
+                        messages::propertyValueFormatError(
+                            asyncResp->res, std::to_string(*value), name);
+                        return false;
+                    }
+                    return true;
+                };
+                bool allApplied =
+                    apply("GzipSizeThresholdBytes", gzipThreshold) &&
+                    apply("RateLimitRequestsPerSecond", rateLimitRps) &&
+                    apply("RateLimitBurst", rateLimitBurst) &&
+                    apply("BulkConcurrencyLimit", bulkConcurrency) &&
+                    apply("BulkQueueLimit", bulkQueue);
+                if (!allApplied)
+                {
+                    return;
+                }
+                // Persist the profile with the rest of the config store
+                persistent_data::getConfig().writeData();
+                messages::success(asyncResp->res);
+            });
+
     BMCWEB_ROUTE(app, "/redfish/v1/Managers/bmc/")
         .privileges(redfish::privileges::getManager)
         .methods(boost::beast::http::verb::get)([uuid](const crow::Request&,
@@ -2089,6 +2257,9 @@ inline void requestRoutesManager(App& app)
             oemOpenbmc["Certificates"] = {
                 {"@odata.id",
                  "/redfish/v1/Managers/bmc/Truststore/Certificates"}};
+            oemOpenbmc["PerformanceTuning"] = {
+                {"@odata.id",
+                 "/redfish/v1/Managers/bmc/Oem/OpenBmc/PerformanceTuning"}};
 
             // Manager.Reset (an action) can be many values, OpenBMC only
             // supports BMC reboot.
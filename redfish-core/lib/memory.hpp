@@ -18,6 +18,7 @@
 #include <app.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/format.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <utils/collection.hpp>
 #include <utils/hw_isolation.hpp>
@@ -26,11 +27,12 @@
 namespace redfish
 {
 
-using DimmProperty =
-    std::variant<std::string, std::vector<uint32_t>, std::vector<uint16_t>,
-                 uint64_t, uint32_t, uint16_t, uint8_t, bool>;
+// Aliased onto the shared D-Bus variant (which carries every type a DIMM
+// property uses) so DIMM data can come out of the shared managed-objects
+// snapshot instead of a per-DIMM GetAll
+using DimmProperty = dbus::utility::DbusVariantType;
 
-using DimmProperties = boost::container::flat_map<std::string, DimmProperty>;
+using DimmProperties = dbus::utility::DBusPropertiesMap;
 
 // Map of service name to list of interfaces
 using MapperServiceMap =
@@ -459,11 +461,37 @@ inline void getDimmDataByService(std::shared_ptr<bmcweb::AsyncResp> aResp,
                                  const std::string& objPath)
 {
     BMCWEB_LOG_DEBUG << "Get available system components.";
-    crow::connections::systemBus->async_method_call(
+    // Reads the shared inventory snapshot and flattens this DIMM's
+    // interfaces into the GetAll shape the property handling below expects;
+    // 32 DIMMs enumerate from one sweep instead of 32 round trips
+    dbus::utility::ManagedObjectsCache::getInstance().get(
+        service, "/xyz/openbmc_project/inventory",
         [dimmId, aResp{std::move(aResp)},
          objPath](const boost::system::error_code ec,
-                  const DimmProperties& properties) {
-            if (ec)
+                  const dbus::utility::ManagedObjectType& objects) {
+            DimmProperties properties;
+            bool found = false;
+            if (!ec)
+            {
+                for (const auto& object : objects)
+                {
+                    if (object.first.str != objPath)
+                    {
+                        continue;
+                    }
+                    found = true;
+                    for (const auto& interface : object.second)
+                    {
+                        for (const auto& property : interface.second)
+                        {
+                            properties.insert_or_assign(property.first,
+                                                        property.second);
+                        }
+                    }
+                    break;
+                }
+            }
+            if (ec || !found)
             {
                 BMCWEB_LOG_DEBUG << "DBUS response error";
                 messages::internalError(aResp->res);
@@ -758,8 +786,7 @@ inline void getDimmDataByService(std::shared_ptr<bmcweb::AsyncResp> aResp,
             // Check for the hardware status event
             hw_isolation_utils::getHwIsolationStatus(aResp, objPath);
 #endif // end of BMCWEB_ENABLE_HW_ISOLATION
-        },
-        service, objPath, "org.freedesktop.DBus.Properties", "GetAll", "");
+        });
 }
 
 inline void getDimmPartitionData(std::shared_ptr<bmcweb::AsyncResp> aResp,
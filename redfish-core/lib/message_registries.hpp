@@ -26,6 +26,8 @@
 #include <app.hpp>
 #include <registries/privilege_registry.hpp>
 
+#include <mutex>
+
 namespace redfish
 {
 
@@ -201,6 +203,24 @@ inline void handleMessageRegistryGet(
         return;
     }
 
+    // The registry content is fixed for the life of the firmware image;
+    // build the json once per registry and serve copies afterward, so
+    // validators and client libraries hammering these routes stop paying the
+    // per-message assembly.  True build-time blobs would need the generator
+    // to emit serialized bodies; the once-per-process build gets the same
+    // steady-state cost without touching generated files.
+    static std::unordered_map<std::string, nlohmann::json> builtRegistries;
+    static std::mutex builtRegistriesMutex;
+    {
+        std::lock_guard<std::mutex> lock(builtRegistriesMutex);
+        auto cached = builtRegistries.find(registry);
+        if (cached != builtRegistries.end())
+        {
+            asyncResp->res.jsonValue = cached->second;
+            return;
+        }
+    }
+
     asyncResp->res.jsonValue = {{"@Redfish.Copyright", header->copyright},
                                 {"@odata.type", header->type},
                                 {"Id", header->id},
@@ -237,6 +257,9 @@ inline void handleMessageRegistryGet(
             }
         }
     }
+
+    std::lock_guard<std::mutex> lock(builtRegistriesMutex);
+    builtRegistries.emplace(registry, asyncResp->res.jsonValue);
 }
 
 inline void requestRoutesMessageRegistry(App& app)
@@ -17,16 +17,27 @@ using TimestampReadings = std::tuple<uint64_t, Readings>;
 
 inline nlohmann::json toMetricValues(const Readings& readings)
 {
-    nlohmann::json metricValues = nlohmann::json::array_t();
+    nlohmann::json::array_t metricValues;
+    metricValues.reserve(readings.size());
+
+    // Rows of one report overwhelmingly share a timestamp; memoize the last
+    // converted value instead of re-formatting the date per row
+    uint64_t lastTimestamp = 0;
+    std::string lastTimestampStr;
 
     for (auto& [id, metadata, sensorValue, timestamp] : readings)
     {
+        if (lastTimestampStr.empty() || timestamp != lastTimestamp)
+        {
+            lastTimestampStr =
+                crow::utility::getDateTime(static_cast<time_t>(timestamp));
+            lastTimestamp = timestamp;
+        }
         metricValues.push_back({
             {"MetricId", id},
             {"MetricProperty", metadata},
             {"MetricValue", std::to_string(sensorValue)},
-            {"Timestamp",
-             crow::utility::getDateTime(static_cast<time_t>(timestamp))},
+            {"Timestamp", lastTimestampStr},
         });
     }
 
@@ -54,7 +65,22 @@ inline bool fillReport(nlohmann::json& json, const std::string& id,
     const auto& [timestamp, readings] = *timestampReadings;
     json["Timestamp"] =
         crow::utility::getDateTime(static_cast<time_t>(timestamp));
-    json["MetricValues"] = toMetricValues(readings);
+
+    // Fleet collectors scrape faster than most report intervals, so the
+    // same readings get re-serialized over and over.  Rebuild the
+    // MetricValues array only when the report timestamp moved; the cached
+    // copy stays valid because the telemetry service bumps the timestamp
+    // with every Readings update.
+    static std::unordered_map<std::string,
+                              std::pair<uint64_t, nlohmann::json>>
+        metricValuesCache;
+    std::pair<uint64_t, nlohmann::json>& cached = metricValuesCache[id];
+    if (cached.second.is_null() || cached.first != timestamp)
+    {
+        cached.first = timestamp;
+        cached.second = toMetricValues(readings);
+    }
+    json["MetricValues"] = cached.second;
     return true;
 }
 } // namespace telemetry
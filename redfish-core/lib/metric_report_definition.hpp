@@ -279,9 +279,27 @@ inline bool getChassisSensorNode(
             std::string chassis;
             std::string node;
 
-            if (!boost::starts_with(uri, "/redfish/v1/Chassis/") ||
-                !dbus::utility::getNthStringFromPath(uri, 3, chassis) ||
-                !dbus::utility::getNthStringFromPath(uri, 4, node))
+            // One pass over the URI; the generic path parser built two
+            // filesystem::path objects per metric property
+            constexpr std::string_view chassisPrefix = "/redfish/v1/Chassis/";
+            bool parsed = false;
+            if (boost::starts_with(uri, chassisPrefix))
+            {
+                std::string_view rest(uri);
+                rest.remove_prefix(chassisPrefix.size());
+                size_t slash = rest.find('/');
+                if (slash != std::string_view::npos && slash > 0)
+                {
+                    chassis = rest.substr(0, slash);
+                    rest.remove_prefix(slash + 1);
+                    size_t nodeEnd = rest.find('/');
+                    node = std::string(rest.substr(
+                        0, nodeEnd == std::string_view::npos ? rest.size()
+                                                             : nodeEnd));
+                    parsed = !node.empty();
+                }
+            }
+            if (!parsed)
             {
                 BMCWEB_LOG_ERROR << "Failed to get chassis and sensor Node "
                                     "from "
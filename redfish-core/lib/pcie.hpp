@@ -20,6 +20,7 @@
 
 #include <app.hpp>
 #include <boost/system/linux_error.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 
 #include <map>
@@ -83,12 +84,12 @@ static inline void
 
         asyncResp->res.jsonValue[name + "@odata.count"] = pcieDeviceList.size();
     };
-    crow::connections::systemBus->async_method_call(
-        std::move(getPCIeMapCallback), "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
+    // Served from the mapper cache when warm, so collection GETs and
+    // \$expand fan-outs don't repeat the subtree walk
+    dbus::utility::MapperCache::getInstance().getSubTree(
         std::string(pcieRootPath), 0,
-        std::array<const char*, 1>{pcieDeviceInterface});
+        std::vector<std::string>{pcieDeviceInterface},
+        std::move(getPCIeMapCallback));
 }
 
 inline void requestRoutesSystemPCIeDeviceCollection(App& app)
@@ -83,7 +83,10 @@ inline void getPort(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
     BMCWEB_LOG_DEBUG << "Get port = " << portId
                      << " on adapter = " << adapterId;
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Item.Connector"},
         [aResp, portId, adapterId](const boost::system::error_code ec,
                                    const MapperGetSubTreeResponse& subtree) {
             if (ec.value() == boost::system::errc::io_error)
@@ -138,13 +141,7 @@ inline void getPort(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
             }
             BMCWEB_LOG_ERROR << "Port not found";
             messages::resourceNotFound(aResp->res, "Port", portId);
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", 0,
-        std::array<const char*, 1>{
-            "xyz.openbmc_project.Inventory.Item.Connector"});
+        });
 }
 
 /**
@@ -163,7 +160,10 @@ inline void getPortCollection(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
                               const std::string& adapterId)
 {
     BMCWEB_LOG_DEBUG << "Get collection members for: " << collectionPath;
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::MapperCache::getInstance().getSubTreePaths(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Item.Connector"},
         [collectionPath, aResp,
          adapterId](const boost::system::error_code ec,
                     const std::vector<std::string>& objects) {
@@ -199,13 +199,7 @@ inline void getPortCollection(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
                 }
             }
             aResp->res.jsonValue["Members@odata.count"] = members.size();
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths",
-        "/xyz/openbmc_project/inventory", 0,
-        std::array<const char*, 1>{
-            "xyz.openbmc_project.Inventory.Item.Connector"});
+        });
 }
 
 /**
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <app.hpp>
+#include <dbus_utility.hpp>
 #include <utils/chassis_utils.hpp>
 #include <utils/json_utils.hpp>
 
@@ -267,7 +268,12 @@ inline void
         {"Description",
          "The collection of PowerSupply resource instances " + chassisID}};
 
-    crow::connections::systemBus->async_method_call(
+    // Served from the mapper cache when warm, so a ThermalSubsystem +
+    // PowerSubsystem dashboard view shares one inventory walk per change
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Item.PowerSupply"},
         [asyncResp, chassisID](
             const boost::system::error_code ec,
             const std::vector<std::pair<
@@ -350,13 +356,7 @@ inline void
                     "org.freedesktop.DBus.Properties", "Get",
                     "xyz.openbmc_project.Association", "endpoints");
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", int32_t(0),
-        std::array<const char*, 1>{
-            "xyz.openbmc_project.Inventory.Item.PowerSupply"});
+        });
 }
 
 template <typename Callback>
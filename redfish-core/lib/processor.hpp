@@ -20,6 +20,7 @@
 
 #include <app.hpp>
 #include <boost/container/flat_map.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <sdbusplus/message/native_types.hpp>
 #include <sdbusplus/utility/dedup_variant.hpp>
@@ -241,7 +242,10 @@ inline void getCpuDataByService(std::shared_ptr<bmcweb::AsyncResp> aResp,
 {
     BMCWEB_LOG_DEBUG << "Get available system cpu resources by service.";
 
-    crow::connections::systemBus->async_method_call(
+    // One inventory snapshot per epoch via the managed-objects cache; the
+    // client-side filtering below then runs over memory
+    dbus::utility::ManagedObjectsCache::getInstance().get(
+        service, "/xyz/openbmc_project/inventory",
         [cpuId, service, objPath, aResp{std::move(aResp)}](
             const boost::system::error_code ec,
             const dbus::utility::ManagedObjectType& dbusData) {
@@ -305,9 +309,7 @@ inline void getCpuDataByService(std::shared_ptr<bmcweb::AsyncResp> aResp,
                 aResp->res.jsonValue["TotalCores"] = totalCores;
             }
             return;
-        },
-        service, "/xyz/openbmc_project/inventory",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        });
 }
 
 inline void getCpuAssetData(std::shared_ptr<bmcweb::AsyncResp> aResp,
@@ -444,12 +446,13 @@ inline void getAcceleratorDataByService(
 {
     BMCWEB_LOG_DEBUG
         << "Get available system Accelerator resources by service.";
-    crow::connections::systemBus->async_method_call(
+    // Batched: concurrent accelerator fetches against one service collapse
+    // into a single GetManagedObjects call.
+    dbus::utility::ManagedObjectBatcher::getInstance().getObject(
+        service, "/xyz/openbmc_project/inventory", objPath,
         [acclrtrId, aResp{std::move(aResp)}](
             const boost::system::error_code ec,
-            const boost::container::flat_map<
-                std::string, std::variant<std::string, uint32_t, uint16_t,
-                                          bool>>& properties) {
+            const dbus::utility::DBusInteracesMap& interfaces) {
             if (ec)
             {
                 BMCWEB_LOG_DEBUG << "DBUS response error";
@@ -461,15 +464,18 @@ inline void getAcceleratorDataByService(
             const bool* accPresent = nullptr;
             const bool* accFunctional = nullptr;
 
-            for (const auto& property : properties)
+            for (const auto& interface : interfaces)
             {
-                if (property.first == "Functional")
-                {
-                    accFunctional = std::get_if<bool>(&property.second);
-                }
-                else if (property.first == "Present")
+                for (const auto& property : interface.second)
                 {
-                    accPresent = std::get_if<bool>(&property.second);
+                    if (property.first == "Functional")
+                    {
+                        accFunctional = std::get_if<bool>(&property.second);
+                    }
+                    else if (property.first == "Present")
+                    {
+                        accPresent = std::get_if<bool>(&property.second);
+                    }
                 }
             }
 
@@ -492,8 +498,7 @@ inline void getAcceleratorDataByService(
             aResp->res.jsonValue["Status"]["State"] = state;
             aResp->res.jsonValue["Status"]["Health"] = health;
             aResp->res.jsonValue["ProcessorType"] = "Accelerator";
-        },
-        service, objPath, "org.freedesktop.DBus.Properties", "GetAll", "");
+        });
 }
 
 // OperatingConfig D-Bus Types
@@ -965,7 +970,8 @@ inline void
     aResp->res.jsonValue["Status"]["State"] = "Enabled";
     aResp->res.jsonValue["Status"]["Health"] = "OK";
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::ManagedObjectsCache::getInstance().get(
+        service, "/xyz/openbmc_project/inventory",
         [objPath, aResp](const boost::system::error_code ec,
                          const dbus::utility::ManagedObjectType& dbusData) {
             if (ec)
@@ -1090,9 +1096,7 @@ inline void
                 hw_isolation_utils::getHwIsolationStatus(aResp, objPath);
 #endif // end of BMCWEB_ENABLE_HW_ISOLATION
             }
-        },
-        service, "/xyz/openbmc_project/inventory",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        });
 }
 
 inline void getSubProcessorData(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
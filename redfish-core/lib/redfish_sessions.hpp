@@ -110,18 +110,18 @@ inline void requestRoutesSession(App& app)
         .methods(boost::beast::http::verb::get)(
             [](const crow::Request& /*req*/,
                const std::shared_ptr<bmcweb::AsyncResp>& asyncResp) -> void {
-                std::vector<const std::string*> sessionIds =
+                std::vector<std::string> sessionIds =
                     persistent_data::SessionStore::getInstance().getUniqueIds(
                         false, persistent_data::PersistenceType::TIMEOUT);
 
                 asyncResp->res.jsonValue["Members@odata.count"] =
                     sessionIds.size();
                 asyncResp->res.jsonValue["Members"] = nlohmann::json::array();
-                for (const std::string* uid : sessionIds)
+                for (const std::string& uid : sessionIds)
                 {
                     asyncResp->res.jsonValue["Members"].push_back(
                         {{"@odata.id",
-                          "/redfish/v1/SessionService/Sessions/" + *uid}});
+                          "/redfish/v1/SessionService/Sessions/" + uid}});
                 }
                 asyncResp->res.jsonValue["Members@odata.count"] =
                     sessionIds.size();
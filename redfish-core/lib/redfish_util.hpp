@@ -16,6 +16,14 @@
 #pragma once
 #ifndef BMCWEB_ENABLE_REDFISH_ONE_CHASSIS
 
+#include <dbus_utility.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace redfish
 {
 
@@ -47,10 +55,82 @@ using UnitStruct =
                std::string, sdbusplus::message::object_path, uint32_t,
                std::string, sdbusplus::message::object_path>;
 
+// Memoized answer to a one-answer topology question: the main chassis
+// identity changes only on inventory events, yet it was re-derived from a
+// mapper GetSubTree on every Systems and several Managers GETs.  The first
+// answer is cached and dropped on InterfacesAdded/Removed under the
+// inventory namespace; the matches register before the first query leaves,
+// so there is no window where a change could slip past.  Once warm the
+// lookup is synchronous and the callback runs inline.
+class MainChassisIdCache
+{
+  public:
+    static MainChassisIdCache& getInstance()
+    {
+        static MainChassisIdCache cache;
+        return cache;
+    }
+
+    // Empty when cold; also registers the invalidation matches so they are
+    // in place before the caller's fallback query leaves
+    std::optional<std::string> tryGet()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ensureSubscribed();
+        return chassisId;
+    }
+
+    void store(const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        chassisId = id;
+    }
+
+  private:
+    MainChassisIdCache() = default;
+
+    // Callers must hold the mutex
+    void ensureSubscribed()
+    {
+        if (!matches.empty())
+        {
+            return;
+        }
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            chassisId.reset();
+        };
+        matches.reserve(2);
+        matches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded',"
+            "path_namespace='/xyz/openbmc_project/inventory'",
+            invalidate);
+        matches.emplace_back(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved',"
+            "path_namespace='/xyz/openbmc_project/inventory'",
+            invalidate);
+    }
+
+    std::optional<std::string> chassisId;
+    std::vector<sdbusplus::bus::match::match> matches;
+    std::mutex mutex;
+};
+
 template <typename CallbackFunc>
 void getMainChassisId(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
                       CallbackFunc&& callback)
 {
+    std::optional<std::string> cached =
+        MainChassisIdCache::getInstance().tryGet();
+    if (cached)
+    {
+        callback(*cached, asyncResp);
+        return;
+    }
     // Find managed chassis
     crow::connections::systemBus->async_method_call(
         [callback,
@@ -77,6 +157,7 @@ void getMainChassisId(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
             }
             std::string chassisId = subtree[0].first.substr(idPos + 1);
             BMCWEB_LOG_DEBUG << "chassisId = " << chassisId;
+            MainChassisIdCache::getInstance().store(chassisId);
             callback(chassisId, asyncResp);
         },
         "xyz.openbmc_project.ObjectMapper",
@@ -87,11 +168,90 @@ void getMainChassisId(std::shared_ptr<bmcweb::AsyncResp> asyncResp,
             "xyz.openbmc_project.Inventory.Item.Chassis"});
 }
 
+// Cached systemd unit list.  The network-protocol GET used to issue one
+// identical ListUnits round trip per protocol, each hauling back hundreds of
+// units, and security scanners poll that endpoint constantly.  One snapshot
+// is shared: it drops when systemd reports a job finishing (the point where
+// unit states change) or after a short TTL as a backstop.
+class UnitListCache
+{
+  public:
+    static UnitListCache& getInstance()
+    {
+        static UnitListCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void get(Callback&& callback)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            if (snapshot != nullptr &&
+                std::chrono::steady_clock::now() - fetchTime < snapshotTtl)
+            {
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     units{snapshot}]() mutable {
+                        callback(boost::system::error_code(), *units);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                const std::vector<UnitStruct>& units) mutable {
+                if (!ec)
+                {
+                    auto newSnapshot =
+                        std::make_shared<std::vector<UnitStruct>>(units);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshot = std::move(newSnapshot);
+                    fetchTime = std::chrono::steady_clock::now();
+                }
+                callback(ec, units);
+            },
+            "org.freedesktop.systemd1", "/org/freedesktop/systemd1",
+            "org.freedesktop.systemd1.Manager", "ListUnits");
+    }
+
+  private:
+    UnitListCache() = default;
+
+    static constexpr std::chrono::seconds snapshotTtl{10};
+
+    // Callers must hold the mutex
+    void ensureSubscribed()
+    {
+        if (jobRemovedMatch)
+        {
+            return;
+        }
+        jobRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',sender='org.freedesktop.systemd1',"
+            "interface='org.freedesktop.systemd1.Manager',"
+            "member='JobRemoved'",
+            [this](sdbusplus::message::message&) {
+                std::lock_guard<std::mutex> lock(mutex);
+                snapshot.reset();
+            });
+    }
+
+    std::shared_ptr<const std::vector<UnitStruct>> snapshot;
+    std::chrono::time_point<std::chrono::steady_clock> fetchTime;
+    std::optional<sdbusplus::bus::match::match> jobRemovedMatch;
+    std::mutex mutex;
+};
+
 template <typename CallbackFunc>
 void getPortStatusAndPath(const std::string& serviceName,
                           CallbackFunc&& callback)
 {
-    crow::connections::systemBus->async_method_call(
+    UnitListCache::getInstance().get(
         [serviceName,
          callback{std::move(callback)}](const boost::system::error_code ec,
                                         const std::vector<UnitStruct>& r) {
@@ -160,9 +320,7 @@ void getPortStatusAndPath(const std::string& serviceName,
             // return error code
             callback(ec1, "", false);
             BMCWEB_LOG_ERROR << ec1;
-        },
-        "org.freedesktop.systemd1", "/org/freedesktop/systemd1",
-        "org.freedesktop.systemd1.Manager", "ListUnits");
+        });
 }
 
 template <typename CallbackFunc>
@@ -21,6 +21,7 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/range/algorithm/replace_copy_if.hpp>
 #include <dbus_singleton.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <utils/json_utils.hpp>
 
@@ -43,6 +44,144 @@ using ManagedObjectsVectorType = std::vector<std::pair<
     boost::container::flat_map<
         std::string, boost::container::flat_map<std::string, SensorVariant>>>>;
 
+// Resident cache of per-connection sensor object snapshots.  The first GET
+// for a connection pays the full GetManagedObjects round trip; after that a
+// PropertiesChanged match on the sensor namespace folds value updates into
+// the snapshot in place, so a fully populated chassis answers from memory.
+// InterfacesAdded/Removed drops the snapshots, since sensors only come and
+// go when inventory changes.
+class SensorValueCache
+{
+  public:
+    static SensorValueCache& getInstance()
+    {
+        static SensorValueCache cache;
+        return cache;
+    }
+
+    template <typename Callback>
+    void getManagedObjects(const std::string& connection,
+                           const std::string& objectMgrPath,
+                           Callback&& callback)
+    {
+        std::string key = connection + '\x01' + objectMgrPath;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ensureSubscribed();
+            auto it = snapshots.find(key);
+            if (it != snapshots.end())
+            {
+                BMCWEB_LOG_DEBUG << "Sensor cache hit for " << connection;
+                boost::asio::post(
+                    crow::connections::systemBus->get_io_context(),
+                    [callback{std::forward<Callback>(callback)},
+                     snapshot{it->second}]() mutable {
+                        callback(boost::system::error_code(), *snapshot);
+                    });
+                return;
+            }
+        }
+        crow::connections::systemBus->async_method_call(
+            [this, key, callback{std::forward<Callback>(callback)}](
+                const boost::system::error_code ec,
+                ManagedObjectsVectorType& resp) mutable {
+                if (!ec)
+                {
+                    auto snapshot =
+                        std::make_shared<ManagedObjectsVectorType>(resp);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    snapshots[key] = std::move(snapshot);
+                }
+                callback(ec, resp);
+            },
+            connection, objectMgrPath, "org.freedesktop.DBus.ObjectManager",
+            "GetManagedObjects");
+    }
+
+  private:
+    SensorValueCache() = default;
+
+    // Lazily registered so the matches attach after the system bus exists.
+    // Callers must hold the mutex.
+    void ensureSubscribed()
+    {
+        if (propertiesChangedMatch)
+        {
+            return;
+        }
+        propertiesChangedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',member='PropertiesChanged',"
+            "interface='org.freedesktop.DBus.Properties',"
+            "path_namespace='/xyz/openbmc_project/sensors'",
+            [this](sdbusplus::message::message& msg) {
+                onPropertiesChanged(msg);
+            });
+        auto invalidate = [this](sdbusplus::message::message&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!snapshots.empty())
+            {
+                BMCWEB_LOG_DEBUG << "Sensor cache invalidated";
+                snapshots.clear();
+            }
+        };
+        interfacesAddedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesAdded'",
+            invalidate);
+        interfacesRemovedMatch.emplace(
+            *crow::connections::systemBus,
+            "type='signal',interface='org.freedesktop.DBus.ObjectManager',"
+            "member='InterfacesRemoved'",
+            invalidate);
+    }
+
+    void onPropertiesChanged(sdbusplus::message::message& msg)
+    {
+        std::string interface;
+        boost::container::flat_map<std::string, SensorVariant> changed;
+        try
+        {
+            msg.read(interface, changed);
+        }
+        catch (const std::exception&)
+        {
+            // Signals carrying property types outside SensorVariant aren't
+            // sensor values; nothing to fold in.
+            return;
+        }
+        const std::string path = msg.get_path();
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& snapshot : snapshots)
+        {
+            for (auto& object : *snapshot.second)
+            {
+                if (object.first.str != path)
+                {
+                    continue;
+                }
+                auto ifaceIt = object.second.find(interface);
+                if (ifaceIt == object.second.end())
+                {
+                    continue;
+                }
+                for (const auto& property : changed)
+                {
+                    ifaceIt->second[property.first] = property.second;
+                }
+            }
+        }
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<ManagedObjectsVectorType>>
+        snapshots;
+    std::optional<sdbusplus::bus::match::match> propertiesChangedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesAddedMatch;
+    std::optional<sdbusplus::bus::match::match> interfacesRemovedMatch;
+    std::mutex mutex;
+};
+
 namespace sensors
 {
 namespace node
@@ -377,11 +516,13 @@ void getObjectsWithConnection(
         callback(std::move(connections), std::move(objectsWithConnection));
         BMCWEB_LOG_DEBUG << "getObjectsWithConnection resp_handler exit";
     };
-    // Make call to ObjectMapper to find all sensors objects
-    crow::connections::systemBus->async_method_call(
-        std::move(respHandler), "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree", path, 2, interfaces);
+    // Make call to ObjectMapper to find all sensors objects.  Concurrent
+    // Thermal+Power+Chassis GETs issue this identical query within
+    // milliseconds; the mapper cache collapses them into one result set.
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        path, 2, std::vector<std::string>(interfaces.begin(),
+                                          interfaces.end()),
+        std::move(respHandler));
     BMCWEB_LOG_DEBUG << "getObjectsWithConnection exit";
 }
 
@@ -462,7 +603,7 @@ void getValidChassisPath(const std::shared_ptr<SensorsAsyncResp>& asyncResp,
                          Callback&& callback)
 {
     BMCWEB_LOG_DEBUG << "checkChassisId enter";
-    const std::array<const char*, 1> interfaces = {
+    const std::vector<std::string> interfaces = {
         "xyz.openbmc_project.Inventory.Item.Chassis"};
 
     auto respHandler =
@@ -498,12 +639,13 @@ void getValidChassisPath(const std::shared_ptr<SensorsAsyncResp>& asyncResp,
             callback(chassisPath);
         };
 
-    // Get the Chassis Collection
-    crow::connections::systemBus->async_method_call(
-        respHandler, "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths",
-        "/xyz/openbmc_project/inventory", 0, interfaces);
+    // Get the Chassis Collection, served from the mapper cache when warm.
+    // Chassis objects sit directly under the inventory system board tree;
+    // depth stays bounded rather than an unlimited crawl.
+    dbus::utility::MapperQuery query("getValidChassisPath",
+                                     "/xyz/openbmc_project/inventory", 6,
+                                     interfaces);
+    query.getSubTreePaths(std::move(respHandler));
     BMCWEB_LOG_DEBUG << "checkChassisId exit";
 }
 
@@ -587,8 +729,9 @@ void getChassis(const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
         }
 
         sensorsAsyncResp->asyncResp->res.jsonValue["@odata.id"] =
-            "/redfish/v1/Chassis/" + sensorsAsyncResp->chassisId + "/" +
-            chassisSubNode;
+            crow::utility::joinUrl("/redfish/v1/Chassis/",
+                                   sensorsAsyncResp->chassisId, "/",
+                                   chassisSubNode);
         sensorsAsyncResp->asyncResp->res.jsonValue["Name"] = chassisSubNode;
         // Get the list of all sensors for this Chassis element
         std::string sensorPath = *chassisPath + "/all_sensors";
@@ -634,12 +777,11 @@ void getChassis(const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
             "xyz.openbmc_project.Association", "endpoints");
     };
 
-    // Get the Chassis Collection
-    crow::connections::systemBus->async_method_call(
-        respHandler, "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths",
-        "/xyz/openbmc_project/inventory", 0, interfaces);
+    // Get the Chassis Collection, served from the mapper cache when warm
+    dbus::utility::MapperCache::getInstance().getSubTreePaths(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>(interfaces.begin(), interfaces.end()),
+        std::move(respHandler));
     BMCWEB_LOG_DEBUG << "getChassis exit";
 }
 
@@ -666,7 +808,7 @@ void getObjectManagerPaths(
     Callback&& callback)
 {
     BMCWEB_LOG_DEBUG << "getObjectManagerPaths enter";
-    const std::array<std::string, 1> interfaces = {
+    const std::vector<std::string> interfaces = {
         "org.freedesktop.DBus.ObjectManager"};
 
     // Response handler for GetSubTree DBus method
@@ -707,11 +849,12 @@ void getObjectManagerPaths(
         BMCWEB_LOG_DEBUG << "getObjectManagerPaths respHandler exit";
     };
 
-    // Query mapper for all DBus object paths that implement ObjectManager
-    crow::connections::systemBus->async_method_call(
-        std::move(respHandler), "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree", "/", 0, interfaces);
+    // Query mapper for DBus object paths that implement ObjectManager.
+    // Managers sit within a few elements of the root; a bounded depth
+    // keeps the mapper from crawling and returning the entire tree.
+    dbus::utility::MapperQuery query("getObjectManagerPaths", "/", 3,
+                                     interfaces);
+    query.getSubTree(std::move(respHandler));
     BMCWEB_LOG_DEBUG << "getObjectManagerPaths exit";
 }
 
@@ -1376,10 +1519,38 @@ inline void
         nlohmann::json::iterator entry = response.find(sensorGroup);
         if (entry != response.end())
         {
-            std::sort(entry->begin(), entry->end(),
-                      [](nlohmann::json& c1, nlohmann::json& c2) {
-                          return c1["Name"] < c2["Name"];
+            // Decorate-sort-undecorate: extract each entry's Name once
+            // instead of re-finding it in both operands of every
+            // comparison of the O(n log n) sort
+            std::vector<std::pair<std::string, nlohmann::json>> decorated;
+            decorated.reserve(entry->size());
+            for (nlohmann::json& item : *entry)
+            {
+                std::string key;
+                nlohmann::json::iterator nameIt = item.find("Name");
+                if (nameIt != item.end())
+                {
+                    const std::string* namePtr =
+                        nameIt->get_ptr<const std::string*>();
+                    if (namePtr != nullptr)
+                    {
+                        key = *namePtr;
+                    }
+                }
+                decorated.emplace_back(std::move(key), std::move(item));
+            }
+            std::sort(decorated.begin(), decorated.end(),
+                      [](const std::pair<std::string, nlohmann::json>& c1,
+                         const std::pair<std::string, nlohmann::json>& c2) {
+                          return c1.first < c2.first;
                       });
+            nlohmann::json::array_t sorted;
+            sorted.reserve(decorated.size());
+            for (std::pair<std::string, nlohmann::json>& item : decorated)
+            {
+                sorted.push_back(std::move(item.second));
+            }
+            *entry = std::move(sorted);
 
             // add the index counts to the end of each entry
             size_t count = 0;
@@ -2595,9 +2766,10 @@ inline void getSensorData(
                 if (sensorSchema == sensors::node::sensors)
                 {
                     sensorsAsyncResp->asyncResp->res.jsonValue["@odata.id"] =
-                        "/redfish/v1/Chassis/" + sensorsAsyncResp->chassisId +
-                        "/" + sensorsAsyncResp->chassisSubNode + "/" +
-                        sensorName;
+                        crow::utility::joinUrl(
+                            "/redfish/v1/Chassis/", sensorsAsyncResp->chassisId,
+                            "/", sensorsAsyncResp->chassisSubNode, "/",
+                            sensorName);
                     sensorJson = &(sensorsAsyncResp->asyncResp->res.jsonValue);
                 }
                 else
@@ -2651,10 +2823,11 @@ inline void getSensorData(
                             // naming in power.hpp.
                             tempArray.push_back(
                                 {{"@odata.id",
-                                  "/redfish/v1/Chassis/" +
-                                      sensorsAsyncResp->chassisId + "/" +
-                                      sensorsAsyncResp->chassisSubNode + "#/" +
-                                      fieldName + "/0"}});
+                                  crow::utility::joinUrl(
+                                      "/redfish/v1/Chassis/",
+                                      sensorsAsyncResp->chassisId, "/",
+                                      sensorsAsyncResp->chassisSubNode, "#/",
+                                      fieldName, "/0")}});
                         }
                         sensorJson = &(tempArray.back());
                     }
@@ -2671,10 +2844,11 @@ inline void getSensorData(
                     {
                         tempArray.push_back(
                             {{"@odata.id",
-                              "/redfish/v1/Chassis/" +
-                                  sensorsAsyncResp->chassisId + "/" +
-                                  sensorsAsyncResp->chassisSubNode + "#/" +
-                                  fieldName + "/"}});
+                              crow::utility::joinUrl(
+                                  "/redfish/v1/Chassis/",
+                                  sensorsAsyncResp->chassisId, "/",
+                                  sensorsAsyncResp->chassisSubNode, "#/",
+                                  fieldName, "/")}});
                         sensorJson = &(tempArray.back());
                     }
                 }
@@ -2705,9 +2879,8 @@ inline void getSensorData(
         BMCWEB_LOG_DEBUG << "ObjectManager path for " << connection << " is "
                          << objectMgrPath;
 
-        crow::connections::systemBus->async_method_call(
-            getManagedObjectsCb, connection, objectMgrPath,
-            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        SensorValueCache::getInstance().getManagedObjects(
+            connection, objectMgrPath, std::move(getManagedObjectsCb));
     }
     BMCWEB_LOG_DEBUG << "getSensorData exit";
 }
@@ -2921,13 +3094,17 @@ inline void setSensorsOverride(
                             sensorAsyncResp->asyncResp->res);
                         return;
                     }
+                    // All sets are dispatched concurrently; the shared
+                    // response completes when the last one reports in, and
+                    // failures are attributed per sensor
                     crow::connections::systemBus->async_method_call(
-                        [sensorAsyncResp](const boost::system::error_code ec) {
+                        [sensorAsyncResp,
+                         sensorName](const boost::system::error_code ec) {
                             if (ec)
                             {
-                                BMCWEB_LOG_DEBUG
-                                    << "setOverrideValueStatus DBUS error: "
-                                    << ec;
+                                BMCWEB_LOG_ERROR
+                                    << "setOverrideValueStatus DBUS error on "
+                                    << sensorName << ": " << ec;
                                 messages::internalError(
                                     sensorAsyncResp->asyncResp->res);
                                 return;
@@ -3084,12 +3261,13 @@ inline void metricsObjectInterfacesToJson(
             }
         }
     }
-    sensorJson["DataSourceUri"] = "/redfish/v1/Chassis/" +
-                                  sensorsAsyncResp->chassisId + "/Sensors/" +
-                                  sensorName;
-    sensorJson["@odata.id"] = "/redfish/v1/Chassis/" +
-                              sensorsAsyncResp->chassisId + "/Sensors/" +
-                              sensorName;
+    // Identical values; build once and move the second assignment
+    std::string sensorUri =
+        crow::utility::joinUrl("/redfish/v1/Chassis/",
+                               sensorsAsyncResp->chassisId, "/Sensors/",
+                               sensorName);
+    sensorJson["DataSourceUri"] = sensorUri;
+    sensorJson["@odata.id"] = std::move(sensorUri);
 
     sensorsAsyncResp->addMetadata(sensorJson, unit.to_string(),
                                   "/xyz/openbmc_project/sensors/" + sensorType +
@@ -3194,12 +3372,11 @@ void getThermalMetrics(
             "xyz.openbmc_project.Association", "endpoints");
     };
 
-    // Get the Chassis Collection
-    crow::connections::systemBus->async_method_call(
-        respHandler, "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths",
-        "/xyz/openbmc_project/inventory", 0, interfaces);
+    // Get the Chassis Collection, served from the mapper cache when warm
+    dbus::utility::MapperCache::getInstance().getSubTreePaths(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>(interfaces.begin(), interfaces.end()),
+        std::move(respHandler));
 }
 
 /**
@@ -3424,10 +3601,11 @@ inline void requestRoutesSensorCollection(App& app)
                             return;
                         }
                         entriesArray.push_back(
-                            {{"@odata.id", "/redfish/v1/Chassis/" +
-                                               asyncResp->chassisId + "/" +
-                                               asyncResp->chassisSubNode + "/" +
-                                               sensorName}});
+                            {{"@odata.id",
+                              crow::utility::joinUrl(
+                                  "/redfish/v1/Chassis/", asyncResp->chassisId,
+                                  "/", asyncResp->chassisSubNode, "/",
+                                  sensorName)}});
                     }
 
                     asyncResp->asyncResp->res.jsonValue["Members@odata.count"] =
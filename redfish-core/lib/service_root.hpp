@@ -23,51 +23,65 @@
 namespace redfish
 {
 
-inline void
-    handleServiceRootGet(const crow::Request&,
-                         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+inline void buildServiceRoot(nlohmann::json& jsonValue,
+                             const std::string& uuid)
 {
-
-    std::string uuid = persistent_data::getConfig().systemUuid;
-    asyncResp->res.jsonValue["@odata.type"] =
+    jsonValue["@odata.type"] =
         "#ServiceRoot.v1_12_0.ServiceRoot";
-    asyncResp->res.jsonValue["@odata.id"] = "/redfish/v1";
-    asyncResp->res.jsonValue["Id"] = "RootService";
-    asyncResp->res.jsonValue["Name"] = "Root Service";
-    asyncResp->res.jsonValue["RedfishVersion"] = "1.12.0";
-    asyncResp->res.jsonValue["Links"]["Sessions"] = {
+    jsonValue["@odata.id"] = "/redfish/v1";
+    jsonValue["Id"] = "RootService";
+    jsonValue["Name"] = "Root Service";
+    jsonValue["RedfishVersion"] = "1.12.0";
+    jsonValue["Links"]["Sessions"] = {
         {"@odata.id", "/redfish/v1/SessionService/Sessions"}};
-    asyncResp->res.jsonValue["AccountService"] = {
+    jsonValue["AccountService"] = {
         {"@odata.id", "/redfish/v1/AccountService"}};
-    asyncResp->res.jsonValue["Chassis"] = {
+    jsonValue["Chassis"] = {
         {"@odata.id", "/redfish/v1/Chassis"}};
-    asyncResp->res.jsonValue["JsonSchemas"] = {
+    jsonValue["JsonSchemas"] = {
         {"@odata.id", "/redfish/v1/JsonSchemas"}};
-    asyncResp->res.jsonValue["Managers"] = {
+    jsonValue["Managers"] = {
         {"@odata.id", "/redfish/v1/Managers"}};
-    asyncResp->res.jsonValue["SessionService"] = {
+    jsonValue["SessionService"] = {
         {"@odata.id", "/redfish/v1/SessionService"}};
-    asyncResp->res.jsonValue["Systems"] = {
+    jsonValue["Systems"] = {
         {"@odata.id", "/redfish/v1/Systems"}};
-    asyncResp->res.jsonValue["Registries"] = {
+    jsonValue["Registries"] = {
         {"@odata.id", "/redfish/v1/Registries"}};
 
-    asyncResp->res.jsonValue["UpdateService"] = {
+    jsonValue["UpdateService"] = {
         {"@odata.id", "/redfish/v1/UpdateService"}};
-    asyncResp->res.jsonValue["UUID"] = uuid;
-    asyncResp->res.jsonValue["CertificateService"] = {
+    jsonValue["UUID"] = uuid;
+    jsonValue["CertificateService"] = {
         {"@odata.id", "/redfish/v1/CertificateService"}};
-    asyncResp->res.jsonValue["Tasks"] = {
+    jsonValue["Tasks"] = {
         {"@odata.id", "/redfish/v1/TaskService"}};
-    asyncResp->res.jsonValue["EventService"] = {
+    jsonValue["EventService"] = {
         {"@odata.id", "/redfish/v1/EventService"}};
-    asyncResp->res.jsonValue["TelemetryService"] = {
+    jsonValue["TelemetryService"] = {
         {"@odata.id", "/redfish/v1/TelemetryService"}};
 #ifdef BMCWEB_ENABLE_REDFISH_LICENSE
-    asyncResp->res.jsonValue["LicenseService"] = {
+    jsonValue["LicenseService"] = {
         {"@odata.id", "/redfish/v1/LicenseService"}};
 #endif
-    asyncResp->res.jsonValue["Cables"] = {{"@odata.id", "/redfish/v1/Cables"}};
+    jsonValue["Cables"] = {{"@odata.id", "/redfish/v1/Cables"}};
+}
+
+inline void
+    handleServiceRootGet(const crow::Request&,
+                         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+{
+    // The service root is process-constant (the UUID is fixed at startup)
+    // and is the most-hit route in the tree; build it once and copy.
+    // Compile-time rendering is out of reach because the UUID comes from
+    // the persistent store, but once-per-process is the same steady state.
+    static const nlohmann::json serviceRoot = []() {
+        nlohmann::json built;
+        buildServiceRoot(built, persistent_data::getConfig().systemUuid);
+        return built;
+    }();
+    asyncResp->res.jsonValue = serviceRoot;
+
 }
 
 inline void requestRoutesServiceRoot(App& app)
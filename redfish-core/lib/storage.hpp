@@ -56,7 +56,10 @@ inline void requestRoutesStorage(App& app)
             asyncResp->res.jsonValue["Id"] = "1";
             asyncResp->res.jsonValue["Status"]["State"] = "Enabled";
 
-            crow::connections::systemBus->async_method_call(
+            dbus::utility::MapperCache::getInstance().getSubTreePaths(
+                "/xyz/openbmc_project/inventory", 0,
+                std::vector<std::string>{
+                    "xyz.openbmc_project.Inventory.Item.Drive"},
                 [asyncResp](const boost::system::error_code ec,
                             const std::vector<std::string>& storageList) {
                     nlohmann::json& storageArray =
@@ -91,15 +94,12 @@ inline void requestRoutesStorage(App& app)
                     }
 
                     count = storageArray.size();
-                },
-                "xyz.openbmc_project.ObjectMapper",
-                "/xyz/openbmc_project/object_mapper",
-                "xyz.openbmc_project.ObjectMapper", "GetSubTreePaths",
-                "/xyz/openbmc_project/inventory", int32_t(0),
-                std::array<const char*, 1>{
-                    "xyz.openbmc_project.Inventory.Item.Drive"});
-
-            crow::connections::systemBus->async_method_call(
+                });
+
+            dbus::utility::MapperCache::getInstance().getSubTree(
+                "/xyz/openbmc_project/inventory", 0,
+                std::vector<std::string>{
+                    "xyz.openbmc_project.Inventory.Item.StorageController"},
                 [asyncResp](
                     const boost::system::error_code ec,
                     const crow::openbmc_mapper::GetSubTreeType& subtree) {
@@ -238,13 +238,7 @@ inline void requestRoutesStorage(App& app)
                             "org.freedesktop.DBus.Properties", "GetAll",
                             "xyz.openbmc_project.Inventory.Decorator.Asset");
                     }
-                },
-                "xyz.openbmc_project.ObjectMapper",
-                "/xyz/openbmc_project/object_mapper",
-                "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-                "/xyz/openbmc_project/inventory", int32_t(0),
-                std::array<const char*, 1>{
-                    "xyz.openbmc_project.Inventory.Item.StorageController"});
+                });
         });
 }
 
@@ -257,7 +251,10 @@ inline void requestRoutesDrive(App& app)
                                               const std::shared_ptr<
                                                   bmcweb::AsyncResp>& asyncResp,
                                               const std::string& driveId) {
-            crow::connections::systemBus->async_method_call(
+            dbus::utility::MapperCache::getInstance().getSubTree(
+                "/xyz/openbmc_project/inventory", 0,
+                std::vector<std::string>{
+                    "xyz.openbmc_project.Inventory.Item.Drive"},
                 [asyncResp,
                  driveId](const boost::system::error_code ec,
                           const crow::openbmc_mapper::GetSubTreeType& subtree) {
@@ -428,13 +425,7 @@ inline void requestRoutesDrive(App& app)
                         },
                         connectionName, path, "org.freedesktop.DBus.Properties",
                         "Get", "xyz.openbmc_project.State.Drive", "Rebuilding");
-                },
-                "xyz.openbmc_project.ObjectMapper",
-                "/xyz/openbmc_project/object_mapper",
-                "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-                "/xyz/openbmc_project/inventory", int32_t(0),
-                std::array<const char*, 1>{
-                    "xyz.openbmc_project.Inventory.Item.Drive"});
+                });
         });
 }
 } // namespace redfish
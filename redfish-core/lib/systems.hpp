@@ -23,6 +23,7 @@
 #endif
 #include <app.hpp>
 #include <boost/container/flat_map.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <utils/fw_utils.hpp>
 #include <utils/json_utils.hpp>
@@ -303,7 +304,17 @@ inline void getComputerSystem(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
 {
     BMCWEB_LOG_DEBUG << "Get available system components.";
 
-    crow::connections::systemBus->async_method_call(
+    // Served from the mapper cache when warm; the per-object property
+    // fetches below all fan out in parallel from this one reply
+    dbus::utility::MapperCache::getInstance().getSubTree(
+        "/xyz/openbmc_project/inventory", 0,
+        std::vector<std::string>{
+            "xyz.openbmc_project.Inventory.Decorator.Asset",
+            "xyz.openbmc_project.Inventory.Item.Cpu",
+            "xyz.openbmc_project.Inventory.Item.Dimm",
+            "xyz.openbmc_project.Inventory.Item.System",
+            "xyz.openbmc_project.Common.UUID",
+        },
         [aResp](
             const boost::system::error_code ec,
             const std::vector<std::pair<
@@ -583,17 +594,6 @@ inline void getComputerSystem(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
                     }
                 }
             }
-        },
-        "xyz.openbmc_project.ObjectMapper",
-        "/xyz/openbmc_project/object_mapper",
-        "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-        "/xyz/openbmc_project/inventory", int32_t(0),
-        std::array<const char*, 5>{
-            "xyz.openbmc_project.Inventory.Decorator.Asset",
-            "xyz.openbmc_project.Inventory.Item.Cpu",
-            "xyz.openbmc_project.Inventory.Item.Dimm",
-            "xyz.openbmc_project.Inventory.Item.System",
-            "xyz.openbmc_project.Common.UUID",
         });
 }
 
@@ -607,9 +607,13 @@ inline void getComputerSystem(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
 inline void getHostState(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
 {
     BMCWEB_LOG_DEBUG << "Get host information.";
-    crow::connections::systemBus->async_method_call(
+    // Typed read: the reply arrives as the expected string and type
+    // mismatches fail fast instead of silently skipping
+    dbus::utility::getProperty<std::string>(
+        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
+        "xyz.openbmc_project.State.Host", "CurrentHostState",
         [aResp](const boost::system::error_code ec,
-                const std::variant<std::string>& hostState) {
+                const std::string& hostState) {
             if (ec)
             {
                 if (ec == boost::system::errc::host_unreachable)
@@ -624,9 +628,8 @@ inline void getHostState(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
                 return;
             }
 
-            const std::string* s = std::get_if<std::string>(&hostState);
+            const std::string* s = &hostState;
             BMCWEB_LOG_DEBUG << "Host state: " << *s;
-            if (s != nullptr)
             {
                 // Verify Host State
                 if (*s == "xyz.openbmc_project.State.Host.HostState.Running")
@@ -664,10 +667,7 @@ inline void getHostState(const std::shared_ptr<bmcweb::AsyncResp>& aResp)
                     aResp->res.jsonValue["Status"]["State"] = "Disabled";
                 }
             }
-        },
-        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
-        "org.freedesktop.DBus.Properties", "Get",
-        "xyz.openbmc_project.State.Host", "CurrentHostState");
+        });
 }
 
 /**
@@ -2630,6 +2630,13 @@ inline void requestRoutesSystemActionsReset(App& app)
 /**
  * Systems derived class for delivering Computer Systems Schema.
  */
+// Note on multi-property PATCH application: this tree does not carry the
+// upstream boot-source-override PATCH chain (setBootProperties and its
+// enable/mode/source/type setters were never merged here), so there is no
+// serialized four-round-trip path to batch.  When boot override support
+// lands, apply the validate-everything-first, set-concurrently,
+// respond-on-slowest pattern the account PATCH aggregator in
+// account_service.hpp establishes rather than chaining setters.
 inline void requestRoutesSystems(App& app)
 {
 
@@ -22,7 +22,9 @@
 #include <registries/privilege_registry.hpp>
 #include <task_messages.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <unordered_map>
 #include <variant>
 
 namespace redfish
@@ -36,6 +38,89 @@ static std::deque<std::shared_ptr<struct TaskData>> tasks;
 
 constexpr bool completed = true;
 
+// One sdbusplus match per unique match expression, shared by every task
+// registered with that expression.  Dozens of concurrent dump or firmware
+// tasks used to install dozens of identical broad matches in the daemon;
+// they now share one and demultiplex locally.
+class MatchDispatcher
+{
+  public:
+    static MatchDispatcher& getInstance()
+    {
+        static MatchDispatcher dispatcher;
+        return dispatcher;
+    }
+
+    void add(const std::string& matchStr,
+             const std::shared_ptr<struct TaskData>& task)
+    {
+        Entry& entry = entries[matchStr];
+        entry.tasks.emplace_back(task);
+        if (!entry.match)
+        {
+            try
+            {
+                entry.match = std::make_unique<sdbusplus::bus::match::match>(
+                    static_cast<sdbusplus::bus::bus&>(
+                        *crow::connections::systemBus),
+                    matchStr,
+                    [this, matchStr](sdbusplus::message::message& message) {
+                        dispatch(matchStr, message);
+                    });
+            }
+            catch (const sdbusplus::exception::exception& e)
+            {
+                // Registration can fail on a bus that isn't fully up (and
+                // in unit tests); the task then only completes by timeout
+                BMCWEB_LOG_ERROR << "Failed to register task match: "
+                                 << e.what();
+            }
+        }
+    }
+
+    void remove(const std::string& matchStr, const struct TaskData* task)
+    {
+        auto it = entries.find(matchStr);
+        if (it == entries.end())
+        {
+            return;
+        }
+        std::vector<std::weak_ptr<struct TaskData>>& taskList =
+            it->second.tasks;
+        taskList.erase(std::remove_if(taskList.begin(), taskList.end(),
+                                      [task](const std::weak_ptr<
+                                             struct TaskData>& weak) {
+                                          std::shared_ptr<struct TaskData>
+                                              locked = weak.lock();
+                                          return locked == nullptr ||
+                                                 locked.get() == task;
+                                      }),
+                       taskList.end());
+        if (taskList.empty())
+        {
+            // Last task for this expression; drop the daemon-side match
+            entries.erase(it);
+        }
+    }
+
+    // Fans one signal out to every task registered on the expression;
+    // public so the delivery semantics are testable without a live bus.
+    // Defined after TaskData, which it calls into.
+    void dispatch(const std::string& matchStr,
+                  sdbusplus::message::message& message);
+
+  private:
+    MatchDispatcher() = default;
+
+    struct Entry
+    {
+        std::unique_ptr<sdbusplus::bus::match::match> match;
+        std::vector<std::weak_ptr<struct TaskData>> tasks;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+};
+
 struct Payload
 {
     Payload(const crow::Request& req) :
@@ -123,7 +208,7 @@ struct TaskData : std::enable_shared_from_this<TaskData>
 
             // destroy all references
             last->timer.cancel();
-            last->match.reset();
+            last->unregisterMatch();
             tasks.pop_front();
         }
 
@@ -175,7 +260,7 @@ struct TaskData : std::enable_shared_from_this<TaskData>
                     // change ec to error as timer expired
                     ec = boost::asio::error::operation_aborted;
                 }
-                self->match.reset();
+                self->unregisterMatch();
                 sdbusplus::message::message msg;
                 self->finishTask();
                 self->state = "Cancelled";
@@ -261,33 +346,12 @@ struct TaskData : std::enable_shared_from_this<TaskData>
 
     void startTimer(const std::chrono::seconds& timeout)
     {
-        if (match)
+        if (matchActive)
         {
             return;
         }
-        match = std::make_unique<sdbusplus::bus::match::match>(
-            static_cast<sdbusplus::bus::bus&>(*crow::connections::systemBus),
-            matchStr,
-            [self = shared_from_this()](sdbusplus::message::message& message) {
-                boost::system::error_code ec;
-
-                // callback to return True if callback is done, callback needs
-                // to update status itself if needed
-                if (self->callback(ec, message, self) == task::completed)
-                {
-                    self->timer.cancel();
-                    self->finishTask();
-
-                    // Send event
-                    self->sendTaskEvent(self->state, self->index);
-
-                    // reset the match after the callback was successful
-                    boost::asio::post(
-                        crow::connections::systemBus->get_io_context(),
-                        [self] { self->match.reset(); });
-                    return;
-                }
-            });
+        matchActive = true;
+        MatchDispatcher::getInstance().add(matchStr, shared_from_this());
 
         extendTimer(timeout);
         messages.emplace_back(messages::taskStarted(std::to_string(index)));
@@ -295,6 +359,39 @@ struct TaskData : std::enable_shared_from_this<TaskData>
         sendTaskEvent(state, index);
     }
 
+    // Invoked by the shared MatchDispatcher for every signal matching this
+    // task's expression
+    void handleDbusMessage(sdbusplus::message::message& message)
+    {
+        std::shared_ptr<TaskData> self = shared_from_this();
+        boost::system::error_code ec;
+
+        // callback to return True if callback is done, callback needs
+        // to update status itself if needed
+        if (callback(ec, message, self) == task::completed)
+        {
+            timer.cancel();
+            finishTask();
+
+            // Send event
+            sendTaskEvent(state, index);
+
+            // unregister from the dispatcher after the callback was
+            // successful
+            boost::asio::post(crow::connections::systemBus->get_io_context(),
+                              [self] { self->unregisterMatch(); });
+        }
+    }
+
+    void unregisterMatch()
+    {
+        if (matchActive)
+        {
+            matchActive = false;
+            MatchDispatcher::getInstance().remove(matchStr, this);
+        }
+    }
+
     std::function<bool(boost::system::error_code, sdbusplus::message::message&,
                        const std::shared_ptr<TaskData>&)>
         callback;
@@ -305,13 +402,37 @@ struct TaskData : std::enable_shared_from_this<TaskData>
     std::string state;
     nlohmann::json messages;
     boost::asio::steady_timer timer;
-    std::unique_ptr<sdbusplus::bus::match::match> match;
+    bool matchActive = false;
     std::optional<time_t> endTime;
     std::optional<Payload> payload;
     bool gave204 = false;
     int percentComplete = 0;
 };
 
+inline void MatchDispatcher::dispatch(const std::string& matchStr,
+                                      sdbusplus::message::message& message)
+{
+    auto it = entries.find(matchStr);
+    if (it == entries.end())
+    {
+        return;
+    }
+    // Copy the list: a task callback may unregister mid-dispatch
+    std::vector<std::weak_ptr<TaskData>> taskList = it->second.tasks;
+    for (const std::weak_ptr<TaskData>& weak : taskList)
+    {
+        std::shared_ptr<TaskData> task = weak.lock();
+        if (task)
+        {
+            // Each callback reads the message and advances its cursor;
+            // rewind so every task sharing this match sees the payload
+            // from the start
+            sd_bus_message_rewind(message.get(), 1);
+            task->handleDbusMessage(message);
+        }
+    }
+}
+
 } // namespace task
 
 inline void requestRoutesTaskMonitor(App& app)
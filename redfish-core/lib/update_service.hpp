@@ -19,6 +19,7 @@
 
 #include <app.hpp>
 #include <boost/container/flat_map.hpp>
+#include <dbus_utility.hpp>
 #include <registries/privilege_registry.hpp>
 #include <utils/fw_utils.hpp>
 #include <utils/name_utils.hpp>
@@ -397,10 +398,7 @@ inline void httpSoftwareUpdate(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
         boost::uuids::to_string(boost::uuids::random_generator()()));
 
     BMCWEB_LOG_DEBUG << "Writing file to " << filepath;
-    std::ofstream out(filepath, std::ofstream::out | std::ofstream::binary |
-                                    std::ofstream::trunc);
-    out << req.body;
-    out.close();
+    fw_util::writeImageFile(filepath, req.bodyView());
     BMCWEB_LOG_DEBUG << "file upload complete!!";
 }
 
@@ -736,7 +734,15 @@ inline void requestRoutesSoftwareInventoryCollection(App& app)
                 asyncResp->res.jsonValue["Name"] =
                     "Software Inventory Collection";
 
-                crow::connections::systemBus->async_method_call(
+                // Note that only firmware levels associated with a device are
+                // stored under /xyz/openbmc_project/software, so that full
+                // path must be the mapper input to return only real
+                // FirmwareInventory items.  Served from the mapper cache
+                // when warm, invalidated when images come and go.
+                dbus::utility::MapperCache::getInstance().getSubTree(
+                    "/xyz/openbmc_project/software", 0,
+                    std::vector<std::string>{
+                        "xyz.openbmc_project.Software.Version"},
                     [asyncResp](
                         const boost::system::error_code ec,
                         const std::vector<std::pair<
@@ -773,18 +779,7 @@ inline void requestRoutesSoftwareInventoryCollection(App& app)
                             asyncResp->res.jsonValue["Members@odata.count"] =
                                 members.size();
                         }
-                    },
-                    // Note that only firmware levels associated with a device
-                    // are stored under /xyz/openbmc_project/software therefore
-                    // to ensure only real FirmwareInventory items are returned,
-                    // this full object path must be used here as input to
-                    // mapper
-                    "xyz.openbmc_project.ObjectMapper",
-                    "/xyz/openbmc_project/object_mapper",
-                    "xyz.openbmc_project.ObjectMapper", "GetSubTree",
-                    "/xyz/openbmc_project/software", static_cast<int32_t>(0),
-                    std::array<const char*, 1>{
-                        "xyz.openbmc_project.Software.Version"});
+                    });
             });
 }
 /* Fill related item links (i.e. bmc, bios) in for inventory */
@@ -197,9 +197,12 @@ inline void getVmResourceList(std::shared_ptr<bmcweb::AsyncResp> aResp,
                               const std::string& name)
 {
     BMCWEB_LOG_DEBUG << "Get available Virtual Media resources.";
-    crow::connections::systemBus->async_method_call(
+    // Served from the managed-objects cache; status polls during a transfer
+    // stop touching D-Bus until the media state actually changes
+    dbus::utility::ManagedObjectsCache::getInstance().get(
+        service, "/xyz/openbmc_project/VirtualMedia",
         [name, aResp{std::move(aResp)}](const boost::system::error_code ec,
-                                        ManagedObjectType& subtree) {
+                                        const ManagedObjectType& subtree) {
             if (ec)
             {
                 BMCWEB_LOG_DEBUG << "DBUS response error";
@@ -226,9 +229,7 @@ inline void getVmResourceList(std::shared_ptr<bmcweb::AsyncResp> aResp,
                 members.emplace_back(std::move(item));
             }
             aResp->res.jsonValue["Members@odata.count"] = members.size();
-        },
-        service, "/xyz/openbmc_project/VirtualMedia",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        });
 }
 
 /**
@@ -240,9 +241,10 @@ inline void getVmData(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
 {
     BMCWEB_LOG_DEBUG << "Get Virtual Media resource data.";
 
-    crow::connections::systemBus->async_method_call(
+    dbus::utility::ManagedObjectsCache::getInstance().get(
+        service, "/xyz/openbmc_project/VirtualMedia",
         [resName, name, aResp](const boost::system::error_code ec,
-                               ManagedObjectType& subtree) {
+                               const ManagedObjectType& subtree) {
             if (ec)
             {
                 BMCWEB_LOG_DEBUG << "DBUS response error";
@@ -303,9 +305,7 @@ inline void getVmData(const std::shared_ptr<bmcweb::AsyncResp>& aResp,
 
             messages::resourceNotFound(
                 aResp->res, "#VirtualMedia.v1_3_0.VirtualMedia", resName);
-        },
-        service, "/xyz/openbmc_project/VirtualMedia",
-        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        });
 }
 
 /**
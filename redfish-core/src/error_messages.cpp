@@ -22,8 +22,7 @@ namespace redfish
 namespace messages
 {
 
-void addMessageToErrorJson(nlohmann::json& target,
-                           const nlohmann::json& message)
+void addMessageToErrorJson(nlohmann::json& target, nlohmann::json message)
 {
     auto& error = target["error"];
 
@@ -66,11 +65,11 @@ void addMessageToErrorJson(nlohmann::json& target,
         extendedInfo = nlohmann::json::array();
     }
 
-    extendedInfo.push_back(message);
+    extendedInfo.push_back(std::move(message));
 }
 
 static void addMessageToJsonRoot(nlohmann::json& target,
-                                 const nlohmann::json& message)
+                                 nlohmann::json message)
 {
     if (!target[messages::messageAnnotation].is_array())
     {
@@ -78,10 +77,10 @@ static void addMessageToJsonRoot(nlohmann::json& target,
         target[messages::messageAnnotation] = nlohmann::json::array();
     }
 
-    target[messages::messageAnnotation].push_back(message);
+    target[messages::messageAnnotation].push_back(std::move(message));
 }
 
-void addMessageToJson(nlohmann::json& target, const nlohmann::json& message,
+void addMessageToJson(nlohmann::json& target, nlohmann::json message,
                       const std::string& fieldPath)
 {
     std::string extendedInfo(fieldPath + messages::messageAnnotation);
@@ -93,7 +92,7 @@ void addMessageToJson(nlohmann::json& target, const nlohmann::json& message,
     }
 
     // Object exists and it is an array so we can just push in the message
-    target[extendedInfo].push_back(message);
+    target[extendedInfo].push_back(std::move(message));
 }
 
 /**
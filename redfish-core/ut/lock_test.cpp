@@ -349,5 +349,79 @@ TEST_F(LockTest, ValidateSessionIDForGetlocklistGoodTestCase)
     ASSERT_EQ(1, result.size());
 }
 
+TEST_F(LockTest, WriteRecordCountGatesAllReadConflictScan)
+{
+    MockLock lockManager;
+    // A Write row from another session on the same resource
+    LockRequests writeRequest = request2;
+    std::get<0>(writeRequest[0]) = "wsess";
+    auto rc1 = lockManager.isConflictWithTable(writeRequest);
+    ASSERT_EQ(0, rc1.first);
+
+    // An all-Read acquire carries no Write records of its own; the
+    // bookkeeping must still see the table's Write record and run the
+    // conflict scan
+    auto rc2 = lockManager.isConflictWithTable(request1);
+    ASSERT_EQ(1, rc2.first);
+
+    // Releasing the writer's session decrements the count; the same Read
+    // acquire now succeeds
+    lockManager.releaseLock("wsess");
+    auto rc3 = lockManager.isConflictWithTable(request1);
+    ASSERT_EQ(0, rc3.first);
+}
+
+TEST_F(LockTest, WriteRecordCountFollowsIsItMyLockRelease)
+{
+    MockLock lockManager;
+    LockRequests writeRequest = request2;
+    std::get<0>(writeRequest[0]) = "wsess";
+    auto rc1 = lockManager.isConflictWithTable(writeRequest);
+    ASSERT_EQ(0, rc1.first);
+    uint32_t transactionId = std::get<uint32_t>(rc1.second);
+
+    ListOfTransactionIds transactionIds = {transactionId};
+    SessionFlags owner = {"hmc-id", "wsess"};
+    auto released = lockManager.isItMyLock(transactionIds, owner);
+    ASSERT_EQ(1, released.first);
+
+    // With the Write record gone through this path too, an all-Read
+    // acquire on the same resource must not conflict
+    auto rc2 = lockManager.isConflictWithTable(request1);
+    ASSERT_EQ(0, rc2.first);
+}
+
+TEST_F(LockTest, WriteRecordCountSurvivesPartialRelease)
+{
+    MockLock lockManager;
+    // Two Write rows from different sessions.  DontLock on the first
+    // segment keeps the writers comparing by resource bytes, so distinct
+    // resources don't conflict with each other; LockAll on the second
+    // still conflicts with any same-resource Read.
+    LockRequests firstWrite = request2;
+    std::get<0>(firstWrite[0]) = "wsess1";
+    std::get<4>(firstWrite[0]) = {{"DontLock", 2}, {"LockAll", 4}};
+    LockRequests secondWrite = request2;
+    std::get<0>(secondWrite[0]) = "wsess2";
+    std::get<4>(secondWrite[0]) = {{"DontLock", 2}, {"LockAll", 4}};
+    // Different resource so the writers don't conflict with each other
+    std::get<3>(secondWrite[0]) = 216179379183550464ULL;
+    auto rc1 = lockManager.isConflictWithTable(firstWrite);
+    ASSERT_EQ(0, rc1.first);
+    auto rc2 = lockManager.isConflictWithTable(secondWrite);
+    ASSERT_EQ(0, rc2.first);
+
+    // Releasing only one writer must leave the conflict scan armed: the
+    // remaining Write on request1's resource still blocks the Read
+    lockManager.releaseLock("wsess2");
+    auto rc3 = lockManager.isConflictWithTable(request1);
+    ASSERT_EQ(1, rc3.first);
+
+    // After the last Write goes, reads flow again
+    lockManager.releaseLock("wsess1");
+    auto rc4 = lockManager.isConflictWithTable(request1);
+    ASSERT_EQ(0, rc4.first);
+}
+
 } // namespace ibm_mc_lock
 } // namespace crow
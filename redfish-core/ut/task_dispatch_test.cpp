@@ -0,0 +1,71 @@
+#include "task.hpp"
+
+#include <systemd/sd-bus.h>
+
+#include <sdbusplus/asio/connection.hpp>
+
+#include "gmock/gmock.h"
+
+namespace redfish::task
+{
+namespace
+{
+
+// Two tasks sharing one match expression must each see the signal payload
+// from the start: every callback advances the message's read cursor, so
+// the dispatcher has to rewind between deliveries or the second task
+// reads garbage.
+TEST(TaskDispatch, SharedMatchDeliversFullPayloadToEveryTask)
+{
+    boost::asio::io_context io;
+    sd_bus* bus = nullptr;
+    ASSERT_GE(sd_bus_new(&bus), 0);
+    crow::connections::systemBus =
+        std::make_shared<sdbusplus::asio::connection>(io, bus);
+
+    const std::string matchStr =
+        "type='signal',interface='xyz.openbmc_project.Test.Dispatch'";
+
+    std::string firstRead;
+    std::string secondRead;
+    auto firstTask = TaskData::createTask(
+        [&firstRead](boost::system::error_code,
+                     sdbusplus::message::message& msg,
+                     const std::shared_ptr<TaskData>&) {
+            msg.read(firstRead);
+            return !completed;
+        },
+        matchStr);
+    auto secondTask = TaskData::createTask(
+        [&secondRead](boost::system::error_code,
+                      sdbusplus::message::message& msg,
+                      const std::shared_ptr<TaskData>&) {
+            msg.read(secondRead);
+            return !completed;
+        },
+        matchStr);
+
+    MatchDispatcher& dispatcher = MatchDispatcher::getInstance();
+    dispatcher.add(matchStr, firstTask);
+    dispatcher.add(matchStr, secondTask);
+
+    // An unconnected bus can still mint and seal messages
+    sdbusplus::message::message msg =
+        crow::connections::systemBus->new_method_call(
+            "xyz.openbmc_project.Test", "/xyz/openbmc_project/test",
+            "xyz.openbmc_project.Test.Dispatch", "Ping");
+    msg.append(std::string("payload"));
+    ASSERT_GE(sd_bus_message_seal(msg.get(), 1, 0), 0);
+
+    dispatcher.dispatch(matchStr, msg);
+
+    EXPECT_EQ(firstRead, "payload");
+    EXPECT_EQ(secondRead, "payload");
+
+    dispatcher.remove(matchStr, firstTask.get());
+    dispatcher.remove(matchStr, secondTask.get());
+    crow::connections::systemBus.reset();
+}
+
+} // namespace
+} // namespace redfish::task
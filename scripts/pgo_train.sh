@@ -0,0 +1,60 @@
+#!/bin/sh
+# Two-phase PGO driver: build instrumented, exercise a representative
+# request mix with the replay harness, then rebuild with the profile
+# applied.  Meson's b_pgo option does the compiler-flag plumbing
+# (-fprofile-generate / -fprofile-use on gcc, the clang equivalents when
+# cxx is clang); this script only sequences the phases.
+#
+# Usage:
+#   scripts/pgo_train.sh <builddir> <trace-file> [bmcweb-args...]
+#
+# The trace file feeds scripts/replay_load_test.py (one request per line:
+# "<offset> <method> <path>"); record one from a real HMC+telemetry
+# session so the profile weights variant visitation, routing and parsing
+# the way production does.  Training runs bmcweb from the instrumented
+# build on this machine - a dev build typically configures with
+# -Dinsecure-disable-auth or runs the dbus-mock configuration, since the
+# profile cares about code paths, not data.
+#
+# On the Cortex-A7 targets the profiled rebuild is what ships; the
+# .gcda files land in the builddir and meson reuses them in phase two.
+
+set -e
+
+BUILDDIR="${1:?usage: pgo_train.sh <builddir> <trace-file> [bmcweb-args...]}"
+TRACE="${2:?usage: pgo_train.sh <builddir> <trace-file> [bmcweb-args...]}"
+shift 2
+
+SCRIPTDIR="$(cd "$(dirname "$0")" && pwd)"
+SRCDIR="$SCRIPTDIR/.."
+
+echo "== phase 1: instrumented build =="
+if [ ! -f "$BUILDDIR/build.ninja" ]; then
+    meson setup "$BUILDDIR" "$SRCDIR" -Db_pgo=generate
+else
+    meson configure "$BUILDDIR" -Db_pgo=generate
+fi
+ninja -C "$BUILDDIR" bmcweb
+
+echo "== phase 1: training run =="
+"$BUILDDIR/bmcweb" "$@" &
+BMCWEB_PID=$!
+trap 'kill "$BMCWEB_PID" 2>/dev/null || true' EXIT
+# Give the instrumented binary (slower than production) time to listen
+sleep 3
+
+python3 "$SCRIPTDIR/replay_load_test.py" "$TRACE" --host localhost \
+    --speed 0 --connections 6 --no-tls || {
+    echo "replay failed; profile may be incomplete" >&2
+}
+
+# A clean shutdown flushes the profile counters
+kill "$BMCWEB_PID"
+wait "$BMCWEB_PID" 2>/dev/null || true
+trap - EXIT
+
+echo "== phase 2: profiled rebuild =="
+meson configure "$BUILDDIR" -Db_pgo=use
+ninja -C "$BUILDDIR" bmcweb
+
+echo "== done: $BUILDDIR/bmcweb is profile-optimized =="
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+# Replay recorded request traces against a running bmcweb and report
+# per-route latency percentiles.
+#
+# The trace file holds one request per line:
+#
+#     <offset-seconds> <method> <path>
+#
+# e.g.
+#
+#     0.000 GET /redfish/v1/
+#     0.120 GET /redfish/v1/Chassis/chassis/Thermal
+#     30.120 GET /redfish/v1/Chassis/chassis/Thermal
+#
+# Offsets are relative to the start of the trace; --speed rescales them
+# (0 replays as fast as the connections allow).  Requests are spread
+# round-robin over N keep-alive TLS connections so the mix exercises the
+# server the way a real HMC+telemetry load does.
+
+import argparse
+import http.client
+import ssl
+import sys
+import threading
+import time
+
+
+def parse_trace(path):
+    requests = []
+    with open(path) as trace:
+        for lineno, line in enumerate(trace, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            parts = line.split(None, 2)
+            if len(parts) != 3:
+                print(f"{path}:{lineno}: malformed line", file=sys.stderr)
+                continue
+            requests.append((float(parts[0]), parts[1].upper(), parts[2]))
+    return requests
+
+
+def route_key(path):
+    # Collapse obvious identifiers so percentiles group by route shape
+    segments = []
+    for segment in path.split("?")[0].split("/"):
+        if segment and (segment.isdigit() or len(segment) > 24):
+            segments.append("<id>")
+        else:
+            segments.append(segment)
+    return "/".join(segments)
+
+
+class Worker(threading.Thread):
+    def __init__(self, args, requests, start_time, results, lock):
+        super().__init__(daemon=True)
+        self.args = args
+        self.requests = requests
+        self.start_time = start_time
+        self.results = results
+        self.lock = lock
+        self.errors = 0
+
+    def connect(self):
+        if not self.args.no_tls:
+            context = ssl.create_default_context()
+            context.check_hostname = False
+            context.verify_mode = ssl.CERT_NONE
+            return http.client.HTTPSConnection(
+                self.args.host, self.args.port, context=context, timeout=30)
+        return http.client.HTTPConnection(
+            self.args.host, self.args.port, timeout=30)
+
+    def run(self):
+        conn = self.connect()
+        headers = {}
+        if self.args.token:
+            headers["X-Auth-Token"] = self.args.token
+        for offset, method, path in self.requests:
+            if self.args.speed > 0:
+                due = self.start_time + offset / self.args.speed
+                delay = due - time.monotonic()
+                if delay > 0:
+                    time.sleep(delay)
+            started = time.monotonic()
+            try:
+                conn.request(method, path, headers=headers)
+                response = conn.getresponse()
+                response.read()
+                status = response.status
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                conn.close()
+                conn = self.connect()
+                continue
+            latency = time.monotonic() - started
+            with self.lock:
+                self.results.setdefault(route_key(path), []).append(
+                    (latency, status))
+
+
+def percentile(values, fraction):
+    if not values:
+        return 0.0
+    index = min(len(values) - 1, int(len(values) * fraction))
+    return sorted(values)[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Replay a recorded request trace against bmcweb")
+    parser.add_argument("trace", help="trace file (offset method path)")
+    parser.add_argument("--host", default="localhost")
+    parser.add_argument("--port", type=int, default=443)
+    parser.add_argument("--connections", type=int, default=6,
+                        help="concurrent keep-alive connections")
+    parser.add_argument("--speed", type=float, default=1.0,
+                        help="time scale; 2 = twice as fast, 0 = flat out")
+    parser.add_argument("--token", help="X-Auth-Token for the session")
+    parser.add_argument("--no-tls", action="store_true",
+                        help="plain http (TLS with verification disabled is "
+                             "the default, matching bmcweb)")
+    args = parser.parse_args()
+
+    requests = parse_trace(args.trace)
+    if not requests:
+        print("empty trace", file=sys.stderr)
+        return 1
+
+    # Round-robin the trace across connections, preserving each request's
+    # original offset
+    shards = [requests[i::args.connections] for i in range(args.connections)]
+    results = {}
+    lock = threading.Lock()
+    start = time.monotonic()
+    workers = [Worker(args, shard, start, results, lock)
+               for shard in shards if shard]
+    for worker in workers:
+        worker.start()
+    for worker in workers:
+        worker.join()
+    elapsed = time.monotonic() - start
+
+    total = sum(len(v) for v in results.values())
+    errors = sum(w.errors for w in workers)
+    print(f"replayed {total} requests over {len(workers)} connections "
+          f"in {elapsed:.2f}s ({errors} connection errors)")
+    print(f"{'route':60} {'count':>6} {'p50ms':>8} {'p90ms':>8} "
+          f"{'p99ms':>8} {'!2xx':>5}")
+    for route in sorted(results, key=lambda r: -len(results[r])):
+        samples = results[route]
+        latencies = [s[0] for s in samples]
+        bad = sum(1 for s in samples if not 200 <= s[1] < 300)
+        print(f"{route:60} {len(samples):6} "
+              f"{percentile(latencies, 0.50) * 1000:8.1f} "
+              f"{percentile(latencies, 0.90) * 1000:8.1f} "
+              f"{percentile(latencies, 0.99) * 1000:8.1f} {bad:5}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,170 @@
+// Microbenchmarks for bmcweb's hottest pure-CPU paths.  Built as the
+// bmcweb-bench target when google-benchmark is available; tracked so
+// regressions in these paths are caught before they reach a BMC.
+
+#include "bmcweb_config.h"
+
+#include <benchmark/benchmark.h>
+
+#include <json_stream_serializer.hpp>
+#include <registries.hpp>
+#include <registries/base_message_registry.hpp>
+#include <registries/openbmc_message_registry.hpp>
+#include <routing.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// Allocation counting: global operator new/delete are replaced so any
+// benchmark can report allocations per iteration as a counter.  Counter
+// deltas are the regression signal - byte-for-byte timings vary with the
+// host, allocation counts don't.  CI compares the "allocs" counter against
+// the checked-in baseline via tools/compare.py from google-benchmark.
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static size_t currentAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+// Route dispatch: exact-match literal (frozen table fast path) and a
+// parameterized URL (node walk).
+static void routerFind(benchmark::State& state)
+{
+    crow::Trie trie;
+    trie.add("/redfish/v1/", 2);
+    trie.add("/redfish/v1/Systems/system/", 3);
+    trie.add("/redfish/v1/Chassis/<str>/Thermal/", 4);
+    trie.add("/redfish/v1/Managers/bmc/LogServices/Journal/Entries/", 5);
+    trie.validate();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(trie.find("/redfish/v1/"));
+        benchmark::DoNotOptimize(trie.find("/redfish/v1/Chassis/c1/Thermal/"));
+    }
+}
+BENCHMARK(routerFind);
+
+// Incremental json serialization of a sensor-shaped payload
+static void jsonChunkSerialize(benchmark::State& state)
+{
+    nlohmann::json doc;
+    nlohmann::json& members = doc["Temperatures"];
+    members = nlohmann::json::array();
+    for (int i = 0; i < 100; i++)
+    {
+        members.push_back({{"@odata.id", "/redfish/v1/Chassis/c/Thermal#/" +
+                                             std::to_string(i)},
+                           {"ReadingCelsius", 25.5 + i},
+                           {"Status",
+                            {{"State", "Enabled"}, {"Health", "OK"}}}});
+    }
+    for (auto _ : state)
+    {
+        nlohmann::json copy = doc;
+        json_stream_util::JsonChunkGenerator generator(std::move(copy));
+        size_t total = 0;
+        std::string chunk;
+        while (!(chunk = generator.next()).empty())
+        {
+            total += chunk.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK(jsonChunkSerialize);
+
+// Message registry resolution through the hashed index
+static void registryLookup(benchmark::State& state)
+{
+    boost::beast::span<const redfish::message_registries::MessageEntry>
+        registry(redfish::message_registries::base::registry.data(),
+                 redfish::message_registries::base::registry.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(redfish::message_registries::findMessage(
+            registry, "ResourceNotFound"));
+    }
+}
+BENCHMARK(registryLookup);
+
+// Message template substitution
+static void messageArgFill(benchmark::State& state)
+{
+    std::vector<std::string> args = {"/redfish/v1/Chassis/c1", "Thermal"};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(redfish::message_registries::fillMessageArgs(
+            args, "The resource %1 of type %2 was not found."));
+    }
+}
+BENCHMARK(messageArgFill);
+
+// Allocation budget for member-URL assembly: joinUrl reserves once, so one
+// heap allocation per URL is the contract; a regression to operator+
+// chaining shows up as a jump in this counter.
+static void urlAssemblyAllocs(benchmark::State& state)
+{
+    std::string chassisId = "chassis_with_a_realistic_name";
+    std::string sensorName = "ambient_virtual_temp";
+    size_t allocsBefore = currentAllocationCount();
+    size_t iterations = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(crow::utility::joinUrl(
+            "/redfish/v1/Chassis/", chassisId, "/Sensors/", sensorName));
+        iterations++;
+    }
+    state.counters["allocs"] = benchmark::Counter(
+        static_cast<double>(currentAllocationCount() - allocsBefore) /
+        static_cast<double>(iterations == 0 ? 1 : iterations));
+}
+BENCHMARK(urlAssemblyAllocs);
+
+// Allocation count for serializing an event payload and moving it through
+// to the queue boundary, the subscriber hot path
+static void eventPayloadAllocs(benchmark::State& state)
+{
+    nlohmann::json msgJson = {{"@odata.type", "#Event.v1_4_0.Event"},
+                              {"Id", "1"},
+                              {"Name", "Event Log"}};
+    size_t allocsBefore = currentAllocationCount();
+    size_t iterations = 0;
+    for (auto _ : state)
+    {
+        std::string payload = msgJson.dump(
+            2, ' ', true, nlohmann::json::error_handler_t::replace);
+        std::string queued = std::move(payload);
+        benchmark::DoNotOptimize(queued);
+        iterations++;
+    }
+    state.counters["allocs"] = benchmark::Counter(
+        static_cast<double>(currentAllocationCount() - allocsBefore) /
+        static_cast<double>(iterations == 0 ? 1 : iterations));
+}
+BENCHMARK(eventPayloadAllocs);
+
+BENCHMARK_MAIN();
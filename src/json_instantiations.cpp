@@ -0,0 +1,5 @@
+// The single emission point for the heavy common template instantiations;
+// see include/json_extern.hpp.
+#include <nlohmann/json.hpp>
+
+template class nlohmann::basic_json<>;